@@ -0,0 +1,133 @@
+#include "engine/asset/asset_cache.hpp"
+
+namespace dull::asset {
+
+[[nodiscard]] _AssetCache::Entry* _AssetCache::Find(uint32_t index, uint32_t generation) noexcept
+{
+    if (index >= this->entries.size()) return nullptr;
+
+    Entry& entry = this->entries[index];
+    return entry.isAllocated && entry.generation == generation ? &entry : nullptr;
+}
+
+[[nodiscard]] const _AssetCache::Entry* _AssetCache::Find(uint32_t index, uint32_t generation) const noexcept
+{
+    return const_cast<_AssetCache*>(this)->Find(index, generation);
+}
+
+[[nodiscard]] uint32_t _AssetCache::Allocate(const std::string& path, const std::type_info& type)
+{
+    uint32_t index = 0;
+
+    if (this->freeEntries.empty())
+    {
+        index = static_cast<uint32_t>(this->entries.size());
+        this->entries.emplace_back();
+    }
+    else
+    {
+        index = this->freeEntries.back();
+        this->freeEntries.pop_back();
+    }
+
+    Entry& entry = this->entries[index];
+    entry.path        = path;
+    entry.typePtr     = &type;
+    entry.byteSize    = 0;
+    entry.refCount    = 0;
+    entry.state       = AssetState::Loading;
+    entry.isAllocated = true;
+
+    this->lookup.emplace(path, index);
+    return index;
+}
+
+void _AssetCache::Free(uint32_t index) noexcept
+{
+    Entry& entry = this->entries[index];
+
+    if (entry.isInLru) this->UnlinkLru(index);
+
+    this->lookup.erase(entry.path);
+    this->cachedBytes -= entry.byteSize;
+
+    entry.assetPtr.reset();
+    entry.path.clear();
+    entry.byteSize    = 0;
+    entry.isAllocated = false;
+    entry.generation++;
+
+    this->freeEntries.push_back(index);
+}
+
+void _AssetCache::AddRef(uint32_t index) noexcept
+{
+    Entry& entry = this->entries[index];
+
+    if (entry.isInLru) this->UnlinkLru(index);
+
+    entry.refCount++;
+}
+
+void _AssetCache::Release(uint32_t index, uint32_t generation) noexcept
+{
+    Entry* entryPtr = this->Find(index, generation);
+
+    if (entryPtr == nullptr || --entryPtr->refCount != 0) return;
+
+    switch (entryPtr->state)
+    {
+    // Picked up by the completion once the load lands
+    case AssetState::Loading: return;
+
+    // Failures are not cached, a later request retries the load
+    case AssetState::Failed:
+        this->Free(index);
+        return;
+
+    case AssetState::Ready:
+        this->LinkLru(index);
+        this->Trim();
+        return;
+    }
+}
+
+void _AssetCache::LinkLru(uint32_t index) noexcept
+{
+    Entry& entry = this->entries[index];
+
+    entry.lruPrevious = NIL_ENTRY;
+    entry.lruNext     = this->lruHead;
+    entry.isInLru     = true;
+
+    if (this->lruHead != NIL_ENTRY) this->entries[this->lruHead].lruPrevious = index;
+    else this->lruTail = index;
+
+    this->lruHead = index;
+}
+
+void _AssetCache::UnlinkLru(uint32_t index) noexcept
+{
+    Entry& entry = this->entries[index];
+
+    if (entry.lruPrevious != NIL_ENTRY) this->entries[entry.lruPrevious].lruNext = entry.lruNext;
+    else this->lruHead = entry.lruNext;
+
+    if (entry.lruNext != NIL_ENTRY) this->entries[entry.lruNext].lruPrevious = entry.lruPrevious;
+    else this->lruTail = entry.lruPrevious;
+
+    entry.lruPrevious = NIL_ENTRY;
+    entry.lruNext     = NIL_ENTRY;
+    entry.isInLru     = false;
+}
+
+void _AssetCache::Trim() noexcept
+{
+    while (this->cachedBytes > this->budgetBytes && this->lruTail != NIL_ENTRY)
+    {
+        this->Free(this->lruTail);
+        this->evictedCount++;
+    }
+}
+
+} // namespace dull::asset
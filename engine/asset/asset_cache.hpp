@@ -0,0 +1,173 @@
+#pragma once
+
+#include "engine/asset/asset_traits.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace dull::asset {
+
+// Forward Declaration
+struct AssetManager;
+
+enum class AssetState : uint8_t {
+    Loading,
+    Ready,
+    Failed,
+};
+
+struct _IAsset {
+    virtual ~_IAsset() = default;
+};
+
+template <Asset AssetT>
+struct _AssetBox final : public _IAsset {
+    AssetT value;
+
+    explicit _AssetBox(AssetT&& asset) : value {std::move(asset)} {}
+};
+
+// ---
+// Asset entries shared by an AssetManager and its handles
+// Note: main thread only, outstanding handles keep it alive past the manager
+// Note: unreferenced entries stay cached in LRU order until the budget forces them out
+// ---
+struct _AssetCache final {
+    static constexpr uint32_t NIL_ENTRY = std::numeric_limits<uint32_t>::max();
+
+    struct Entry {
+        std::string path;
+        std::unique_ptr<_IAsset> assetPtr;
+        const std::type_info* typePtr = nullptr;
+        size_t     byteSize    = 0;
+        uint32_t   refCount    = 0;
+        uint32_t   generation  = 0;
+        uint32_t   lruPrevious = NIL_ENTRY;
+        uint32_t   lruNext     = NIL_ENTRY;
+        AssetState state       = AssetState::Loading;
+        bool       isInLru     = false;
+        bool       isAllocated = false;
+    };
+
+    std::vector<Entry> entries;
+    std::vector<uint32_t> freeEntries;
+    std::unordered_map<std::string, uint32_t> lookup;
+
+    uint32_t lruHead      = NIL_ENTRY; // most recently released
+    uint32_t lruTail      = NIL_ENTRY;
+    size_t   cachedBytes  = 0;
+    size_t   budgetBytes  = 0;
+    uint64_t evictedCount = 0;
+
+    [[nodiscard]] Entry* Find(uint32_t index, uint32_t generation) noexcept;
+    [[nodiscard]] const Entry* Find(uint32_t index, uint32_t generation) const noexcept;
+
+    [[nodiscard]] uint32_t Allocate(const std::string& path, const std::type_info& type);
+    void Free(uint32_t index) noexcept;
+
+    void AddRef(uint32_t index) noexcept;
+    void Release(uint32_t index, uint32_t generation) noexcept;
+
+    void LinkLru(uint32_t index) noexcept;
+    void UnlinkLru(uint32_t index) noexcept;
+
+    // Evicts least recently released entries until the cache fits the budget
+    void Trim() noexcept;
+};
+
+// ---
+// Reference counted handle to a cached asset
+// Note: copy and destroy on the main thread only
+// ---
+template <Asset AssetT>
+struct AssetHandle final {
+    friend AssetManager;
+
+private:
+    std::shared_ptr<_AssetCache> _cachePtr;
+    uint32_t _index      = _AssetCache::NIL_ENTRY;
+    uint32_t _generation = 0;
+
+    AssetHandle(std::shared_ptr<_AssetCache> cachePtr, uint32_t index) noexcept
+        : _cachePtr {std::move(cachePtr)}
+        , _index {index}
+        , _generation {this->_cachePtr->entries[index].generation}
+    {}
+
+    [[nodiscard]] const _AssetCache::Entry* _GetEntry() const noexcept
+    {
+        return this->_cachePtr == nullptr ? nullptr : this->_cachePtr->Find(this->_index, this->_generation);
+    }
+
+public:
+    AssetHandle() noexcept = default;
+
+    AssetHandle(const AssetHandle& other) noexcept
+        : _cachePtr {other._cachePtr}
+        , _index {other._index}
+        , _generation {other._generation}
+    {
+        if (this->_cachePtr != nullptr) this->_cachePtr->AddRef(this->_index);
+    }
+
+    AssetHandle(AssetHandle&& other) noexcept
+        : _cachePtr {std::move(other._cachePtr)}
+        , _index {std::exchange(other._index, _AssetCache::NIL_ENTRY)}
+        , _generation {other._generation}
+    {}
+
+    AssetHandle& operator=(AssetHandle other) noexcept
+    {
+        std::swap(this->_cachePtr, other._cachePtr);
+        std::swap(this->_index, other._index);
+        std::swap(this->_generation, other._generation);
+        return *this;
+    }
+
+    ~AssetHandle() noexcept { this->Reset(); }
+
+    void Reset() noexcept
+    {
+        if (this->_cachePtr != nullptr) this->_cachePtr->Release(this->_index, this->_generation);
+
+        this->_cachePtr.reset();
+        this->_index = _AssetCache::NIL_ENTRY;
+    }
+
+    [[nodiscard]] bool IsNull() const noexcept { return this->_cachePtr == nullptr; }
+
+    [[nodiscard]] AssetState GetState() const noexcept
+    {
+        const _AssetCache::Entry* entryPtr = this->_GetEntry();
+        return entryPtr == nullptr ? AssetState::Failed : entryPtr->state;
+    }
+
+    [[nodiscard]] bool IsReady () const noexcept { return this->GetState() == AssetState::Ready;  }
+    [[nodiscard]] bool IsFailed() const noexcept { return this->GetState() == AssetState::Failed; }
+
+    // Null until the asset is ready
+    [[nodiscard]] const AssetT* Get() const noexcept
+    {
+        const _AssetCache::Entry* entryPtr = this->_GetEntry();
+
+        if (entryPtr == nullptr || entryPtr->state != AssetState::Ready) return nullptr;
+
+        return &static_cast<const _AssetBox<AssetT>&>(*entryPtr->assetPtr).value;
+    }
+
+    [[nodiscard]] const std::string& GetPath() const noexcept
+    {
+        static const std::string EMPTY_PATH;
+
+        const _AssetCache::Entry* entryPtr = this->_GetEntry();
+        return entryPtr == nullptr ? EMPTY_PATH : entryPtr->path;
+    }
+};
+
+} // namespace dull::asset
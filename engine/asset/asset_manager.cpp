@@ -0,0 +1,228 @@
+#include "engine/asset/asset_manager.hpp"
+#include "engine/platform/mapped_file.hpp"
+#include "engine/profile/profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace dull::asset {
+
+AssetManager::AssetManager(size_t budgetBytes, uint32_t workerCount)
+{
+    this->_cachePtr->budgetBytes = budgetBytes;
+    this->_throughputStart = this->_clock.INow();
+
+    for (uint32_t index = 0; index < std::max<uint32_t>(workerCount, 1); index++)
+        this->_workers.emplace_back(&AssetManager::_WorkerLoop, this);
+}
+
+AssetManager::~AssetManager() noexcept
+{
+    {
+        std::lock_guard lock {this->_jobMutex};
+        this->_isStopping = true;
+    }
+
+    this->_jobCondition.notify_all();
+
+    for (std::thread& worker : this->_workers) worker.join();
+}
+
+void AssetManager::_Request(uint32_t index, _DecodeFn decode, _FinalizeFn finalize)
+{
+    const std::string& path = this->_cachePtr->entries[index].path;
+
+    const PackArchive* packPtr      = nullptr;
+    const PackEntry*   packEntryPtr = nullptr;
+
+    for (auto it = this->_packs.rbegin(); it != this->_packs.rend() && packEntryPtr == nullptr; it++)
+    {
+        packPtr      = *it;
+        packEntryPtr = packPtr->Find(path);
+    }
+
+    {
+        std::lock_guard lock {this->_jobMutex};
+        this->_jobs.push_back({path, decode, finalize, packPtr, packEntryPtr, index, this->_clock.INow()});
+    }
+
+    this->_pendingCount++;
+    this->_jobCondition.notify_one();
+}
+
+void AssetManager::_WorkerLoop()
+{
+    // Decompression target reused across compressed pack entries
+    std::vector<std::byte> scratch;
+
+    while (true)
+    {
+        _Job job;
+
+        {
+            std::unique_lock lock {this->_jobMutex};
+            this->_jobCondition.wait(lock, [this] { return this->_isStopping || !this->_jobs.empty(); });
+
+            // Pending jobs are dropped on shutdown, nobody is left to receive them
+            if (this->_isStopping) return;
+
+            job = std::move(this->_jobs.front());
+            this->_jobs.pop_front();
+        }
+
+        DULL_PROFILE_ZONE("AssetManager::Load");
+
+        platform::MappedFile file;
+        std::unique_ptr<_IAsset> assetPtr;
+        size_t byteSize  = 0;
+        size_t fileBytes = 0;
+
+        if (job.packEntryPtr != nullptr)
+        {
+            const PackEntry& entry = *job.packEntryPtr;
+            fileBytes = entry.storedSize;
+
+            if (entry.compression == PackCompression::None)
+                assetPtr = job.decode(job.packPtr->GetStoredBytes(entry), byteSize);
+            else if (job.packPtr->Read(entry, scratch))
+                assetPtr = job.decode(scratch, byteSize);
+        }
+        else if (file.Open(job.path))
+        {
+            fileBytes = file.GetSize();
+            assetPtr  = job.decode(file.GetBytes(), byteSize);
+        }
+
+        {
+            std::lock_guard lock {this->_completionMutex};
+            this->_completions.push_back({
+                std::move(assetPtr), job.finalize, job.index, byteSize, fileBytes, job.requestTime, this->_clock.INow()
+            });
+        }
+
+        this->_completionCondition.notify_one();
+    }
+}
+
+void AssetManager::Mount(const PackArchive& pack)
+{
+    zutil::Assert(pack.IsOpen(), "Mounting a closed pack");
+    this->_packs.push_back(&pack);
+}
+
+void AssetManager::Update()
+{
+    DULL_PROFILE_FUNCTION();
+
+    {
+        std::lock_guard lock {this->_completionMutex};
+        this->_drainedCompletions.swap(this->_completions);
+    }
+
+    _AssetCache& cache = *this->_cachePtr;
+
+    for (_Completion& completion : this->_drainedCompletions)
+    {
+        _AssetCache::Entry& entry = cache.entries[completion.index];
+
+        this->_pendingCount--;
+        this->_latencies[this->_latencyCount++ % LATENCY_WINDOW] = completion.finishTime - completion.requestTime;
+
+        if (completion.assetPtr == nullptr)
+        {
+            this->_failedCount++;
+            entry.state = AssetState::Failed;
+
+            // Every handle let go while it was loading
+            if (entry.refCount == 0) cache.Free(completion.index);
+
+            continue;
+        }
+
+        completion.finalize(*completion.assetPtr);
+
+        entry.assetPtr = std::move(completion.assetPtr);
+        entry.byteSize = completion.byteSize;
+        entry.state    = AssetState::Ready;
+
+        cache.cachedBytes += completion.byteSize;
+
+        if (entry.refCount == 0) cache.LinkLru(completion.index);
+
+        this->_loadedCount++;
+        this->_loadedBytes     += completion.fileBytes;
+        this->_throughputBytes += completion.fileBytes;
+    }
+
+    this->_drainedCompletions.clear();
+    cache.Trim();
+
+    const double NOW = this->_clock.INow();
+
+    if (NOW - this->_throughputStart >= 1.0)
+    {
+        this->_bytesPerSecond  = static_cast<double>(this->_throughputBytes) / (NOW - this->_throughputStart);
+        this->_throughputBytes = 0;
+        this->_throughputStart = NOW;
+    }
+}
+
+void AssetManager::WaitAll()
+{
+    this->Update();
+
+    while (this->_pendingCount != 0)
+    {
+        {
+            std::unique_lock lock {this->_completionMutex};
+            this->_completionCondition.wait(lock, [this] { return !this->_completions.empty(); });
+        }
+
+        this->Update();
+    }
+}
+
+void AssetManager::SetBudget(size_t budgetBytes) noexcept
+{
+    this->_cachePtr->budgetBytes = budgetBytes;
+    this->_cachePtr->Trim();
+}
+
+[[nodiscard]] AssetMetrics AssetManager::GetMetrics()
+{
+    AssetMetrics metrics {};
+
+    {
+        std::lock_guard lock {this->_jobMutex};
+        metrics.queueDepth = this->_jobs.size();
+    }
+
+    metrics.pendingCount   = this->_pendingCount;
+    metrics.loadedCount    = this->_loadedCount;
+    metrics.failedCount    = this->_failedCount;
+    metrics.loadedBytes    = this->_loadedBytes;
+    metrics.evictedCount   = this->_cachePtr->evictedCount;
+    metrics.cachedBytes    = this->_cachePtr->cachedBytes;
+    metrics.budgetBytes    = this->_cachePtr->budgetBytes;
+    metrics.bytesPerSecond = this->_bytesPerSecond;
+
+    const size_t SAMPLE_COUNT = std::min(this->_latencyCount, LATENCY_WINDOW);
+
+    if (SAMPLE_COUNT == 0) return metrics;
+
+    std::array<double, LATENCY_WINDOW> samples;
+    std::copy_n(this->_latencies.begin(), SAMPLE_COUNT, samples.begin());
+
+    double latencySum = 0.0;
+    for (size_t index = 0; index < SAMPLE_COUNT; index++) latencySum += samples[index];
+
+    const size_t P99_INDEX = (SAMPLE_COUNT * 99) / 100;
+    std::nth_element(samples.begin(), samples.begin() + P99_INDEX, samples.begin() + SAMPLE_COUNT);
+
+    metrics.avgLatencyMs = latencySum / static_cast<double>(SAMPLE_COUNT) * 1000.0;
+    metrics.p99LatencyMs = samples[P99_INDEX] * 1000.0;
+
+    return metrics;
+}
+
+} // namespace dull::asset
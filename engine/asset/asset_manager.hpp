@@ -0,0 +1,170 @@
+#pragma once
+
+#include "engine/asset/asset_cache.hpp"
+#include "engine/asset/asset_traits.hpp"
+#include "engine/asset/pack_archive.hpp"
+#include "engine/platform/i_clock.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+namespace dull::asset {
+
+// ---
+// Load statistics of an AssetManager
+// Note: latency is request to completion, bytes/sec covers the last full second of completions
+// ---
+struct AssetMetrics final {
+    size_t   queueDepth     = 0; // requests no worker picked up yet
+    size_t   pendingCount   = 0; // requests not handed back to the main thread yet
+    uint64_t loadedCount    = 0;
+    uint64_t failedCount    = 0;
+    uint64_t loadedBytes    = 0; // file bytes read by the workers
+    uint64_t evictedCount   = 0;
+    size_t   cachedBytes    = 0; // decoded bytes held by the cache
+    size_t   budgetBytes    = 0;
+    double   bytesPerSecond = 0.0;
+    double   avgLatencyMs   = 0.0;
+    double   p99LatencyMs   = 0.0;
+};
+
+// ---
+// Loads assets on background threads and caches them behind reference counted handles
+// Note: files are memory mapped and decoded on the workers, results come back through a completion queue
+// Note: requests for a path already cached or in flight share the same entry
+// Note: paths found in a mounted pack are decoded straight from the archive, loose files otherwise
+// Note: main thread API, completions are applied by Update (App calls it every frame)
+// ---
+struct AssetManager final {
+private:
+    using _DecodeFn   = std::unique_ptr<_IAsset> (*)(std::span<const std::byte> bytes, size_t& byteSize);
+    using _FinalizeFn = void (*)(_IAsset& asset);
+
+    static constexpr size_t LATENCY_WINDOW = 1024;
+
+    struct _Job {
+        std::string path;
+        _DecodeFn   decode;
+        _FinalizeFn finalize;
+        const PackArchive* packPtr;
+        const PackEntry*   packEntryPtr;
+        uint32_t    index;
+        double      requestTime;
+    };
+
+    struct _Completion {
+        std::unique_ptr<_IAsset> assetPtr;
+        _FinalizeFn finalize;
+        uint32_t    index;
+        size_t      byteSize;
+        size_t      fileBytes;
+        double      requestTime;
+        double      finishTime;
+    };
+
+    std::shared_ptr<_AssetCache> _cachePtr = std::make_shared<_AssetCache>();
+    std::vector<const PackArchive*> _packs;
+    platform::SteadyClock _clock;
+
+    std::vector<std::thread> _workers;
+    std::mutex _jobMutex;
+    std::condition_variable _jobCondition;
+    std::deque<_Job> _jobs;
+    bool _isStopping = false;
+
+    std::mutex _completionMutex;
+    std::condition_variable _completionCondition;
+    std::vector<_Completion> _completions;
+    std::vector<_Completion> _drainedCompletions;
+
+    size_t   _pendingCount = 0;
+    uint64_t _loadedCount  = 0;
+    uint64_t _failedCount  = 0;
+    uint64_t _loadedBytes  = 0;
+
+    std::array<double, LATENCY_WINDOW> _latencies {};
+    size_t _latencyCount = 0;
+
+    double   _throughputStart = 0.0;
+    uint64_t _throughputBytes = 0;
+    double   _bytesPerSecond  = 0.0;
+
+    void _WorkerLoop();
+    void _Request(uint32_t index, _DecodeFn decode, _FinalizeFn finalize);
+
+    template <Asset AssetT>
+    [[nodiscard]] static std::unique_ptr<_IAsset> _Decode(std::span<const std::byte> bytes, size_t& byteSize)
+    {
+        std::optional<AssetT> asset = AssetTraits<AssetT>::Decode(bytes);
+
+        if (!asset.has_value()) return nullptr;
+
+        byteSize = AssetTraits<AssetT>::GetByteSize(*asset);
+        return std::make_unique<_AssetBox<AssetT>>(std::move(*asset));
+    }
+
+    template <Asset AssetT>
+    static void _Finalize(_IAsset& asset)
+    {
+        if constexpr (FinalizedAsset<AssetT>) AssetTraits<AssetT>::Finalize(static_cast<_AssetBox<AssetT>&>(asset).value);
+    }
+
+public:
+    AssetManager(AssetManager&&)                 = delete;
+    AssetManager(const AssetManager&)            = delete;
+    AssetManager& operator=(AssetManager&&)      = delete;
+    AssetManager& operator=(const AssetManager&) = delete;
+
+    explicit AssetManager(size_t budgetBytes, uint32_t workerCount = 2);
+    ~AssetManager() noexcept;
+
+    // Note: a path can only be loaded as one asset type at a time
+    template <Asset AssetT>
+    [[nodiscard]] AssetHandle<AssetT> Load(const std::string& path)
+    {
+        _AssetCache& cache = *this->_cachePtr;
+        const auto FOUND = cache.lookup.find(path);
+
+        if (FOUND != cache.lookup.end())
+        {
+            zutil::Assert(*cache.entries[FOUND->second].typePtr == typeid(AssetT), "Asset path loaded as another type");
+
+            cache.AddRef(FOUND->second);
+            return {this->_cachePtr, FOUND->second};
+        }
+
+        const uint32_t INDEX = cache.Allocate(path, typeid(AssetT));
+
+        cache.AddRef(INDEX);
+        this->_Request(INDEX, &AssetManager::_Decode<AssetT>, &AssetManager::_Finalize<AssetT>);
+
+        return {this->_cachePtr, INDEX};
+    }
+
+    // Later mounts take priority, the pack must outlive the manager
+    void Mount(const PackArchive& pack);
+
+    // Applies finished loads, finalizers run here
+    void Update();
+
+    // Blocks until every request so far is applied
+    void WaitAll();
+
+    void SetBudget(size_t budgetBytes) noexcept;
+
+    [[nodiscard]] AssetMetrics GetMetrics();
+};
+
+} // namespace dull::asset
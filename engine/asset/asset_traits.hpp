@@ -0,0 +1,58 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace dull::asset {
+
+// ---
+// Describes how an asset type is built from file bytes
+// Note: Decode runs on an asset worker thread, the optional Finalize on the main thread (GPU uploads and the like)
+// ---
+template <typename AssetT>
+struct AssetTraits;
+
+template <typename AssetT>
+concept Asset = requires (std::span<const std::byte> bytes, const AssetT& asset) {
+    { AssetTraits<AssetT>::Decode(bytes) } -> std::same_as<std::optional<AssetT>>;
+    { AssetTraits<AssetT>::GetByteSize(asset) } -> std::convertible_to<size_t>;
+};
+
+template <typename AssetT>
+concept FinalizedAsset = Asset<AssetT> && requires (AssetT& asset) { AssetTraits<AssetT>::Finalize(asset); };
+
+// --- Built-in assets ---
+
+struct BinaryAsset final {
+    std::vector<std::byte> bytes;
+};
+
+struct TextAsset final {
+    std::string text;
+};
+
+template <>
+struct AssetTraits<BinaryAsset> {
+    [[nodiscard]] static std::optional<BinaryAsset> Decode(std::span<const std::byte> bytes)
+    {
+        return BinaryAsset {{bytes.begin(), bytes.end()}};
+    }
+
+    [[nodiscard]] static size_t GetByteSize(const BinaryAsset& asset) noexcept { return asset.bytes.size(); }
+};
+
+template <>
+struct AssetTraits<TextAsset> {
+    [[nodiscard]] static std::optional<TextAsset> Decode(std::span<const std::byte> bytes)
+    {
+        return TextAsset {{reinterpret_cast<const char*>(bytes.data()), bytes.size()}};
+    }
+
+    [[nodiscard]] static size_t GetByteSize(const TextAsset& asset) noexcept { return asset.text.size(); }
+};
+
+} // namespace dull::asset
@@ -0,0 +1,126 @@
+#include "engine/asset/pack_archive.hpp"
+#include "engine/asset/pack_compression.hpp"
+
+#include <cstring>
+
+namespace dull::asset {
+
+// Bounds check that can't overflow on hostile offsets
+[[nodiscard]] static bool sIsInRange(uint64_t offset, uint64_t size, uint64_t fileSize) noexcept
+{
+    return offset <= fileSize && size <= fileSize - offset;
+}
+
+[[nodiscard]] bool PackArchive::Open(const std::string& path) noexcept
+{
+    this->Close();
+
+    if (!this->_file.Open(path)) return false;
+
+    if (!this->_Validate())
+    {
+        this->Close();
+        return false;
+    }
+
+    return true;
+}
+
+void PackArchive::Close() noexcept
+{
+    this->_file        = {};
+    this->_directory   = {};
+    this->_entries     = {};
+    this->_names       = {};
+    this->_bucketCount = 0;
+}
+
+[[nodiscard]] bool PackArchive::_Validate() noexcept
+{
+    const std::span<const std::byte> BYTES = this->_file.GetBytes();
+    const uint64_t FILE_SIZE = BYTES.size();
+
+    if (FILE_SIZE < sizeof(PackHeader)) return false;
+
+    PackHeader header;
+    std::memcpy(&header, BYTES.data(), sizeof(PackHeader));
+
+    if (header.magic != PACK_MAGIC || header.version != PACK_VERSION || header.fileSize != FILE_SIZE) return false;
+    if (header.bucketCount == 0 || !std::has_single_bit(header.bucketCount)) return false;
+
+    // The tables are read in place, their offsets must keep them aligned
+    if (header.directoryOffset % alignof(uint32_t) != 0 || header.entriesOffset % alignof(PackEntry) != 0) return false;
+
+    const uint64_t DIRECTORY_SIZE = (static_cast<uint64_t>(header.bucketCount) + 1) * sizeof(uint32_t);
+    const uint64_t ENTRIES_SIZE   = static_cast<uint64_t>(header.entryCount) * sizeof(PackEntry);
+
+    if (!sIsInRange(header.directoryOffset, DIRECTORY_SIZE, FILE_SIZE)) return false;
+    if (!sIsInRange(header.entriesOffset, ENTRIES_SIZE, FILE_SIZE)) return false;
+    if (!sIsInRange(header.namesOffset, header.namesSize, FILE_SIZE)) return false;
+
+    this->_bucketCount = header.bucketCount;
+    this->_directory   = {
+        reinterpret_cast<const uint32_t*>(BYTES.data() + header.directoryOffset), header.bucketCount + size_t {1}
+    };
+    this->_entries = {reinterpret_cast<const PackEntry*>(BYTES.data() + header.entriesOffset), header.entryCount};
+    this->_names   = {reinterpret_cast<const char*>(BYTES.data() + header.namesOffset), header.namesSize};
+
+    // Directory must be a monotonic split of the entry table
+    if (this->_directory.front() != 0 || this->_directory.back() != header.entryCount) return false;
+
+    for (uint32_t bucket = 0; bucket < header.bucketCount; bucket++)
+        if (this->_directory[bucket] > this->_directory[bucket + 1]) return false;
+
+    for (uint32_t bucket = 0; bucket < header.bucketCount; bucket++)
+    {
+        for (uint32_t index = this->_directory[bucket]; index < this->_directory[bucket + 1]; index++)
+        {
+            const PackEntry& entry = this->_entries[index];
+
+            if (GetPackBucket(entry.nameHash, header.bucketCount) != bucket) return false;
+            if (!sIsInRange(entry.offset, entry.storedSize, FILE_SIZE)) return false;
+            if (!sIsInRange(entry.nameOffset, entry.nameLength, header.namesSize)) return false;
+            if (entry.compression == PackCompression::None && entry.storedSize != entry.size) return false;
+        }
+    }
+
+    return true;
+}
+
+[[nodiscard]] const PackEntry* PackArchive::Find(std::string_view name) const noexcept
+{
+    if (this->_bucketCount == 0) return nullptr;
+
+    const uint64_t HASH   = HashPackName(name);
+    const uint32_t BUCKET = GetPackBucket(HASH, this->_bucketCount);
+
+    for (uint32_t index = this->_directory[BUCKET]; index < this->_directory[BUCKET + 1]; index++)
+    {
+        const PackEntry& entry = this->_entries[index];
+
+        if (entry.nameHash == HASH && this->GetName(entry) == name) return &entry;
+    }
+
+    return nullptr;
+}
+
+[[nodiscard]] std::string_view PackArchive::GetName(const PackEntry& entry) const noexcept
+{
+    return this->_names.substr(entry.nameOffset, entry.nameLength);
+}
+
+[[nodiscard]] std::span<const std::byte> PackArchive::GetStoredBytes(const PackEntry& entry) const noexcept
+{
+    return this->_file.GetBytes().subspan(entry.offset, entry.storedSize);
+}
+
+[[nodiscard]] bool PackArchive::Read(const PackEntry& entry, std::vector<std::byte>& destination) const
+{
+    // The size is only a claim until the blob is decoded, don't let it size the buffer past what the stored bytes can hold
+    if (entry.compression != PackCompression::None && !IsPackExpansionValid(entry.storedSize, entry.size)) return false;
+
+    destination.resize(entry.size);
+    return DecompressPackBlob(entry.compression, this->GetStoredBytes(entry), destination);
+}
+
+} // namespace dull::asset
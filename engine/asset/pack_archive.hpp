@@ -0,0 +1,59 @@
+#pragma once
+
+#include "engine/asset/pack_format.hpp"
+#include "engine/platform/mapped_file.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dull::asset {
+
+// ---
+// Read-only view of a memory mapped .pack archive (built by the dull_pack tool)
+// Note: lookups hash the name once and scan a single bucket, uncompressed entries come back as zero-copy spans
+// Note: immutable once open, safe to read from any thread
+// ---
+struct PackArchive final {
+private:
+    platform::MappedFile _file;
+    std::span<const uint32_t>  _directory;
+    std::span<const PackEntry> _entries;
+    std::string_view _names;
+    uint32_t _bucketCount = 0;
+
+    [[nodiscard]] bool _Validate() noexcept;
+
+public:
+    PackArchive(PackArchive&&)                 = delete;
+    PackArchive(const PackArchive&)            = delete;
+    PackArchive& operator=(PackArchive&&)      = delete;
+    PackArchive& operator=(const PackArchive&) = delete;
+
+    PackArchive() noexcept = default;
+
+    // Note: rejects archives with out of bounds tables or blobs
+    [[nodiscard]] bool Open(const std::string& path) noexcept;
+    void Close() noexcept;
+
+    [[nodiscard]] bool IsOpen() const noexcept { return this->_file.IsOpen(); }
+    [[nodiscard]] size_t GetEntryCount() const noexcept { return this->_entries.size(); }
+    [[nodiscard]] std::span<const PackEntry> GetEntries() const noexcept { return this->_entries; }
+
+    // Null when the name isn't packed
+    [[nodiscard]] const PackEntry* Find(std::string_view name) const noexcept;
+    [[nodiscard]] bool Contains(std::string_view name) const noexcept { return this->Find(name) != nullptr; }
+
+    [[nodiscard]] std::string_view GetName(const PackEntry& entry) const noexcept;
+
+    // Entry bytes as stored, the asset itself when the entry isn't compressed
+    [[nodiscard]] std::span<const std::byte> GetStoredBytes(const PackEntry& entry) const noexcept;
+
+    // Uncompressed bytes of an entry, copied or decompressed into destination
+    [[nodiscard]] bool Read(const PackEntry& entry, std::vector<std::byte>& destination) const;
+};
+
+} // namespace dull::asset
@@ -0,0 +1,139 @@
+#include "engine/asset/pack_compression.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#if defined(DULL_PACK_LZ4)
+    #include <lz4.h>
+    #include <lz4hc.h>
+#endif
+
+#if defined(DULL_PACK_ZSTD)
+    #include <zstd.h>
+#endif
+
+namespace dull::asset {
+
+// Packs are built offline, so the builder trades compression time for smaller blobs
+#if defined(DULL_PACK_ZSTD)
+static constexpr int ZSTD_PACK_LEVEL = 19;
+#endif
+
+[[nodiscard]] bool IsPackCompressionAvailable(PackCompression compression) noexcept
+{
+    switch (compression)
+    {
+        case PackCompression::None: return true;
+
+#if defined(DULL_PACK_LZ4)
+        case PackCompression::Lz4: return true;
+#endif
+
+#if defined(DULL_PACK_ZSTD)
+        case PackCompression::Zstd: return true;
+#endif
+
+        default: return false;
+    }
+}
+
+[[nodiscard]] bool CompressPackBlob(PackCompression compression, std::span<const std::byte> source, std::vector<std::byte>& destination)
+{
+    switch (compression)
+    {
+        case PackCompression::None:
+        {
+            destination.assign(source.begin(), source.end());
+            return true;
+        }
+
+#if defined(DULL_PACK_LZ4)
+        case PackCompression::Lz4:
+        {
+            if (source.size() > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) return false;
+
+            const int SOURCE_SIZE = static_cast<int>(source.size());
+            destination.resize(static_cast<size_t>(LZ4_compressBound(SOURCE_SIZE)));
+
+            const int STORED_SIZE = LZ4_compress_HC(
+                reinterpret_cast<const char*>(source.data()),
+                reinterpret_cast<char*>(destination.data()),
+                SOURCE_SIZE,
+                static_cast<int>(destination.size()),
+                LZ4HC_CLEVEL_MAX
+            );
+
+            if (STORED_SIZE <= 0) return false;
+
+            destination.resize(static_cast<size_t>(STORED_SIZE));
+            return true;
+        }
+#endif
+
+#if defined(DULL_PACK_ZSTD)
+        case PackCompression::Zstd:
+        {
+            destination.resize(ZSTD_compressBound(source.size()));
+
+            const size_t STORED_SIZE = ZSTD_compress(
+                destination.data(), destination.size(), source.data(), source.size(), ZSTD_PACK_LEVEL
+            );
+
+            if (ZSTD_isError(STORED_SIZE)) return false;
+
+            destination.resize(STORED_SIZE);
+            return true;
+        }
+#endif
+
+        default: return false;
+    }
+}
+
+[[nodiscard]] bool DecompressPackBlob(
+    PackCompression compression,
+    std::span<const std::byte> source,
+    std::span<std::byte> destination
+) noexcept
+{
+    switch (compression)
+    {
+        case PackCompression::None:
+        {
+            if (source.size() != destination.size()) return false;
+
+            std::copy(source.begin(), source.end(), destination.begin());
+            return true;
+        }
+
+#if defined(DULL_PACK_LZ4)
+        case PackCompression::Lz4:
+        {
+            constexpr size_t INT_MAX_SIZE = static_cast<size_t>(std::numeric_limits<int>::max());
+
+            if (source.size() > INT_MAX_SIZE || destination.size() > INT_MAX_SIZE) return false;
+
+            const int SIZE = LZ4_decompress_safe(
+                reinterpret_cast<const char*>(source.data()),
+                reinterpret_cast<char*>(destination.data()),
+                static_cast<int>(source.size()),
+                static_cast<int>(destination.size())
+            );
+
+            return SIZE >= 0 && static_cast<size_t>(SIZE) == destination.size();
+        }
+#endif
+
+#if defined(DULL_PACK_ZSTD)
+        case PackCompression::Zstd:
+        {
+            const size_t SIZE = ZSTD_decompress(destination.data(), destination.size(), source.data(), source.size());
+            return !ZSTD_isError(SIZE) && SIZE == destination.size();
+        }
+#endif
+
+        default: return false;
+    }
+}
+
+} // namespace dull::asset
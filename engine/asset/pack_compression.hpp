@@ -0,0 +1,28 @@
+#pragma once
+
+#include "engine/asset/pack_format.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace dull::asset {
+
+// ---
+// Block codecs for compressed pack entries
+// Note: LZ4 and zstd are linked in by the DULL_PACK_LZ4 / DULL_PACK_ZSTD build options, None is always available
+// ---
+
+[[nodiscard]] bool IsPackCompressionAvailable(PackCompression compression) noexcept;
+
+// Replaces destination with the compressed source, false when the codec is unavailable or fails
+[[nodiscard]] bool CompressPackBlob(PackCompression compression, std::span<const std::byte> source, std::vector<std::byte>& destination);
+
+// Note: destination must be exactly the uncompressed size
+[[nodiscard]] bool DecompressPackBlob(
+    PackCompression compression,
+    std::span<const std::byte> source,
+    std::span<std::byte> destination
+) noexcept;
+
+} // namespace dull::asset
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace dull::asset {
+
+// ---
+// On-disk layout of a .pack archive, shared by the runtime reader and the dull_pack builder
+// Note: header | bucket directory | entries sorted by name hash | names | blobs, all little endian
+// Note: bucket b holds the entries whose hash starts with b (top bits), so a lookup scans one short range
+// ---
+
+inline constexpr std::array<char, 8> PACK_MAGIC   = {'D', 'U', 'L', 'L', 'P', 'A', 'K', '1'};
+inline constexpr uint32_t            PACK_VERSION = 1;
+
+// Uncompressed blobs start on a page so a mapped archive hands them out as-is
+inline constexpr uint64_t PACK_BLOB_ALIGNMENT            = 4096;
+inline constexpr uint64_t PACK_COMPRESSED_BLOB_ALIGNMENT = 8;
+
+// Most bytes a compressed entry may unpack to per stored byte, LZ4 tops out near 255 and zstd stays far below this on real data
+// Note: bounds what a corrupt or hostile entry can make a read allocate, dull_pack stores anything past it uncompressed
+inline constexpr uint64_t PACK_MAX_EXPANSION = 1024;
+
+static_assert(std::endian::native == std::endian::little, "Pack archives are read in place on little endian hosts only");
+
+enum class PackCompression : uint8_t {
+    None = 0,
+    Lz4  = 1,
+    Zstd = 2,
+};
+
+struct PackHeader final {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t bucketCount; // power of two
+    uint32_t namesSize;
+    uint64_t directoryOffset; // bucketCount + 1 entry indices
+    uint64_t entriesOffset;
+    uint64_t namesOffset;
+    uint64_t fileSize;
+};
+
+struct PackEntry final {
+    uint64_t nameHash;
+    uint64_t offset;
+    uint64_t storedSize;
+    uint64_t size;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    PackCompression compression;
+    std::array<uint8_t, 7> padding;
+};
+
+static_assert(std::is_trivially_copyable_v<PackHeader> && sizeof(PackHeader) == 56);
+static_assert(std::is_trivially_copyable_v<PackEntry> && sizeof(PackEntry) == 48);
+
+// FNV-1a, names are '/' separated paths relative to the packed directory
+[[nodiscard]] constexpr uint64_t HashPackName(std::string_view name) noexcept
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    for (const char CHARACTER : name) hash = (hash ^ static_cast<uint8_t>(CHARACTER)) * 0x100000001B3ULL;
+
+    return hash;
+}
+
+[[nodiscard]] constexpr bool IsPackExpansionValid(uint64_t storedSize, uint64_t size) noexcept
+{
+    return size / PACK_MAX_EXPANSION <= storedSize;
+}
+
+[[nodiscard]] constexpr uint32_t GetPackBucket(uint64_t nameHash, uint32_t bucketCount) noexcept
+{
+    const int BUCKET_BITS = std::countr_zero(bucketCount);
+    return BUCKET_BITS == 0 ? 0 : static_cast<uint32_t>(nameHash >> (64 - BUCKET_BITS));
+}
+
+} // namespace dull::asset
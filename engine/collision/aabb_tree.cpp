@@ -0,0 +1,321 @@
+#include "engine/collision/aabb_tree.hpp"
+
+#include <algorithm>
+
+namespace dull::collision {
+
+[[nodiscard]] AabbTree::_Bounds AabbTree::_Union(const _Bounds& lhs, const _Bounds& rhs) noexcept
+{
+    return {
+        std::min(lhs.minX, rhs.minX),
+        std::min(lhs.minY, rhs.minY),
+        std::max(lhs.maxX, rhs.maxX),
+        std::max(lhs.maxY, rhs.maxY)
+    };
+}
+
+[[nodiscard]] AabbTree::_Bounds AabbTree::_ToBounds(const util::Rect& rect, float margin) noexcept
+{
+    return {rect.x - margin, rect.y - margin, rect.x + rect.w + margin, rect.y + rect.h + margin};
+}
+
+template <typename FnT>
+void AabbTree::_Traverse(const _Bounds& bounds, std::vector<int32_t>& stack, FnT&& fn) const
+{
+    if (this->_root == NIL_NODE) return;
+
+    stack.clear();
+    stack.push_back(this->_root);
+
+    while (!stack.empty())
+    {
+        const _Node& node = this->_nodes[stack.back()];
+        const int32_t NODE_INDEX = stack.back();
+        stack.pop_back();
+
+        if (!node.bounds.Overlaps(bounds)) continue;
+
+        if (node.IsLeaf())
+        {
+            fn(NODE_INDEX);
+            continue;
+        }
+
+        stack.push_back(node.child1);
+        stack.push_back(node.child2);
+    }
+}
+
+// --- Node pool ---
+
+[[nodiscard]] int32_t AabbTree::_AllocateNode()
+{
+    if (this->_freeList == NIL_NODE)
+    {
+        this->_nodes.emplace_back();
+        return static_cast<int32_t>(this->_nodes.size() - 1);
+    }
+
+    const int32_t NODE_INDEX = this->_freeList;
+    this->_freeList = this->_nodes[NODE_INDEX].parent;
+    this->_nodes[NODE_INDEX] = {};
+
+    return NODE_INDEX;
+}
+
+void AabbTree::_FreeNode(int32_t nodeIndex) noexcept
+{
+    _Node& node = this->_nodes[nodeIndex];
+
+    node.parent = this->_freeList;
+    node.height = -1;
+
+    this->_freeList = nodeIndex;
+}
+
+// --- Structure ---
+
+void AabbTree::_InsertLeaf(int32_t leafIndex)
+{
+    if (this->_root == NIL_NODE)
+    {
+        this->_root = leafIndex;
+        this->_nodes[leafIndex].parent = NIL_NODE;
+        return;
+    }
+
+    const _Bounds LEAF_BOUNDS = this->_nodes[leafIndex].bounds;
+
+    // Descend toward the sibling with the cheapest perimeter growth
+    int32_t sibling = this->_root;
+
+    while (!this->_nodes[sibling].IsLeaf())
+    {
+        const _Node& node = this->_nodes[sibling];
+
+        const float COMBINED_PERIMETER = AabbTree::_Union(node.bounds, LEAF_BOUNDS).Perimeter();
+        const float CREATE_COST        = 2.0F * COMBINED_PERIMETER;
+        const float INHERITANCE_COST   = 2.0F * (COMBINED_PERIMETER - node.bounds.Perimeter());
+
+        auto descendCost = [&](int32_t childIndex) {
+            const _Node& child = this->_nodes[childIndex];
+            const float UNION_PERIMETER = AabbTree::_Union(LEAF_BOUNDS, child.bounds).Perimeter();
+
+            return (child.IsLeaf() ? UNION_PERIMETER : UNION_PERIMETER - child.bounds.Perimeter()) + INHERITANCE_COST;
+        };
+
+        const float CHILD1_COST = descendCost(node.child1);
+        const float CHILD2_COST = descendCost(node.child2);
+
+        if (CREATE_COST < CHILD1_COST && CREATE_COST < CHILD2_COST) break;
+
+        sibling = CHILD1_COST < CHILD2_COST ? node.child1 : node.child2;
+    }
+
+    const int32_t OLD_PARENT = this->_nodes[sibling].parent;
+    const int32_t NEW_PARENT = this->_AllocateNode();
+
+    _Node& newParent = this->_nodes[NEW_PARENT];
+    newParent.parent = OLD_PARENT;
+    newParent.bounds = AabbTree::_Union(LEAF_BOUNDS, this->_nodes[sibling].bounds);
+    newParent.height = this->_nodes[sibling].height + 1;
+    newParent.child1 = sibling;
+    newParent.child2 = leafIndex;
+
+    this->_nodes[sibling].parent   = NEW_PARENT;
+    this->_nodes[leafIndex].parent = NEW_PARENT;
+
+    if (OLD_PARENT == NIL_NODE)
+    {
+        this->_root = NEW_PARENT;
+        return;
+    }
+
+    _Node& oldParent = this->_nodes[OLD_PARENT];
+    (oldParent.child1 == sibling ? oldParent.child1 : oldParent.child2) = NEW_PARENT;
+
+    this->_Refit(OLD_PARENT);
+}
+
+void AabbTree::_RemoveLeaf(int32_t leafIndex) noexcept
+{
+    if (leafIndex == this->_root)
+    {
+        this->_root = NIL_NODE;
+        return;
+    }
+
+    const int32_t PARENT      = this->_nodes[leafIndex].parent;
+    const int32_t GRANDPARENT = this->_nodes[PARENT].parent;
+    const int32_t SIBLING     = this->_nodes[PARENT].child1 == leafIndex ? this->_nodes[PARENT].child2 : this->_nodes[PARENT].child1;
+
+    this->_nodes[SIBLING].parent = GRANDPARENT;
+    this->_FreeNode(PARENT);
+
+    if (GRANDPARENT == NIL_NODE)
+    {
+        this->_root = SIBLING;
+        return;
+    }
+
+    _Node& grandparent = this->_nodes[GRANDPARENT];
+    (grandparent.child1 == PARENT ? grandparent.child1 : grandparent.child2) = SIBLING;
+
+    this->_Refit(GRANDPARENT);
+}
+
+void AabbTree::_Refit(int32_t nodeIndex) noexcept
+{
+    while (nodeIndex != NIL_NODE)
+    {
+        nodeIndex = this->_Balance(nodeIndex);
+
+        _Node& node = this->_nodes[nodeIndex];
+        const _Node& child1 = this->_nodes[node.child1];
+        const _Node& child2 = this->_nodes[node.child2];
+
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.bounds = AabbTree::_Union(child1.bounds, child2.bounds);
+
+        nodeIndex = node.parent;
+    }
+}
+
+// Rotates the taller grandchild up when the subtree heights differ by more than one
+[[nodiscard]] int32_t AabbTree::_Balance(int32_t nodeIndex) noexcept
+{
+    _Node& nodeA = this->_nodes[nodeIndex];
+    if (nodeA.IsLeaf() || nodeA.height < 2) return nodeIndex;
+
+    const int32_t INDEX_B = nodeA.child1;
+    const int32_t INDEX_C = nodeA.child2;
+    _Node& nodeB = this->_nodes[INDEX_B];
+    _Node& nodeC = this->_nodes[INDEX_C];
+
+    const int32_t BALANCE = nodeC.height - nodeB.height;
+    if (BALANCE >= -1 && BALANCE <= 1) return nodeIndex;
+
+    // Promote the taller child (up) and hand one of its children to A (down)
+    const bool    IS_C_TALLER = BALANCE > 1;
+    const int32_t UP_INDEX    = IS_C_TALLER ? INDEX_C : INDEX_B;
+    const int32_t KEEP_INDEX  = IS_C_TALLER ? INDEX_B : INDEX_C;
+
+    _Node& up   = this->_nodes[UP_INDEX];
+    _Node& keep = this->_nodes[KEEP_INDEX];
+
+    const int32_t INDEX_F = up.child1;
+    const int32_t INDEX_G = up.child2;
+    _Node& nodeF = this->_nodes[INDEX_F];
+    _Node& nodeG = this->_nodes[INDEX_G];
+
+    up.child1   = nodeIndex;
+    up.parent   = nodeA.parent;
+    nodeA.parent = UP_INDEX;
+
+    if (up.parent == NIL_NODE) this->_root = UP_INDEX;
+    else
+    {
+        _Node& parent = this->_nodes[up.parent];
+        (parent.child1 == nodeIndex ? parent.child1 : parent.child2) = UP_INDEX;
+    }
+
+    const bool    IS_F_TALLER = nodeF.height > nodeG.height;
+    const int32_t STAY_INDEX  = IS_F_TALLER ? INDEX_F : INDEX_G;
+    const int32_t MOVE_INDEX  = IS_F_TALLER ? INDEX_G : INDEX_F;
+    _Node& stay = this->_nodes[STAY_INDEX];
+    _Node& move = this->_nodes[MOVE_INDEX];
+
+    up.child2   = STAY_INDEX;
+    move.parent = nodeIndex;
+    (IS_C_TALLER ? nodeA.child2 : nodeA.child1) = MOVE_INDEX;
+
+    nodeA.bounds = AabbTree::_Union(keep.bounds, move.bounds);
+    nodeA.height = 1 + std::max(keep.height, move.height);
+    up.bounds    = AabbTree::_Union(nodeA.bounds, stay.bounds);
+    up.height    = 1 + std::max(nodeA.height, stay.height);
+
+    return UP_INDEX;
+}
+
+// --- Proxies ---
+
+[[nodiscard]] ProxyId AabbTree::Insert(const util::Rect& rect)
+{
+    const int32_t LEAF_INDEX = this->_AllocateNode();
+
+    _Node& leaf = this->_nodes[LEAF_INDEX];
+    leaf.rect   = rect;
+    leaf.bounds = AabbTree::_ToBounds(rect, this->_margin);
+    leaf.height = 0;
+
+    this->_InsertLeaf(LEAF_INDEX);
+    this->_proxyCount++;
+
+    return static_cast<ProxyId>(LEAF_INDEX);
+}
+
+void AabbTree::Move(ProxyId proxyId, const util::Rect& rect)
+{
+    const int32_t LEAF_INDEX = static_cast<int32_t>(proxyId);
+    _Node& leaf = this->_nodes[LEAF_INDEX];
+
+    leaf.rect = rect;
+    if (leaf.bounds.Contains(AabbTree::_ToBounds(rect, 0.0F))) return;
+
+    this->_RemoveLeaf(LEAF_INDEX);
+    this->_nodes[LEAF_INDEX].bounds = AabbTree::_ToBounds(rect, this->_margin);
+    this->_InsertLeaf(LEAF_INDEX);
+}
+
+void AabbTree::Remove(ProxyId proxyId) noexcept
+{
+    const int32_t LEAF_INDEX = static_cast<int32_t>(proxyId);
+    if (this->_nodes[LEAF_INDEX].height != 0) return;
+
+    this->_RemoveLeaf(LEAF_INDEX);
+    this->_FreeNode(LEAF_INDEX);
+    this->_proxyCount--;
+}
+
+// --- Queries ---
+
+void AabbTree::QueryRegion(const util::Rect& region, std::vector<ProxyId>& results)
+{
+    this->_Traverse(AabbTree::_ToBounds(region, 0.0F), this->_stack, [&](int32_t leafIndex) {
+        if (this->_nodes[leafIndex].rect.CollidesWith(region)) results.push_back(static_cast<ProxyId>(leafIndex));
+    });
+}
+
+void AabbTree::QueryPoint(const util::Vec2f& point, std::vector<ProxyId>& results)
+{
+    this->_Traverse({point.x, point.y, point.x, point.y}, this->_stack, [&](int32_t leafIndex) {
+        if (this->_nodes[leafIndex].rect.CollidesWith(point)) results.push_back(static_cast<ProxyId>(leafIndex));
+    });
+}
+
+void AabbTree::QueryPairs(std::vector<ProxyPair>& pairs, job::ThreadPool* threadPool) const
+{
+    std::vector<int32_t> leaves;
+    leaves.reserve(this->_proxyCount);
+
+    for (int32_t nodeIndex = 0; nodeIndex < static_cast<int32_t>(this->_nodes.size()); nodeIndex++)
+        if (this->_nodes[nodeIndex].height == 0) leaves.push_back(nodeIndex);
+
+    _CollectPairsParallel(leaves.size(), threadPool, pairs, [this, &leaves](size_t begin, size_t end, std::vector<ProxyPair>& chunkPairs) {
+        std::vector<int32_t> stack;
+
+        for (size_t leaf = begin; leaf < end; leaf++)
+        {
+            const int32_t LEAF_INDEX = leaves[leaf];
+            const _Node& leafNode    = this->_nodes[LEAF_INDEX];
+
+            // Each pair is reported once, by its smaller id
+            this->_Traverse(leafNode.bounds, stack, [&](int32_t otherIndex) {
+                if (otherIndex <= LEAF_INDEX || !leafNode.rect.CollidesWith(this->_nodes[otherIndex].rect)) return;
+                chunkPairs.push_back({static_cast<ProxyId>(LEAF_INDEX), static_cast<ProxyId>(otherIndex)});
+            });
+        }
+    });
+}
+
+} // namespace dull::collision
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "engine/collision/broad_phase.hpp"
+#include "engine/util/rect.hpp"
+#include "engine/util/vec2.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// Forward Declaration
+namespace dull::job { struct ThreadPool; }
+
+namespace dull::collision {
+
+// ---
+// Dynamic bounding volume hierarchy over fattened rects
+// Note: leaves are enlarged by a margin so small moves do not touch the tree
+// Note: handles colliders of mixed sizes and sparse worlds better than a grid
+// ---
+struct AabbTree final {
+private:
+    static constexpr int32_t NIL_NODE = -1;
+
+    struct _Bounds {
+        float minX = 0.0F;
+        float minY = 0.0F;
+        float maxX = 0.0F;
+        float maxY = 0.0F;
+
+        [[nodiscard]] constexpr float Perimeter() const noexcept { return 2.0F * ((this->maxX - this->minX) + (this->maxY - this->minY)); }
+
+        [[nodiscard]] constexpr bool Contains(const _Bounds& other) const noexcept
+        {
+            return this->minX <= other.minX && this->minY <= other.minY && other.maxX <= this->maxX && other.maxY <= this->maxY;
+        }
+
+        [[nodiscard]] constexpr bool Overlaps(const _Bounds& other) const noexcept
+        {
+            return this->minX <= other.maxX && other.minX <= this->maxX && this->minY <= other.maxY && other.minY <= this->maxY;
+        }
+    };
+
+    struct _Node {
+        _Bounds    bounds;
+        util::Rect rect;             // tight rect, leaves only
+        int32_t    parent = NIL_NODE; // doubles as the free list link
+        int32_t    child1 = NIL_NODE;
+        int32_t    child2 = NIL_NODE;
+        int32_t    height = -1;       // -1 marks a free node
+
+        [[nodiscard]] constexpr bool IsLeaf() const noexcept { return this->child1 == NIL_NODE; }
+    };
+
+    std::vector<_Node> _nodes;
+    std::vector<int32_t> _stack;
+    int32_t _root     = NIL_NODE;
+    int32_t _freeList = NIL_NODE;
+    float   _margin   = 4.0F;
+    size_t  _proxyCount = 0;
+
+    [[nodiscard]] static _Bounds _Union(const _Bounds& lhs, const _Bounds& rhs) noexcept;
+    [[nodiscard]] static _Bounds _ToBounds(const util::Rect& rect, float margin) noexcept;
+
+    [[nodiscard]] int32_t _AllocateNode();
+    void _FreeNode(int32_t nodeIndex) noexcept;
+
+    void _InsertLeaf(int32_t leafIndex);
+    void _RemoveLeaf(int32_t leafIndex) noexcept;
+    [[nodiscard]] int32_t _Balance(int32_t nodeIndex) noexcept;
+    void _Refit(int32_t nodeIndex) noexcept;
+
+    template <typename FnT>
+    void _Traverse(const _Bounds& bounds, std::vector<int32_t>& stack, FnT&& fn) const;
+
+public:
+    explicit AabbTree(float margin = 4.0F) noexcept : _margin {margin} {}
+
+    [[nodiscard]] ProxyId Insert(const util::Rect& rect);
+    void Move(ProxyId proxyId, const util::Rect& rect);
+    void Remove(ProxyId proxyId) noexcept;
+
+    [[nodiscard]] const util::Rect& GetRect(ProxyId proxyId) const noexcept { return this->_nodes[proxyId].rect; }
+    [[nodiscard]] size_t GetProxyCount() const noexcept { return this->_proxyCount; }
+    [[nodiscard]] int32_t GetHeight() const noexcept { return this->_root == NIL_NODE ? 0 : this->_nodes[this->_root].height; }
+
+    // Appends every collider overlapping the region / containing the point
+    void QueryRegion(const util::Rect& region, std::vector<ProxyId>& results);
+    void QueryPoint(const util::Vec2f& point, std::vector<ProxyId>& results);
+
+    // Replaces pairs with every overlapping collider pair, leaves are split across the pool when given
+    void QueryPairs(std::vector<ProxyPair>& pairs, job::ThreadPool* threadPool = nullptr) const;
+};
+
+} // namespace dull::collision
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "engine/job/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace dull::collision {
+
+// Handle to a collider registered in a broad phase structure
+using ProxyId = uint32_t;
+
+inline constexpr ProxyId NULL_PROXY = std::numeric_limits<ProxyId>::max();
+
+// ---
+// Two colliders whose rects overlap
+// Note: first is always the smaller id
+// ---
+struct ProxyPair final {
+    ProxyId first  = NULL_PROXY;
+    ProxyId second = NULL_PROXY;
+
+    constexpr bool operator == (const ProxyPair& other) const noexcept = default;
+    constexpr bool operator != (const ProxyPair& other) const noexcept = default;
+};
+
+// Runs collect(begin, end, pairs) over [0, count) in chunks spread across the pool, then concatenates
+template <typename CollectT>
+void _CollectPairsParallel(size_t count, job::ThreadPool* threadPool, std::vector<ProxyPair>& pairs, CollectT&& collect)
+{
+    pairs.clear();
+
+    const size_t CHUNK_COUNT = threadPool == nullptr ? 1 : std::min<size_t>(count, (threadPool->GetThreadCount() + 1) * 4);
+
+    if (CHUNK_COUNT <= 1)
+    {
+        collect(size_t {0}, count, pairs);
+        return;
+    }
+
+    std::vector<std::vector<ProxyPair>> chunkPairs(CHUNK_COUNT);
+    std::atomic<uint32_t> pendingCount {static_cast<uint32_t>(CHUNK_COUNT)};
+
+    for (size_t chunk = 0; chunk < CHUNK_COUNT; chunk++)
+    {
+        threadPool->Submit([&, chunk] {
+            collect(count * chunk / CHUNK_COUNT, count * (chunk + 1) / CHUNK_COUNT, chunkPairs[chunk]);
+            pendingCount.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    threadPool->Wait(pendingCount);
+
+    for (const std::vector<ProxyPair>& chunk : chunkPairs) pairs.insert(pairs.end(), chunk.begin(), chunk.end());
+}
+
+} // namespace dull::collision
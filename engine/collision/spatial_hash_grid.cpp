@@ -0,0 +1,186 @@
+#include "engine/collision/spatial_hash_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace dull::collision {
+
+[[nodiscard]] SpatialHashGrid::_CellRange SpatialHashGrid::_GetCellRange(const util::Rect& rect) const noexcept
+{
+    return {
+        static_cast<int32_t>(std::floor(rect.x / this->_cellSize)),
+        static_cast<int32_t>(std::floor(rect.y / this->_cellSize)),
+        static_cast<int32_t>(std::floor((rect.x + rect.w) / this->_cellSize)),
+        static_cast<int32_t>(std::floor((rect.y + rect.h) / this->_cellSize))
+    };
+}
+
+void SpatialHashGrid::_AddToCells(ProxyId proxyId, const _CellRange& cells)
+{
+    for (int32_t cellY = cells.minY; cellY <= cells.maxY; cellY++)
+        for (int32_t cellX = cells.minX; cellX <= cells.maxX; cellX++)
+            this->_cells[SpatialHashGrid::_CellKey(cellX, cellY)].push_back(proxyId);
+}
+
+void SpatialHashGrid::_RemoveFromCells(ProxyId proxyId, const _CellRange& cells) noexcept
+{
+    for (int32_t cellY = cells.minY; cellY <= cells.maxY; cellY++)
+    {
+        for (int32_t cellX = cells.minX; cellX <= cells.maxX; cellX++)
+        {
+            auto cell = this->_cells.find(SpatialHashGrid::_CellKey(cellX, cellY));
+            if (cell == this->_cells.end()) continue;
+
+            std::vector<ProxyId>& bucket = cell->second;
+            auto entry = std::ranges::find(bucket, proxyId);
+
+            if (entry == bucket.end()) continue;
+
+            *entry = bucket.back();
+            bucket.pop_back();
+
+            // Keep emptied buckets allocated, colliders tend to come back to the same cells
+        }
+    }
+}
+
+[[nodiscard]] ProxyId SpatialHashGrid::Insert(const util::Rect& rect)
+{
+    ProxyId proxyId = NULL_PROXY;
+
+    if (this->_freeProxies.empty())
+    {
+        proxyId = static_cast<ProxyId>(this->_proxies.size());
+        this->_proxies.emplace_back();
+        this->_queryStamps.push_back(0);
+    }
+    else
+    {
+        proxyId = this->_freeProxies.back();
+        this->_freeProxies.pop_back();
+    }
+
+    _Proxy& proxy = this->_proxies[proxyId];
+    proxy.rect    = rect;
+    proxy.cells   = this->_GetCellRange(rect);
+    proxy.isAlive = true;
+
+    this->_AddToCells(proxyId, proxy.cells);
+    this->_proxyCount++;
+
+    return proxyId;
+}
+
+void SpatialHashGrid::Move(ProxyId proxyId, const util::Rect& rect)
+{
+    _Proxy& proxy = this->_proxies[proxyId];
+    const _CellRange NEW_CELLS = this->_GetCellRange(rect);
+
+    proxy.rect = rect;
+    if (NEW_CELLS == proxy.cells) return;
+
+    this->_RemoveFromCells(proxyId, proxy.cells);
+    this->_AddToCells(proxyId, NEW_CELLS);
+
+    proxy.cells = NEW_CELLS;
+}
+
+void SpatialHashGrid::Remove(ProxyId proxyId) noexcept
+{
+    _Proxy& proxy = this->_proxies[proxyId];
+    if (!proxy.isAlive) return;
+
+    this->_RemoveFromCells(proxyId, proxy.cells);
+    proxy.isAlive = false;
+
+    this->_freeProxies.push_back(proxyId);
+    this->_proxyCount--;
+}
+
+void SpatialHashGrid::QueryRegion(const util::Rect& region, std::vector<ProxyId>& results)
+{
+    const _CellRange CELLS = this->_GetCellRange(region);
+
+    // Stamps dedupe colliders spanning several cells without a set
+    if (++this->_queryStamp == 0)
+    {
+        std::ranges::fill(this->_queryStamps, 0);
+        this->_queryStamp = 1;
+    }
+
+    for (int32_t cellY = CELLS.minY; cellY <= CELLS.maxY; cellY++)
+    {
+        for (int32_t cellX = CELLS.minX; cellX <= CELLS.maxX; cellX++)
+        {
+            auto cell = this->_cells.find(SpatialHashGrid::_CellKey(cellX, cellY));
+            if (cell == this->_cells.end()) continue;
+
+            for (ProxyId proxyId : cell->second)
+            {
+                if (this->_queryStamps[proxyId] == this->_queryStamp) continue;
+                this->_queryStamps[proxyId] = this->_queryStamp;
+
+                if (this->_proxies[proxyId].rect.CollidesWith(region)) results.push_back(proxyId);
+            }
+        }
+    }
+}
+
+void SpatialHashGrid::QueryPoint(const util::Vec2f& point, std::vector<ProxyId>& results) const
+{
+    auto cell = this->_cells.find(SpatialHashGrid::_CellKey(
+        static_cast<int32_t>(std::floor(point.x / this->_cellSize)),
+        static_cast<int32_t>(std::floor(point.y / this->_cellSize))
+    ));
+
+    if (cell == this->_cells.end()) return;
+
+    for (ProxyId proxyId : cell->second)
+        if (this->_proxies[proxyId].rect.CollidesWith(point)) results.push_back(proxyId);
+}
+
+void SpatialHashGrid::_CollectPairs(const std::vector<ProxyId>& bucket, int32_t cellX, int32_t cellY, std::vector<ProxyPair>& pairs) const
+{
+    for (size_t first = 0; first < bucket.size(); first++)
+    {
+        const _Proxy& firstProxy = this->_proxies[bucket[first]];
+
+        for (size_t second = first + 1; second < bucket.size(); second++)
+        {
+            const _Proxy& secondProxy = this->_proxies[bucket[second]];
+
+            // A pair sharing several cells is only reported by the top left shared cell
+            if (std::max(firstProxy.cells.minX, secondProxy.cells.minX) != cellX) continue;
+            if (std::max(firstProxy.cells.minY, secondProxy.cells.minY) != cellY) continue;
+
+            if (!firstProxy.rect.CollidesWith(secondProxy.rect)) continue;
+
+            pairs.push_back({std::min(bucket[first], bucket[second]), std::max(bucket[first], bucket[second])});
+        }
+    }
+}
+
+void SpatialHashGrid::QueryPairs(std::vector<ProxyPair>& pairs, job::ThreadPool* threadPool) const
+{
+    std::vector<std::pair<uint64_t, const std::vector<ProxyId>*>> buckets;
+    buckets.reserve(this->_cells.size());
+
+    for (const auto& [cellKey, bucket] : this->_cells)
+        if (bucket.size() > 1) buckets.emplace_back(cellKey, &bucket);
+
+    _CollectPairsParallel(buckets.size(), threadPool, pairs, [this, &buckets](size_t begin, size_t end, std::vector<ProxyPair>& chunkPairs) {
+        for (size_t bucket = begin; bucket < end; bucket++)
+        {
+            const uint64_t CELL_KEY = buckets[bucket].first;
+
+            this->_CollectPairs(
+                *buckets[bucket].second,
+                static_cast<int32_t>(static_cast<uint32_t>(CELL_KEY >> 32)),
+                static_cast<int32_t>(static_cast<uint32_t>(CELL_KEY)),
+                chunkPairs
+            );
+        }
+    });
+}
+
+} // namespace dull::collision
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "engine/collision/broad_phase.hpp"
+#include "engine/util/rect.hpp"
+#include "engine/util/vec2.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Forward Declaration
+namespace dull::job { struct ThreadPool; }
+
+namespace dull::collision {
+
+// ---
+// Uniform grid of buckets keyed by cell coordinate
+// Note: best when colliders have similar sizes close to the cell size
+// ---
+struct SpatialHashGrid final {
+private:
+    struct _CellRange {
+        int32_t minX = 0;
+        int32_t minY = 0;
+        int32_t maxX = -1;
+        int32_t maxY = -1;
+
+        constexpr bool operator == (const _CellRange& other) const noexcept = default;
+    };
+
+    struct _Proxy {
+        util::Rect rect;
+        _CellRange cells;
+        bool       isAlive = false;
+    };
+
+    float _cellSize = 64.0F;
+    std::unordered_map<uint64_t, std::vector<ProxyId>> _cells;
+    std::vector<_Proxy> _proxies;
+    std::vector<ProxyId> _freeProxies;
+    std::vector<uint32_t> _queryStamps;
+    uint32_t _queryStamp = 0;
+    size_t _proxyCount = 0;
+
+    [[nodiscard]] static constexpr uint64_t _CellKey(int32_t cellX, int32_t cellY) noexcept
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+    }
+
+    [[nodiscard]] _CellRange _GetCellRange(const util::Rect& rect) const noexcept;
+
+    void _AddToCells(ProxyId proxyId, const _CellRange& cells);
+    void _RemoveFromCells(ProxyId proxyId, const _CellRange& cells) noexcept;
+
+    void _CollectPairs(const std::vector<ProxyId>& bucket, int32_t cellX, int32_t cellY, std::vector<ProxyPair>& pairs) const;
+
+public:
+    explicit SpatialHashGrid(float cellSize = 64.0F) noexcept : _cellSize {cellSize} {}
+
+    [[nodiscard]] ProxyId Insert(const util::Rect& rect);
+    void Move(ProxyId proxyId, const util::Rect& rect);
+    void Remove(ProxyId proxyId) noexcept;
+
+    [[nodiscard]] const util::Rect& GetRect(ProxyId proxyId) const noexcept { return this->_proxies[proxyId].rect; }
+    [[nodiscard]] size_t GetProxyCount() const noexcept { return this->_proxyCount; }
+    [[nodiscard]] float GetCellSize() const noexcept { return this->_cellSize; }
+
+    // Appends every collider overlapping the region / containing the point, each once
+    void QueryRegion(const util::Rect& region, std::vector<ProxyId>& results);
+    void QueryPoint(const util::Vec2f& point, std::vector<ProxyId>& results) const;
+
+    // Replaces pairs with every overlapping collider pair, cells are split across the pool when given
+    void QueryPairs(std::vector<ProxyPair>& pairs, job::ThreadPool* threadPool = nullptr) const;
+};
+
+} // namespace dull::collision
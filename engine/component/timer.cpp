@@ -1,39 +1,75 @@
 #include "engine/component/timer.hpp"
+#include "engine/core/app.hpp"
 
-#include <vendor/raylib.h>
+#include <utility>
 
 namespace dull::component {
 
+[[nodiscard]] static system::TimerSystem& sGetTimerSystem() noexcept
+{
+    return core::App::GetInstance().GetTimerSystem();
+}
+
 Timer::Timer(double measureTime, bool isLooping) noexcept
     : _measureTime {measureTime}, _isLooping {isLooping}
 {}
 
-void Timer::Start() noexcept
+Timer::~Timer() noexcept
 {
-    this->_isActive    = true;
-    this->_startedTime = rl::GetTime();
+    if (!this->_timerId.IsNull() && core::App::HasInstance()) sGetTimerSystem()._Release(this->_timerId);
 }
 
-void Timer::Stop() noexcept { this->_isActive = false; }
+Timer::Timer(Timer&& other) noexcept
+    : _timerId     {std::exchange(other._timerId, {})}
+    , _measureTime {other._measureTime}
+    , _isLooping   {other._isLooping}
+{}
+
+Timer& Timer::operator=(Timer&& other) noexcept
+{
+    if (this == &other) return *this;
+
+    if (!this->_timerId.IsNull() && core::App::HasInstance()) sGetTimerSystem()._Release(this->_timerId);
+
+    this->_timerId     = std::exchange(other._timerId, {});
+    this->_measureTime = other._measureTime;
+    this->_isLooping   = other._isLooping;
+
+    return *this;
+}
+
+void Timer::Start(double elapsed)
+{
+    system::TimerSystem& timerSystem = sGetTimerSystem();
+
+    if (this->_timerId.IsNull()) this->_timerId = timerSystem._Acquire();
+    timerSystem._Start(this->_timerId, this->_measureTime, this->_isLooping, elapsed);
+}
+
+void Timer::Stop() noexcept
+{
+    if (this->_timerId.IsNull()) return;
+    sGetTimerSystem().Cancel(this->_timerId);
+}
 
 [[nodiscard]] double Timer::GetElapsed() const noexcept
 {
-    return this->IsActive() ? rl::GetTime() - this->_startedTime : 0.0;
+    return this->IsActive() ? this->_measureTime - sGetTimerSystem().GetRemaining(this->_timerId) : 0.0;
 }
 
-[[nodiscard]] bool Timer::IsOver() noexcept
+[[nodiscard]] bool Timer::IsActive() const noexcept
 {
-    if (!this->IsActive()) return true;
+    return !this->_timerId.IsNull() && sGetTimerSystem().IsScheduled(this->_timerId);
+}
 
-    double elapsedTime = rl::GetTime() - this->_startedTime;
+[[nodiscard]] bool Timer::IsOver() noexcept
+{
+    if (this->_timerId.IsNull()) return true;
 
-    if (elapsedTime > this->_measureTime)
-    {
-        this->IsLooping() ? this->Start() : this->Stop();
-        return true;
-    }
+    system::TimerSystem& timerSystem = sGetTimerSystem();
 
-    return false;
+    // A fired one shot is no longer scheduled, report its expiry once then stay over
+    return timerSystem._ConsumeFire(this->_timerId) || !timerSystem.IsScheduled(this->_timerId);
 }
 
 void Timer::SetLooping(bool isLooping) noexcept
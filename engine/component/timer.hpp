@@ -1,25 +1,40 @@
 #pragma once
 
+#include "engine/system/timer_system.hpp"
+
 namespace dull::component {
 
+// ---
+// Handle to a timer driven by the App TimerSystem
+// Note: requires a live App, the timer slot is released with the handle
+// ---
 struct Timer {
 private:
+    system::TimerId _timerId;
     double _measureTime = 1.0;
-    double _startedTime = 0.0;
-    bool   _isActive    = false;
     bool   _isLooping   = false;
 
 public:
     explicit Timer(double measureTime, bool isLooping = false) noexcept;
+    ~Timer() noexcept;
+
+    Timer(Timer&& other) noexcept;
+    Timer& operator=(Timer&& other) noexcept;
+
+    Timer(const Timer&)            = delete;
+    Timer& operator=(const Timer&) = delete;
 
-    void Start() noexcept;
+    // Note: elapsed restarts the timer part way through, used to restore saved timers
+    void Start(double elapsed = 0.0);
     void Stop() noexcept;
 
     [[nodiscard]] double GetElapsed() const noexcept;
+    [[nodiscard]] double GetMeasureTime() const noexcept { return this->_measureTime; }
 
-    [[nodiscard]] bool IsActive () const noexcept { return this->_isActive;  }
+    [[nodiscard]] bool IsActive () const noexcept;
     [[nodiscard]] bool IsLooping() const noexcept { return this->_isLooping; }
 
+    // True once per expiry since the last call, always true while inactive
     [[nodiscard]] bool IsOver() noexcept;
 
     void SetLooping(bool isLooping) noexcept;
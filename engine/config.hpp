@@ -2,7 +2,9 @@
 
 #include <vendor/zutil/zutil.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <string_view>
 
 namespace dull::config {
 
@@ -10,4 +12,28 @@ inline const zutil::ProString DULL_TAG = {"[DULL]", zutil::ANSI::EX_Black};
 
 inline constexpr uint32_t TICKS_PER_SECOND = 60;
 
+// Upper bound of fixed ticks processed in a single frame
+inline constexpr uint32_t MAX_FIXED_TICKS_PER_FRAME = 8;
+
+// Longest frame time (in seconds) fed into the fixed tick scheduler
+inline constexpr double MAX_FRAME_TIME = 0.25;
+
+// Named input actions the InputSystem can hold, each one is a bit in the per-frame action state
+inline constexpr uint32_t MAX_INPUT_ACTIONS = 128;
+
+// Worker threads of the App thread pool, 0 picks one per hardware thread besides the main thread
+inline constexpr uint32_t WORKER_THREAD_COUNT = 0;
+
+// Decoded bytes the asset cache keeps before evicting unreferenced assets
+inline constexpr size_t ASSET_CACHE_BUDGET = 256 * 1024 * 1024;
+
+// Background threads reading and decoding assets, kept apart from the worker pool since they block on I/O
+inline constexpr uint32_t ASSET_WORKER_COUNT = 2;
+
+// Pack archive App mounts at startup when present, relative to the working directory
+inline constexpr std::string_view DEFAULT_PACK_PATH = "assets.pack";
+
+// Starting size (in bytes) of each half of the App frame arena, it grows after a frame overflows it
+inline constexpr size_t FRAME_ARENA_SIZE = 1024 * 1024;
+
 } // namespace dull::config
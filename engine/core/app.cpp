@@ -1,20 +1,49 @@
 #include "engine/config.hpp"
 #include "engine/core/app.hpp"
+#include "engine/core/app_frame.hpp"
+#include "engine/log/async_log.hpp"
+#include "engine/platform/headless_backend.hpp"
+#if !defined(DULL_NO_RAYLIB)
+    #include "engine/platform/raylib_backend.hpp"
+#endif
+#include "engine/profile/profiler.hpp"
 #include "engine/util/vec2.hpp"
 
-#include <vendor/raylib.h>
-
+#include <cstdint>
+#include <filesystem>
 #include <format>
+#include <memory>
 #include <string>
+#include <system_error>
+#include <utility>
 
 namespace dull::core {
 
 static inline App* sInstance = nullptr;
 static process::_VoidProcessor sVoidProcessor {};
 
+[[nodiscard]] static std::unique_ptr<platform::IBackend> sMakeBackend(const WindowContext& windowContext)
+{
+    if (!windowContext.replayPath.empty()) return std::make_unique<platform::HeadlessBackend>();
+
+    switch (windowContext.backend)
+    {
+    case platform::BackendType::Headless: return std::make_unique<platform::HeadlessBackend>();
+    case platform::BackendType::Window  : break;
+    }
+
+#if defined(DULL_NO_RAYLIB)
+    zutil::Assert(false, "Built without raylib (DULL_WITH_RAYLIB=OFF), only the headless backend is available");
+    return std::make_unique<platform::HeadlessBackend>();
+#else
+    return std::make_unique<platform::RaylibBackend>();
+#endif
+}
+
 App::App(
     const WindowContext& windowContext,
-    process::IProcessor* processorPtr
+    process::IProcessor* processorPtr,
+    std::unique_ptr<platform::IBackend> backend
 )
 : zutil::Logger {
     {
@@ -22,53 +51,79 @@ App::App(
         {"[APP]", zutil::ANSI::EX_Black}
     }
 }
+, _backend {backend != nullptr ? std::move(backend) : sMakeBackend(windowContext)}
+, _frameArena {windowContext.frameArenaSize}
 , _processor {processorPtr == nullptr ? sVoidProcessor : *processorPtr}
 {
     zutil::Assert(sInstance == nullptr, "App can only be created once");
 
     sInstance = this;
 
-    int configFlags = {
-        (windowContext.isVsyncEnabled ? rl::FLAG_VSYNC_HINT       : 0) |
-        (windowContext.isResizeable   ? rl::FLAG_WINDOW_RESIZABLE : 0)
-    };
+    this->_timeSystem._SetTickRate(windowContext.ticksPerSecond);
+
+    if (windowContext.isPipelined) this->_renderPipeline._Start(*this->_backend, windowContext);
+    else                           this->_backend->IOpen(windowContext);
+
+    this->_replaySystem._Open(
+        windowContext,
+        windowContext.clockPtr == nullptr ? this->_backend->IGetClock() : *windowContext.clockPtr
+    );
+    this->_timeSystem._SetClock(this->_replaySystem._GetClock());
 
-    rl::SetConfigFlags(configFlags);
-    rl::InitWindow(windowContext.dimension.x, windowContext.dimension.y, windowContext.title.c_str());
-    rl::SetExitKey(rl::KEY_NULL);
+    double openTime = this->_timeSystem.GetTime();
+    this->_replaySystem._SyncTime(openTime);
+    this->_timerSystem._Reset(openTime);
 
     this->Log(zutil::INFO, {"'{}' Opening", windowContext.title});
+
+    if (this->_pack.Open(windowContext.packPath))
+    {
+        this->_assetManager.Mount(this->_pack);
+        this->Log(zutil::INFO, {"Mounted '{}' ({} entries)", windowContext.packPath, this->_pack.GetEntryCount()});
+    }
+    else if (std::error_code error; std::filesystem::exists(windowContext.packPath, error))
+    {
+        this->Log(zutil::INFO, {"'{}' is not a valid pack, loading loose files", windowContext.packPath});
+    }
 }
 
 App::~App() noexcept
 {
-    this->_processor.IShutdown();
+    {
+        DULL_PROFILE_ZONE("IProcessor::IShutdown");
+        this->_processor.IShutdown();
+    }
+
     this->Log(zutil::INFO, "Closing\n\n");
-    rl::CloseWindow();
-}
 
-[[nodiscard]] App& App::GetInstance() noexcept { return *sInstance; }
+    if (this->_renderPipeline.IsActive()) this->_renderPipeline._Stop();
+    else                                  this->_backend->IClose();
 
-void App::Run() noexcept
-{
-    this->_isRunning = true;
-    this->Log(zutil::INFO, "Running");
+    log::AsyncLog::Flush();
 
-    this->_processor.IInit();
+    sInstance = nullptr;
+}
 
-    while (!rl::WindowShouldClose() && this->IsRunning()) [[likely]]
-    {
-        if (this->_timeSystem._IsFixedProcess()) [[unlikely]] this->_processor.IFixedUpdate();
+[[nodiscard]] App& App::GetInstance() noexcept { return *sInstance; }
+[[nodiscard]] bool App::HasInstance() noexcept { return sInstance != nullptr; }
 
-        this->_processor.IUpdate();
+void App::Run() noexcept { this->_Run<system::TimeSystem::RUNTIME_TICK_RATE>(*this->_backend, this->_processor); }
 
-        rl::BeginDrawing();
-        rl::ClearBackground(rl::BLACK);
-        rl::DrawFPS(10, 10);
-        rl::EndDrawing();
-    }
+void App::_SwapFrameMemory() noexcept
+{
+    const memory::HeapCounters HEAP_COUNTERS = memory::GetHeapCounters();
+    const memory::LinearArena& ARENA = this->_frameArena.GetCurrent();
+
+    this->_frameMemoryStats = {
+        HEAP_COUNTERS.allocationCount - this->_frameHeapCounters.allocationCount,
+        HEAP_COUNTERS.allocatedBytes  - this->_frameHeapCounters.allocatedBytes,
+        ARENA.GetUsedBytes(),
+        ARENA.GetOverflowCount(),
+    };
 
-    this->_isRunning = false;
+    // Read again after the swap, an arena regrowing shows up as the overflow count, not as heap traffic
+    this->_frameArena._Swap();
+    this->_frameHeapCounters = memory::GetHeapCounters();
 }
 
 void App::Quit() noexcept { this->_isRunning = false; }
@@ -1,11 +1,27 @@
 #pragma once
 
+#include "engine/asset/asset_manager.hpp"
+#include "engine/event/event_bus.hpp"
+#include "engine/job/coroutine_scheduler.hpp"
+#include "engine/job/thread_pool.hpp"
+#include "engine/memory/frame_arena.hpp"
+#include "engine/memory/heap_tracker.hpp"
+#include "engine/particle/particle_system.hpp"
+#include "engine/platform/i_backend.hpp"
 #include "engine/process/i_processor.hpp"
+#include "engine/render/render_batch.hpp"
+#include "engine/render/render_pipeline.hpp"
+#include "engine/render/render_queue.hpp"
+#include "engine/replay/replay_system.hpp"
+#include "engine/system/input_system.hpp"
 #include "engine/system/time_system.hpp"
+#include "engine/system/timer_system.hpp"
 #include "engine/util/vec2.hpp"
 
 #include <vendor/zutil/zutil.hpp>
 
+#include <cstdint>
+#include <memory>
 #include <string>
 
 namespace dull::core {
@@ -18,6 +34,37 @@ struct WindowContext final {
     util::Vec2i dimension      = {800, 600};
     bool        isVsyncEnabled = false;
     bool        isResizeable   = false;
+
+    platform::BackendType backend = platform::BackendType::Window;
+
+    // Headless only: sleep to hold ticksPerSecond frames instead of running flat out
+    bool isPaced = false;
+
+    // Fixed tick rate, a replay only plays back at the rate it was recorded with
+    uint32_t ticksPerSecond = config::TICKS_PER_SECOND;
+
+    // Starting size (in bytes) of each half of the frame arena
+    size_t frameArenaSize = config::FRAME_ARENA_SIZE;
+
+    // Presents frame N on a render thread while the main thread simulates frame N+1
+    // Note: processors, events, coroutines and every engine system stay on the main thread, the render thread only runs the backend
+    // Note: the GPU context belongs to the render thread, processors and asset finalizers must not touch GPU resources
+    bool isPipelined = false;
+
+    // Headless only: seconds every present keeps the CPU busy, to measure pipelining without a GPU
+    double simulatedRenderCost = 0.0;
+
+    // Overrides the backend clock when set, must outlive the App
+    const platform::IClock* clockPtr = nullptr;
+
+    // Streams the session to this file when set
+    std::string recordPath;
+
+    // Plays this recorded session back instead, always headless and unpaced
+    std::string replayPath;
+
+    // Mounted into the asset manager when the file exists, loose files serve whatever it doesn't hold
+    std::string packPath {config::DEFAULT_PACK_PATH};
 };
 
 // ---
@@ -25,26 +72,86 @@ struct WindowContext final {
 // ---
 struct App final : public zutil::Logger {
 private:
+    std::unique_ptr<platform::IBackend> _backend;
     system::TimeSystem _timeSystem;
+    system::InputSystem _inputSystem;
+    system::TimerSystem _timerSystem;
+    job::ThreadPool _threadPool {config::WORKER_THREAD_COUNT};
+    job::CoroutineScheduler _coroutineScheduler {&this->_threadPool};
+    render::RenderQueue _renderQueue {&this->_threadPool};
+    render::RenderPipeline _renderPipeline;
+    event::EventBus _eventBus {&this->_threadPool};
+    particle::ParticleSystem _particleSystem {&this->_threadPool};
+    asset::PackArchive _pack;
+    asset::AssetManager _assetManager {config::ASSET_CACHE_BUDGET, config::ASSET_WORKER_COUNT};
+    render::RenderBatchList _batchList;
+    memory::FrameArena _frameArena;
+    memory::FrameMemoryStats _frameMemoryStats;
+    memory::HeapCounters _frameHeapCounters;
+    replay::ReplaySystem _replaySystem;
     process::IProcessor& _processor;
     bool _isRunning = false;
 
+    template <typename BackendT>
+    [[nodiscard]] bool _IsCloseRequested(BackendT& backend) noexcept;
+
+    template <uint32_t TICKS_PER_SECOND, typename BackendT, typename ProcessorT>
+    void _RunFrame(BackendT& backend, ProcessorT& processor) noexcept;
+
+    template <typename BackendT>
+    void _Present(BackendT& backend) noexcept;
+
+    void _SwapFrameMemory() noexcept;
+
 public:
     App(App&&)                 = delete;
     App(const App&)            = delete;
     App& operator=(App&&)      = delete;
     App& operator=(const App&) = delete;
 
-    explicit App(const WindowContext& windowContext = {}, process::IProcessor* processorPtr = nullptr);
+    // Note: runs on backend when given, otherwise creates the one windowContext.backend names
+    explicit App(
+        const WindowContext& windowContext = {},
+        process::IProcessor* processorPtr = nullptr,
+        std::unique_ptr<platform::IBackend> backend = nullptr
+    );
     ~App() noexcept;
 
     [[nodiscard]] static App& GetInstance() noexcept;
+    [[nodiscard]] static bool HasInstance() noexcept;
     [[nodiscard]] bool IsRunning() const noexcept { return this->_isRunning; }
+    [[nodiscard]] bool IsPipelined() const noexcept { return this->_renderPipeline.IsActive(); }
     [[nodiscard]] system::TimeSystem& GetTimeSystem() noexcept { return this->_timeSystem; }
+    [[nodiscard]] system::TimerSystem& GetTimerSystem() noexcept { return this->_timerSystem; }
+    [[nodiscard]] replay::ReplaySystem& GetReplaySystem() noexcept { return this->_replaySystem; }
+    [[nodiscard]] system::InputSystem& GetInputSystem() noexcept { return this->_inputSystem; }
+    [[nodiscard]] const platform::InputSnapshot& GetInput() const noexcept { return this->_inputSystem.GetSnapshot(); }
+    [[nodiscard]] job::ThreadPool& GetThreadPool() noexcept { return this->_threadPool; }
+    [[nodiscard]] job::CoroutineScheduler& GetCoroutineScheduler() noexcept { return this->_coroutineScheduler; }
+    [[nodiscard]] render::RenderQueue& GetRenderQueue() noexcept { return this->_renderQueue; }
+    [[nodiscard]] const render::RenderPipeline& GetRenderPipeline() const noexcept { return this->_renderPipeline; }
+    [[nodiscard]] event::EventBus& GetEventBus() noexcept { return this->_eventBus; }
+    [[nodiscard]] particle::ParticleSystem& GetParticleSystem() noexcept { return this->_particleSystem; }
+    [[nodiscard]] asset::AssetManager& GetAssetManager() noexcept { return this->_assetManager; }
+    [[nodiscard]] const asset::PackArchive& GetPack() const noexcept { return this->_pack; }
+    [[nodiscard]] platform::IBackend& GetBackend() noexcept { return *this->_backend; }
+    [[nodiscard]] memory::FrameArena& GetFrameArena() noexcept { return this->_frameArena; }
+
+    // Heap and arena activity of the last completed frame, heap counts need DULL_TRACK_HEAP_ALLOCATIONS
+    [[nodiscard]] const memory::FrameMemoryStats& GetFrameMemoryStats() const noexcept { return this->_frameMemoryStats; }
     [[nodiscard]] process::IProcessor& GetProcessor() noexcept { return this->_processor;  }
 
     void Run() noexcept;
     void Quit() noexcept;
+
+    // ---
+    // Frame loop of Run, defined in app_frame.hpp
+    // Note: Run passes the IBackend and IProcessor interfaces and the runtime tick rate
+    // Note: StaticApp passes its final backend and StaticProcessor types and its tick rate, every call in the loop binds statically
+    // Note: processor must be the App's processor and backend its backend
+    // ---
+    template <uint32_t TICKS_PER_SECOND, typename BackendT, typename ProcessorT>
+    void _Run(BackendT& backend, ProcessorT& processor) noexcept;
 };
 
 } // namespace dull::core
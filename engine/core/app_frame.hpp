@@ -0,0 +1,147 @@
+#pragma once
+
+#include "engine/core/app.hpp"
+#include "engine/event/engine_events.hpp"
+#include "engine/log/async_log.hpp"
+#include "engine/profile/profiler.hpp"
+
+#include <cstdint>
+
+// ---
+// Frame loop of the App, shared by App::Run and StaticApp::Run
+// Note: included only where the loop is instantiated, the rest of the engine sees App through app.hpp
+// ---
+
+namespace dull::core {
+
+template <uint32_t TICKS_PER_SECOND, typename BackendT, typename ProcessorT>
+void App::_Run(BackendT& backend, ProcessorT& processor) noexcept
+{
+    this->_isRunning = true;
+    this->Log(zutil::INFO, "Running");
+
+    {
+        DULL_PROFILE_ZONE("IProcessor::IInit");
+        processor.IInit();
+    }
+
+    this->_timeSystem._ResetFrameTime();
+    this->_replaySystem._SyncTime(this->_timeSystem._lastTime);
+    this->_frameHeapCounters = memory::GetHeapCounters();
+
+    while (!this->_IsCloseRequested(backend) && this->IsRunning()) [[likely]]
+    {
+        this->_RunFrame<TICKS_PER_SECOND>(backend, processor);
+        DULL_PROFILE_END_FRAME();
+    }
+
+    this->_isRunning = false;
+}
+
+template <typename BackendT>
+bool App::_IsCloseRequested(BackendT& backend) noexcept
+{
+    if (this->IsPipelined()) return this->_renderPipeline._IsCloseRequested();
+    return backend.IShouldClose();
+}
+
+template <uint32_t TICKS_PER_SECOND, typename BackendT, typename ProcessorT>
+void App::_RunFrame(BackendT& backend, ProcessorT& processor) noexcept
+{
+    DULL_PROFILE_ZONE("App::Frame");
+
+    log::AsyncLog::_BeginFrame();
+    this->_SwapFrameMemory();
+
+    platform::InputSnapshot input;
+
+    if (this->_inputSystem._HasSource()) this->_inputSystem._PollSource(input);
+    else if (this->IsPipelined())        this->_renderPipeline._PollInput(input);
+    else                                 backend.IPollInput(input);
+
+    if (!this->_replaySystem._PrepareFrame(input)) [[unlikely]]
+    {
+        this->Quit();
+        return;
+    }
+
+    this->_inputSystem._BeginFrame(input);
+
+    const uint32_t FIXED_TICKS = this->_timeSystem._BeginFrame<TICKS_PER_SECOND>();
+    this->_replaySystem._BeginFrame(this->_timeSystem._lastTime, FIXED_TICKS, input);
+    this->_timerSystem._Advance(this->_timeSystem._lastTime);
+    this->_assetManager.Update();
+
+    if (this->_eventBus.HasSubscribers<event::TimerExpired>())
+    {
+        for (const system::TimerId TIMER_ID : this->_timerSystem.GetExpired())
+            this->_eventBus.Publish(event::TimerExpired {TIMER_ID});
+    }
+
+    {
+        DULL_PROFILE_ZONE("App::PreFixedEvents");
+        this->_eventBus.Dispatch();
+    }
+
+    {
+        DULL_PROFILE_ZONE("App::FixedUpdate");
+
+        const float FIXED_TICK_INTERVAL = static_cast<float>(this->_timeSystem._GetFixedTickInterval<TICKS_PER_SECOND>());
+
+        for (uint32_t tick = 0; tick < FIXED_TICKS; tick++)
+        {
+            this->_inputSystem._BeginFixedTick();
+            this->_coroutineScheduler._ResumeFixedTick();
+
+            {
+                DULL_PROFILE_ZONE("IProcessor::IFixedUpdate");
+                processor.IFixedUpdate();
+            }
+
+            this->_particleSystem.Simulate(FIXED_TICK_INTERVAL);
+            this->_replaySystem._EndFixedTick();
+        }
+
+        this->_inputSystem._EndFixedUpdate();
+    }
+
+    {
+        DULL_PROFILE_ZONE("App::Update");
+        this->_coroutineScheduler._ResumeFrame();
+
+        {
+            DULL_PROFILE_ZONE("IProcessor::IUpdate");
+            processor.IUpdate();
+        }
+    }
+
+    {
+        DULL_PROFILE_ZONE("App::PostUpdateEvents");
+        this->_eventBus.Dispatch();
+    }
+
+    this->_Present(backend);
+    this->_replaySystem._EndFrame();
+}
+
+template <typename BackendT>
+void App::_Present(BackendT& backend) noexcept
+{
+    DULL_PROFILE_ZONE("App::Draw");
+
+    this->_particleSystem.Submit(this->_renderQueue);
+
+    // The render thread presents through the IBackend interface
+    if (this->IsPipelined())
+    {
+        this->_renderPipeline._Submit(this->_renderQueue);
+        return;
+    }
+
+    this->_renderQueue.Flush(this->_batchList);
+    backend.IBeginFrame();
+    backend.IDraw(this->_batchList);
+    backend.IEndFrame();
+}
+
+} // namespace dull::core
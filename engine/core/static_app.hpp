@@ -0,0 +1,113 @@
+#pragma once
+
+#include "engine/config.hpp"
+#include "engine/core/app.hpp"
+#include "engine/core/app_frame.hpp"
+#include "engine/platform/headless_backend.hpp"
+#include "engine/platform/i_backend.hpp"
+#if !defined(DULL_NO_RAYLIB)
+    #include "engine/platform/raylib_backend.hpp"
+#endif
+#include "engine/process/static_processor.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace dull::core {
+
+// Concrete backend of a BackendType
+template <platform::BackendType BACKEND>
+struct _BackendOf;
+
+template <>
+struct _BackendOf<platform::BackendType::Headless> { using Type = platform::HeadlessBackend; };
+
+#if !defined(DULL_NO_RAYLIB)
+template <>
+struct _BackendOf<platform::BackendType::Window> { using Type = platform::RaylibBackend; };
+#endif
+
+template <typename ProcessorT>
+struct _IsStaticProcessor : std::false_type {};
+
+template <typename... ProcessorTs>
+struct _IsStaticProcessor<process::StaticProcessor<ProcessorTs...>> : std::true_type {};
+
+// ---
+// Engine policies of a StaticApp, derive from it and shadow what differs
+// Note: Processors is a process::StaticProcessor listing every processor type of the application
+// ---
+struct DefaultAppConfig {
+    static constexpr uint32_t TICKS_PER_SECOND = config::TICKS_PER_SECOND;
+    static constexpr size_t   FRAME_ARENA_SIZE = config::FRAME_ARENA_SIZE;
+
+    static constexpr platform::BackendType BACKEND = platform::BackendType::Window;
+
+    using Processors = process::StaticProcessor<>;
+};
+
+template <typename ConfigT>
+concept AppConfig = requires {
+    { ConfigT::TICKS_PER_SECOND } -> std::convertible_to<uint32_t>;
+    { ConfigT::FRAME_ARENA_SIZE } -> std::convertible_to<size_t>;
+    { ConfigT::BACKEND          } -> std::convertible_to<platform::BackendType>;
+    typename ConfigT::Processors;
+    typename _BackendOf<ConfigT::BACKEND>::Type;
+} && _IsStaticProcessor<typename ConfigT::Processors>::value;
+
+// ---
+// App with its policies fixed at compile time
+// Note: owns the processors and the App, so the usual App::GetInstance access keeps working
+// Note: Run instantiates the frame loop with the tick rate, the concrete backend and the processors, no call in it is virtual
+// Note: the frame arena only gets its size from ConfigT, its allocations are already inline and non virtual
+// Note: the runtime App stays the entry point for tools picking processors and backends at runtime
+// ---
+template <AppConfig ConfigT>
+struct StaticApp final {
+    static_assert(ConfigT::TICKS_PER_SECOND > 0, "Tick rate must be positive");
+
+    using Processors = typename ConfigT::Processors;
+    using Backend    = typename _BackendOf<ConfigT::BACKEND>::Type;
+
+private:
+    Processors _processors;
+    App _app;
+    Backend& _backend;
+
+    [[nodiscard]] static WindowContext _ApplyConfig(WindowContext windowContext) noexcept
+    {
+        zutil::Assert(
+            windowContext.replayPath.empty() || ConfigT::BACKEND == platform::BackendType::Headless,
+            "StaticApp replays need a headless BACKEND"
+        );
+
+        windowContext.ticksPerSecond = ConfigT::TICKS_PER_SECOND;
+        windowContext.frameArenaSize = ConfigT::FRAME_ARENA_SIZE;
+        windowContext.backend        = ConfigT::BACKEND;
+        return windowContext;
+    }
+
+public:
+    StaticApp(StaticApp&&)                 = delete;
+    StaticApp(const StaticApp&)            = delete;
+    StaticApp& operator=(StaticApp&&)      = delete;
+    StaticApp& operator=(const StaticApp&) = delete;
+
+    // Note: the tick rate, frame arena size and backend of the context are overridden by ConfigT
+    explicit StaticApp(const WindowContext& windowContext = {})
+        : _app {StaticApp::_ApplyConfig(windowContext), &this->_processors, std::make_unique<Backend>()}
+        , _backend {static_cast<Backend&>(this->_app.GetBackend())}
+    {}
+
+    [[nodiscard]] App& GetApp() noexcept { return this->_app; }
+    [[nodiscard]] Processors& GetProcessors() noexcept { return this->_processors; }
+    [[nodiscard]] Backend& GetBackend() noexcept { return this->_backend; }
+
+    void Run() noexcept { this->_app._Run<ConfigT::TICKS_PER_SECOND>(this->_backend, this->_processors); }
+    void Quit() noexcept { this->_app.Quit(); }
+};
+
+} // namespace dull::core
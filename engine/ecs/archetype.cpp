@@ -0,0 +1,119 @@
+#include "engine/ecs/archetype.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <bit>
+#include <cstring>
+
+namespace dull::ecs {
+
+[[nodiscard]] static constexpr size_t sAlignUp(size_t value, size_t alignment) noexcept
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+Archetype::Archetype(ComponentMask mask)
+    : _mask {mask}
+{
+    this->_columnIndices.fill(NO_COLUMN);
+
+    size_t rowSize = sizeof(Entity);
+
+    for (ComponentMask remaining = mask; remaining != 0; remaining &= remaining - 1)
+    {
+        const ComponentId COMPONENT_ID = static_cast<ComponentId>(std::countr_zero(remaining));
+
+        this->_columnIndices[COMPONENT_ID] = static_cast<int16_t>(this->_columns.size());
+        this->_columns.push_back({COMPONENT_ID, 0, GetComponentInfo(COMPONENT_ID).size});
+        rowSize += GetComponentInfo(COMPONENT_ID).size;
+    }
+
+    // Shrink until every column fits with its alignment padding
+    for (uint32_t capacity = static_cast<uint32_t>(CHUNK_SIZE / rowSize); capacity > 0; capacity--)
+    {
+        size_t offset = sizeof(Entity) * capacity;
+
+        for (_Column& column : this->_columns)
+        {
+            offset        = sAlignUp(offset, GetComponentInfo(column.componentId).alignment);
+            column.offset = offset;
+            offset       += column.size * capacity;
+        }
+
+        if (offset > CHUNK_SIZE) continue;
+
+        this->_chunkCapacity = capacity;
+        break;
+    }
+
+    zutil::Assert(this->_chunkCapacity > 0, "ECS archetype row does not fit in one chunk, its components are larger than CHUNK_SIZE");
+}
+
+[[nodiscard]] uint32_t Archetype::_PushEntity(Entity entity)
+{
+    if (this->_entityCount == this->_chunks.size() * this->_chunkCapacity)
+        this->_chunks.emplace_back(std::make_unique<Chunk>());
+
+    Chunk& chunk = *this->_chunks[this->_entityCount / this->_chunkCapacity];
+    this->GetEntities(chunk)[chunk.count++] = entity;
+
+    return this->_entityCount++;
+}
+
+[[nodiscard]] Entity Archetype::_SwapRemove(uint32_t row) noexcept
+{
+    const uint32_t LAST_ROW = --this->_entityCount;
+
+    Chunk& lastChunk = *this->_chunks[LAST_ROW / this->_chunkCapacity];
+    const uint32_t LAST_SLOT = --lastChunk.count;
+
+    Entity movedEntity = Entity::Null();
+
+    if (row != LAST_ROW)
+    {
+        Chunk& chunk = *this->_chunks[row / this->_chunkCapacity];
+        const uint32_t SLOT = row % this->_chunkCapacity;
+
+        movedEntity = this->GetEntities(lastChunk)[LAST_SLOT];
+        this->GetEntities(chunk)[SLOT] = movedEntity;
+
+        for (const _Column& column : this->_columns)
+        {
+            std::memcpy(
+                chunk.data     + column.offset + column.size * SLOT,
+                lastChunk.data + column.offset + column.size * LAST_SLOT,
+                column.size
+            );
+        }
+    }
+
+    // Keep one spare chunk around to avoid thrashing on add/remove at the boundary
+    if (this->_chunks.size() > 1 && this->_chunks.back()->count == 0 && this->_chunks[this->_chunks.size() - 2]->count == 0)
+        this->_chunks.pop_back();
+
+    return movedEntity;
+}
+
+void Archetype::_CopyShared(Archetype& source, uint32_t sourceRow, uint32_t targetRow) noexcept
+{
+    for (const _Column& column : this->_columns)
+    {
+        if (!source.HasComponent(column.componentId)) continue;
+
+        std::memcpy(
+            this->_GetComponent(targetRow, column.componentId),
+            source._GetComponent(sourceRow, column.componentId),
+            column.size
+        );
+    }
+}
+
+[[nodiscard]] void* Archetype::_GetComponent(uint32_t row, ComponentId componentId) noexcept
+{
+    Chunk& chunk = *this->_chunks[row / this->_chunkCapacity];
+    const _Column& column = this->_columns[this->_columnIndices[componentId]];
+
+    return chunk.data + column.offset + column.size * (row % this->_chunkCapacity);
+}
+
+} // namespace dull::ecs
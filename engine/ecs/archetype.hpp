@@ -0,0 +1,93 @@
+#pragma once
+
+#include "engine/ecs/component.hpp"
+#include "engine/ecs/entity.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace dull::ecs {
+
+inline constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+// ---
+// Fixed size block holding entities of one archetype as structure of arrays
+// Note: layout is [Entity x capacity][ComponentA x capacity][ComponentB x capacity]...
+// ---
+struct alignas(64) Chunk final {
+    std::byte data[CHUNK_SIZE];
+    uint32_t  count = 0;
+};
+
+// ---
+// Storage for all entities sharing the same component set
+// ---
+struct Archetype final {
+private:
+    struct _Column {
+        ComponentId componentId = 0;
+        size_t      offset      = 0;
+        size_t      size        = 0;
+    };
+
+    static constexpr int16_t NO_COLUMN = -1;
+
+    ComponentMask _mask = 0;
+    std::vector<_Column> _columns;
+    std::array<int16_t, MAX_COMPONENT_TYPES> _columnIndices;
+    std::vector<std::unique_ptr<Chunk>> _chunks;
+    uint32_t _chunkCapacity = 0;
+    uint32_t _entityCount   = 0;
+
+public:
+    explicit Archetype(ComponentMask mask);
+
+    Archetype(Archetype&&)                 = delete;
+    Archetype(const Archetype&)            = delete;
+    Archetype& operator=(Archetype&&)      = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    [[nodiscard]] ComponentMask GetMask() const noexcept { return this->_mask; }
+    [[nodiscard]] uint32_t GetEntityCount() const noexcept { return this->_entityCount; }
+    [[nodiscard]] uint32_t GetChunkCapacity() const noexcept { return this->_chunkCapacity; }
+    [[nodiscard]] size_t GetChunkCount() const noexcept { return this->_chunks.size(); }
+    [[nodiscard]] Chunk& GetChunk(size_t chunkIndex) noexcept { return *this->_chunks[chunkIndex]; }
+
+    [[nodiscard]] bool HasComponent(ComponentId componentId) const noexcept
+    {
+        return this->_columnIndices[componentId] != NO_COLUMN;
+    }
+
+    [[nodiscard]] Entity* GetEntities(Chunk& chunk) const noexcept
+    {
+        return reinterpret_cast<Entity*>(chunk.data);
+    }
+
+    // Note: component must be part of this archetype
+    [[nodiscard]] void* GetColumn(Chunk& chunk, ComponentId componentId) const noexcept
+    {
+        return chunk.data + this->_columns[this->_columnIndices[componentId]].offset;
+    }
+
+    template <Component ComponentT>
+    [[nodiscard]] ComponentT* GetColumn(Chunk& chunk) const noexcept
+    {
+        return static_cast<ComponentT*>(this->GetColumn(chunk, GetComponentId<ComponentT>()));
+    }
+
+    // Appends an entity with uninitialized components, returns its row
+    [[nodiscard]] uint32_t _PushEntity(Entity entity);
+
+    // Moves the last entity into the row, returns the moved entity or Entity::Null()
+    [[nodiscard]] Entity _SwapRemove(uint32_t row) noexcept;
+
+    // Copies every component both archetypes share
+    void _CopyShared(Archetype& source, uint32_t sourceRow, uint32_t targetRow) noexcept;
+
+    [[nodiscard]] void* _GetComponent(uint32_t row, ComponentId componentId) noexcept;
+};
+
+} // namespace dull::ecs
@@ -0,0 +1,29 @@
+#include "engine/ecs/component.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <array>
+#include <mutex>
+
+namespace dull::ecs {
+
+static std::array<ComponentInfo, MAX_COMPONENT_TYPES> sComponentInfos {};
+static ComponentId sComponentCount = 0;
+static std::mutex sRegisterMutex;
+
+[[nodiscard]] ComponentId _RegisterComponent(const ComponentInfo& info) noexcept
+{
+    std::lock_guard lock {sRegisterMutex};
+
+    zutil::Assert(sComponentCount < MAX_COMPONENT_TYPES, "Too many ECS component types");
+
+    sComponentInfos[sComponentCount] = info;
+    return sComponentCount++;
+}
+
+[[nodiscard]] const ComponentInfo& GetComponentInfo(ComponentId componentId) noexcept
+{
+    return sComponentInfos[componentId];
+}
+
+} // namespace dull::ecs
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace dull::ecs {
+
+using ComponentId   = uint32_t;
+using ComponentMask = uint64_t;
+
+inline constexpr ComponentId MAX_COMPONENT_TYPES = 64;
+
+// Components are relocated with memcpy inside chunks
+template <typename ComponentT>
+concept Component =
+    std::is_trivially_copyable_v<ComponentT>    &&
+    std::is_trivially_destructible_v<ComponentT> &&
+    !std::is_const_v<ComponentT>                 &&
+    !std::is_reference_v<ComponentT>
+;
+
+struct ComponentInfo final {
+    size_t size      = 0;
+    size_t alignment = 0;
+};
+
+// Note: ids are handed out on first use, never store them across runs
+[[nodiscard]] ComponentId _RegisterComponent(const ComponentInfo& info) noexcept;
+[[nodiscard]] const ComponentInfo& GetComponentInfo(ComponentId componentId) noexcept;
+
+template <Component ComponentT>
+[[nodiscard]] ComponentId GetComponentId() noexcept
+{
+    static const ComponentId COMPONENT_ID = _RegisterComponent({sizeof(ComponentT), alignof(ComponentT)});
+    return COMPONENT_ID;
+}
+
+template <Component... ComponentTs>
+[[nodiscard]] ComponentMask GetComponentMask() noexcept
+{
+    return (ComponentMask {0} | ... | (ComponentMask {1} << GetComponentId<ComponentTs>()));
+}
+
+} // namespace dull::ecs
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace dull::ecs {
+
+// ---
+// Stable handle to an entity
+// Note: generation is bumped on destroy, so stale handles never alias a reused slot
+// ---
+struct Entity final {
+    uint32_t index      = std::numeric_limits<uint32_t>::max();
+    uint32_t generation = 0;
+
+    [[nodiscard]] static constexpr Entity Null() noexcept { return {}; }
+
+    [[nodiscard]] constexpr bool IsNull() const noexcept { return this->index == std::numeric_limits<uint32_t>::max(); }
+
+    constexpr bool operator == (const Entity& other) const noexcept = default;
+    constexpr bool operator != (const Entity& other) const noexcept = default;
+};
+
+} // namespace dull::ecs
@@ -0,0 +1,81 @@
+#include "engine/ecs/registry.hpp"
+
+namespace dull::ecs {
+
+[[nodiscard]] Archetype& Registry::_GetArchetype(ComponentMask mask)
+{
+    std::unique_ptr<Archetype>& archetype = this->_archetypes[mask];
+
+    if (archetype == nullptr)
+    {
+        archetype = std::make_unique<Archetype>(mask);
+        this->_archetypeList.push_back(archetype.get());
+    }
+
+    return *archetype;
+}
+
+[[nodiscard]] Entity Registry::_AllocateEntity(Archetype& archetype)
+{
+    uint32_t index = 0;
+
+    if (this->_freeIndices.empty())
+    {
+        index = static_cast<uint32_t>(this->_records.size());
+        this->_records.emplace_back();
+    }
+    else
+    {
+        index = this->_freeIndices.back();
+        this->_freeIndices.pop_back();
+    }
+
+    _EntityRecord& record = this->_records[index];
+    const Entity ENTITY   = {index, record.generation};
+
+    record.archetype = &archetype;
+    record.row       = archetype._PushEntity(ENTITY);
+
+    this->_entityCount++;
+    return ENTITY;
+}
+
+[[nodiscard]] Entity Registry::Create() { return this->_AllocateEntity(this->_GetArchetype(0)); }
+
+[[nodiscard]] Entity Registry::_Create(ComponentMask mask) { return this->_AllocateEntity(this->_GetArchetype(mask)); }
+
+void Registry::Destroy(Entity entity) noexcept
+{
+    if (!this->IsAlive(entity)) return;
+
+    _EntityRecord& record = this->_records[entity.index];
+    this->_RemoveRow(*record.archetype, record.row);
+
+    record.archetype = nullptr;
+    record.generation++;
+
+    this->_freeIndices.push_back(entity.index);
+    this->_entityCount--;
+}
+
+void Registry::_MoveEntity(Entity entity, Archetype& target)
+{
+    _EntityRecord& record = this->_records[entity.index];
+    Archetype& source     = *record.archetype;
+
+    const uint32_t TARGET_ROW = target._PushEntity(entity);
+    target._CopyShared(source, record.row, TARGET_ROW);
+
+    this->_RemoveRow(source, record.row);
+
+    record.archetype = &target;
+    record.row       = TARGET_ROW;
+}
+
+void Registry::_RemoveRow(Archetype& archetype, uint32_t row) noexcept
+{
+    const Entity MOVED_ENTITY = archetype._SwapRemove(row);
+    if (!MOVED_ENTITY.IsNull()) this->_records[MOVED_ENTITY.index].row = row;
+}
+
+} // namespace dull::ecs
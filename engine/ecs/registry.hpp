@@ -0,0 +1,183 @@
+#pragma once
+
+#include "engine/ecs/archetype.hpp"
+#include "engine/ecs/component.hpp"
+#include "engine/ecs/entity.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// Forward Declaration
+namespace dull::serial { struct SnapshotReader; }
+
+namespace dull::ecs {
+
+// ---
+// Owner of all entities and their components
+// Note: entities with the same component set share an archetype, queries walk its chunks linearly
+// ---
+struct Registry final {
+    friend serial::SnapshotReader;
+
+private:
+    struct _EntityRecord {
+        Archetype* archetype  = nullptr;
+        uint32_t   row        = 0;
+        uint32_t   generation = 0;
+    };
+
+    std::unordered_map<ComponentMask, std::unique_ptr<Archetype>> _archetypes;
+    std::vector<Archetype*> _archetypeList;
+    std::vector<_EntityRecord> _records;
+    std::vector<uint32_t> _freeIndices;
+    size_t _entityCount = 0;
+
+    [[nodiscard]] Archetype& _GetArchetype(ComponentMask mask);
+    [[nodiscard]] Entity _AllocateEntity(Archetype& archetype);
+    void _MoveEntity(Entity entity, Archetype& target);
+    void _RemoveRow(Archetype& archetype, uint32_t row) noexcept;
+
+    // Creates an entity owning every component of mask, for callers that only know component ids at runtime
+    // Note: components are uninitialized, write each one through _Get before the next query
+    [[nodiscard]] Entity _Create(ComponentMask mask);
+
+    // Note: pointer is invalidated by any structural change of the registry
+    [[nodiscard]] void* _Get(Entity entity, ComponentId componentId) noexcept
+    {
+        zutil::Assert(this->IsAlive(entity), "ECS entity is not alive");
+
+        const _EntityRecord& record = this->_records[entity.index];
+        zutil::Assert(record.archetype->HasComponent(componentId), "ECS entity does not have the component");
+
+        return record.archetype->_GetComponent(record.row, componentId);
+    }
+
+public:
+    Registry() = default;
+
+    Registry(Registry&&)                 = delete;
+    Registry(const Registry&)            = delete;
+    Registry& operator=(Registry&&)      = delete;
+    Registry& operator=(const Registry&) = delete;
+
+// --- Entities ---
+
+    [[nodiscard]] Entity Create();
+
+    template <Component... ComponentTs>
+    Entity Create(const ComponentTs&... components)
+    {
+        Archetype& archetype = this->_GetArchetype(GetComponentMask<ComponentTs...>());
+        const Entity ENTITY  = this->_AllocateEntity(archetype);
+        const uint32_t ROW   = this->_records[ENTITY.index].row;
+
+        ((*static_cast<ComponentTs*>(archetype._GetComponent(ROW, GetComponentId<ComponentTs>())) = components), ...);
+        return ENTITY;
+    }
+
+    void Destroy(Entity entity) noexcept;
+
+    [[nodiscard]] bool IsAlive(Entity entity) const noexcept
+    {
+        return entity.index < this->_records.size() && this->_records[entity.index].generation == entity.generation;
+    }
+
+    [[nodiscard]] size_t GetEntityCount() const noexcept { return this->_entityCount; }
+
+// --- Components ---
+
+    // Note: overwrites the component when the entity already has one
+    template <Component ComponentT>
+    ComponentT& Add(Entity entity, const ComponentT& component = {})
+    {
+        zutil::Assert(this->IsAlive(entity), "ECS entity is not alive");
+
+        const ComponentId COMPONENT_ID = GetComponentId<ComponentT>();
+        Archetype* archetype = this->_records[entity.index].archetype;
+
+        if (!archetype->HasComponent(COMPONENT_ID))
+            this->_MoveEntity(entity, this->_GetArchetype(archetype->GetMask() | (ComponentMask {1} << COMPONENT_ID)));
+
+        ComponentT& storedComponent = this->Get<ComponentT>(entity);
+        storedComponent = component;
+        return storedComponent;
+    }
+
+    template <Component ComponentT>
+    void Remove(Entity entity)
+    {
+        if (!this->Has<ComponentT>(entity)) return;
+
+        const ComponentMask MASK = this->_records[entity.index].archetype->GetMask();
+        this->_MoveEntity(entity, this->_GetArchetype(MASK & ~(ComponentMask {1} << GetComponentId<ComponentT>())));
+    }
+
+    template <Component ComponentT>
+    [[nodiscard]] bool Has(Entity entity) const noexcept
+    {
+        return this->IsAlive(entity) && this->_records[entity.index].archetype->HasComponent(GetComponentId<ComponentT>());
+    }
+
+    // Note: pointer is invalidated by any structural change of the registry
+    template <Component ComponentT>
+    [[nodiscard]] ComponentT& Get(Entity entity) noexcept
+    {
+        zutil::Assert(this->Has<ComponentT>(entity), "ECS entity does not have the component");
+
+        const _EntityRecord& record = this->_records[entity.index];
+        return *std::launder(static_cast<ComponentT*>(record.archetype->_GetComponent(record.row, GetComponentId<ComponentT>())));
+    }
+
+// --- Queries ---
+
+    // Calls fn(Components&...) or fn(Entity, Components&...) for every entity owning all components
+    // Note: do not create, destroy, add or remove inside the callback
+    template <Component... ComponentTs, typename FnT>
+    void ForEach(FnT&& fn)
+    {
+        this->ForEachChunk<ComponentTs...>(
+            [&fn](uint32_t count, const Entity* entities, ComponentTs*... columns)
+            {
+                for (uint32_t row = 0; row < count; row++)
+                {
+                    if constexpr (std::is_invocable_v<FnT&, Entity, ComponentTs&...>)
+                        fn(entities[row], columns[row]...);
+                    else
+                        fn(columns[row]...);
+                }
+            }
+        );
+    }
+
+    // Calls fn(count, entities, Components*...) once per chunk, columns are contiguous arrays
+    template <Component... ComponentTs, typename FnT>
+    void ForEachChunk(FnT&& fn)
+    {
+        const ComponentMask REQUIRED_MASK = GetComponentMask<ComponentTs...>();
+
+        for (Archetype* archetype : this->_archetypeList)
+        {
+            if ((archetype->GetMask() & REQUIRED_MASK) != REQUIRED_MASK || archetype->GetEntityCount() == 0) continue;
+
+            for (size_t chunkIndex = 0; chunkIndex < archetype->GetChunkCount(); chunkIndex++)
+            {
+                Chunk& chunk = archetype->GetChunk(chunkIndex);
+                if (chunk.count == 0) continue;
+
+                fn(
+                    chunk.count,
+                    static_cast<const Entity*>(archetype->GetEntities(chunk)),
+                    std::launder(archetype->template GetColumn<ComponentTs>(chunk))...
+                );
+            }
+        }
+    }
+};
+
+} // namespace dull::ecs
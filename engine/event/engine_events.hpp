@@ -0,0 +1,15 @@
+#pragma once
+
+#include "engine/system/timer_system.hpp"
+
+namespace dull::event {
+
+// ---
+// Published by App for every timer that fired this frame, delivered before the fixed updates
+// Note: only published while something is subscribed to it
+// ---
+struct TimerExpired final {
+    system::TimerId timerId;
+};
+
+} // namespace dull::event
@@ -0,0 +1,41 @@
+#include "engine/event/event_bus.hpp"
+#include "engine/profile/profiler.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+namespace dull::event {
+
+static std::atomic<EventTypeId> sEventTypeCount {0};
+
+[[nodiscard]] EventTypeId _NextEventTypeId() noexcept
+{
+    const EventTypeId EVENT_TYPE_ID = sEventTypeCount.fetch_add(1, std::memory_order_relaxed);
+
+    zutil::Assert(EVENT_TYPE_ID < MAX_EVENT_TYPES, "Too many event types");
+
+    return EVENT_TYPE_ID;
+}
+
+EventBus::EventBus(const job::ThreadPool* threadPoolPtr)
+    : _threadPoolPtr {threadPoolPtr}
+    , _laneCount {threadPoolPtr == nullptr ? 1 : threadPoolPtr->GetThreadCount() + 1}
+{}
+
+void EventBus::Unsubscribe(SubscriptionId subscriptionId) noexcept
+{
+    if (subscriptionId.IsNull()) return;
+
+    _IChannel* channelPtr = this->_channels[subscriptionId.typeId].load(std::memory_order_acquire);
+
+    if (channelPtr != nullptr) channelPtr->_RemoveSubscriber(subscriptionId.serial);
+}
+
+void EventBus::Dispatch()
+{
+    DULL_PROFILE_FUNCTION();
+
+    // Channels created by a subscriber mid dispatch are picked up by index, never invalidated
+    for (size_t index = 0; index < this->_ownedChannels.size(); index++) this->_ownedChannels[index]->_Dispatch();
+}
+
+} // namespace dull::event
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "engine/job/thread_pool.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Forward Declaration
+namespace dull::core { struct App; }
+
+namespace dull::event {
+
+using EventTypeId = uint32_t;
+
+inline constexpr EventTypeId MAX_EVENT_TYPES = 128;
+
+// Events are copied in bulk between lanes and handed out as spans
+template <typename EventT>
+concept Event =
+    std::is_trivially_copyable_v<EventT>    &&
+    std::is_trivially_destructible_v<EventT> &&
+    !std::is_const_v<EventT>                 &&
+    !std::is_reference_v<EventT>
+;
+
+// Note: ids are handed out on first use, never store them across runs
+[[nodiscard]] EventTypeId _NextEventTypeId() noexcept;
+
+template <Event EventT>
+[[nodiscard]] EventTypeId GetEventTypeId() noexcept
+{
+    static const EventTypeId EVENT_TYPE_ID = _NextEventTypeId();
+    return EVENT_TYPE_ID;
+}
+
+// ---
+// Handle returned by EventBus::Subscribe
+// ---
+struct SubscriptionId final {
+    EventTypeId typeId = MAX_EVENT_TYPES;
+    uint32_t    serial = 0;
+
+    [[nodiscard]] constexpr bool IsNull() const noexcept { return this->typeId == MAX_EVENT_TYPES; }
+};
+
+// ---
+// Typed publish / subscribe queue, delivered in batches at phase boundaries
+// Note: every event type owns one append-only lane per thread, publishing takes no lock and no atomic
+// Note: publish from the main thread or pool workers, never while Dispatch runs on another thread
+// Note: subscribers get one contiguous span per type and dispatch, events published during it wait for the next one
+// ---
+struct EventBus final {
+    friend core::App;
+
+private:
+    struct _IChannel {
+        virtual ~_IChannel() = default;
+
+        virtual void _Dispatch() = 0;
+        virtual void _RemoveSubscriber(uint32_t serial) noexcept = 0;
+    };
+
+    template <Event EventT>
+    struct _Channel final : public _IChannel {
+        using Subscriber = std::move_only_function<void(std::span<const EventT>)>;
+
+        struct alignas(64) _Lane {
+            std::vector<EventT> events;
+        };
+
+        std::vector<_Lane> lanes;
+        std::vector<EventT> drained;
+        std::vector<std::pair<uint32_t, Subscriber>> subscribers;
+
+        explicit _Channel(size_t laneCount) : lanes(laneCount) {}
+
+        void _Dispatch() final
+        {
+            this->drained.clear();
+
+            for (_Lane& lane : this->lanes)
+            {
+                this->drained.insert(this->drained.end(), lane.events.begin(), lane.events.end());
+                lane.events.clear();
+            }
+
+            if (this->drained.empty()) return;
+
+            const std::span<const EventT> EVENTS {this->drained};
+
+            for (auto& [serial, subscriber] : this->subscribers) subscriber(EVENTS);
+        }
+
+        void _RemoveSubscriber(uint32_t serial) noexcept final
+        {
+            std::erase_if(this->subscribers, [serial](const auto& entry) { return entry.first == serial; });
+        }
+    };
+
+    const job::ThreadPool* _threadPoolPtr = nullptr;
+    size_t _laneCount = 1;
+
+    std::array<std::atomic<_IChannel*>, MAX_EVENT_TYPES> _channels {};
+    std::vector<std::unique_ptr<_IChannel>> _ownedChannels;
+    std::mutex _channelMutex;
+    uint32_t _nextSerial = 0;
+
+    [[nodiscard]] uint32_t _GetLaneIndex() const noexcept
+    {
+        return this->_threadPoolPtr == nullptr ? 0 : this->_threadPoolPtr->GetCurrentWorkerIndex();
+    }
+
+    // Lookup is a single acquire load, the lock is only taken the first time a type shows up
+    template <Event EventT>
+    [[nodiscard]] _Channel<EventT>& _GetChannel()
+    {
+        const EventTypeId TYPE_ID = GetEventTypeId<EventT>();
+
+        _IChannel* channelPtr = this->_channels[TYPE_ID].load(std::memory_order_acquire);
+
+        if (channelPtr == nullptr) [[unlikely]]
+        {
+            std::lock_guard lock {this->_channelMutex};
+
+            channelPtr = this->_channels[TYPE_ID].load(std::memory_order_relaxed);
+
+            if (channelPtr == nullptr)
+            {
+                channelPtr = this->_ownedChannels.emplace_back(std::make_unique<_Channel<EventT>>(this->_laneCount)).get();
+                this->_channels[TYPE_ID].store(channelPtr, std::memory_order_release);
+            }
+        }
+
+        return static_cast<_Channel<EventT>&>(*channelPtr);
+    }
+
+public:
+    EventBus(EventBus&&)                 = delete;
+    EventBus(const EventBus&)            = delete;
+    EventBus& operator=(EventBus&&)      = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
+    // Note: without a pool every publish must come from one thread
+    explicit EventBus(const job::ThreadPool* threadPoolPtr = nullptr);
+    ~EventBus() noexcept = default;
+
+    template <Event EventT>
+    void Publish(const EventT& event)
+    {
+        this->_GetChannel<EventT>().lanes[this->_GetLaneIndex()].events.push_back(event);
+    }
+
+    template <Event EventT>
+    void PublishBatch(std::span<const EventT> events)
+    {
+        std::vector<EventT>& laneEvents = this->_GetChannel<EventT>().lanes[this->_GetLaneIndex()].events;
+        laneEvents.insert(laneEvents.end(), events.begin(), events.end());
+    }
+
+    // Note: subscribe and unsubscribe outside of Dispatch, usually from IInit / IShutdown
+    template <Event EventT, typename SubscriberT>
+        requires std::is_invocable_v<SubscriberT&, std::span<const EventT>>
+    [[nodiscard]] SubscriptionId Subscribe(SubscriberT&& subscriber)
+    {
+        _Channel<EventT>& channel = this->_GetChannel<EventT>();
+        const uint32_t SERIAL = this->_nextSerial++;
+
+        channel.subscribers.emplace_back(SERIAL, std::forward<SubscriberT>(subscriber));
+
+        return {GetEventTypeId<EventT>(), SERIAL};
+    }
+
+    void Unsubscribe(SubscriptionId subscriptionId) noexcept;
+
+    template <Event EventT>
+    [[nodiscard]] bool HasSubscribers() const noexcept
+    {
+        const _IChannel* channelPtr = this->_channels[GetEventTypeId<EventT>()].load(std::memory_order_acquire);
+        return channelPtr != nullptr && !static_cast<const _Channel<EventT>*>(channelPtr)->subscribers.empty();
+    }
+
+    // Delivers everything published so far, one type at a time in first use order
+    void Dispatch();
+};
+
+} // namespace dull::event
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace dull::job {
+
+template <typename ResultT>
+struct _AsyncResult {
+    std::optional<ResultT> result;
+
+    void return_value(ResultT value) { this->result.emplace(std::move(value)); }
+    [[nodiscard]] ResultT _Take() { return std::move(*this->result); }
+};
+
+template <>
+struct _AsyncResult<void> {
+    void return_void() noexcept {}
+    void _Take() noexcept {}
+};
+
+// ---
+// Lazily started coroutine returning ResultT
+// Note: runs when awaited, the awaiter resumes on whichever thread the task finishes on
+// Note: top level tasks are started through CoroutineScheduler::Spawn
+// Note: exceptions escaping a task terminate, same as the rest of the engine
+// ---
+template <typename ResultT = void>
+struct [[nodiscard]] AsyncTask final {
+    struct promise_type;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    struct _FinalAwaiter {
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        // Symmetric transfer, long await chains don't grow the stack
+        [[nodiscard]] std::coroutine_handle<> await_suspend(Handle handle) const noexcept
+        {
+            const std::coroutine_handle<> CONTINUATION = handle.promise().continuation;
+            return CONTINUATION ? CONTINUATION : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    struct promise_type final : public _AsyncResult<ResultT> {
+        std::coroutine_handle<> continuation;
+
+        [[nodiscard]] AsyncTask get_return_object() noexcept { return AsyncTask {Handle::from_promise(*this)}; }
+        [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+        [[nodiscard]] _FinalAwaiter final_suspend() const noexcept { return {}; }
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+
+private:
+    Handle _handle;
+
+    explicit AsyncTask(Handle handle) noexcept : _handle {handle} {}
+
+public:
+    AsyncTask(const AsyncTask&)            = delete;
+    AsyncTask& operator=(const AsyncTask&) = delete;
+
+    AsyncTask(AsyncTask&& other) noexcept : _handle {std::exchange(other._handle, nullptr)} {}
+
+    AsyncTask& operator=(AsyncTask&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (this->_handle) this->_handle.destroy();
+            this->_handle = std::exchange(other._handle, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~AsyncTask() noexcept { if (this->_handle) this->_handle.destroy(); }
+
+    [[nodiscard]] bool IsDone() const noexcept { return !this->_handle || this->_handle.done(); }
+
+    [[nodiscard]] auto operator co_await() && noexcept
+    {
+        struct Awaiter {
+            Handle handle;
+
+            [[nodiscard]] bool await_ready() const noexcept { return !this->handle || this->handle.done(); }
+
+            [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) const noexcept
+            {
+                this->handle.promise().continuation = awaiting;
+                return this->handle;
+            }
+
+            ResultT await_resume() const { return this->handle.promise()._Take(); }
+        };
+
+        return Awaiter {this->_handle};
+    }
+};
+
+} // namespace dull::job
@@ -0,0 +1,76 @@
+#include "engine/job/coroutine_scheduler.hpp"
+
+namespace dull::job {
+
+CoroutineScheduler::~CoroutineScheduler() noexcept
+{
+    this->_threadPool->Wait(this->_pooledCount);
+
+    std::lock_guard lock {this->_mutex};
+
+    this->_frameWaiters.clear();
+    this->_fixedTickWaiters.clear();
+
+    // A root frame owns its awaited task, destroying it unwinds the whole await chain
+    for (void* address : this->_roots) std::coroutine_handle<>::from_address(address).destroy();
+
+    this->_roots.clear();
+}
+
+[[nodiscard]] CoroutineScheduler::_RootTask CoroutineScheduler::_RunRoot(AsyncTask<void> task)
+{
+    co_await std::move(task);
+}
+
+void CoroutineScheduler::Spawn(AsyncTask<void> task)
+{
+    const _RootTask ROOT = _RunRoot(std::move(task));
+    ROOT.handle.promise().schedulerPtr = this;
+
+    {
+        std::lock_guard lock {this->_mutex};
+        this->_roots.insert(ROOT.handle.address());
+    }
+
+    ROOT.handle.resume();
+}
+
+void CoroutineScheduler::_Park(std::vector<std::coroutine_handle<>>& waiters, std::coroutine_handle<> handle)
+{
+    std::lock_guard lock {this->_mutex};
+    waiters.push_back(handle);
+}
+
+void CoroutineScheduler::_Resume(std::vector<std::coroutine_handle<>>& waiters)
+{
+    {
+        std::lock_guard lock {this->_mutex};
+
+        if (waiters.empty()) return;
+
+        this->_resumingWaiters.swap(waiters);
+    }
+
+    // Coroutines parking again while resumed wait for the next round
+    for (const std::coroutine_handle<> HANDLE : this->_resumingWaiters) HANDLE.resume();
+
+    this->_resumingWaiters.clear();
+}
+
+void CoroutineScheduler::_Retire(_RootTask::Handle handle) noexcept
+{
+    {
+        std::lock_guard lock {this->_mutex};
+        this->_roots.erase(handle.address());
+    }
+
+    handle.destroy();
+}
+
+[[nodiscard]] size_t CoroutineScheduler::GetLiveCount()
+{
+    std::lock_guard lock {this->_mutex};
+    return this->_roots.size();
+}
+
+} // namespace dull::job
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "engine/job/async_task.hpp"
+#include "engine/job/parallel_for.hpp"
+#include "engine/job/thread_pool.hpp"
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Forward Declaration
+namespace dull::core { struct App; }
+
+namespace dull::job {
+
+// ---
+// Runs AsyncTask coroutines against the App frame loop and thread pool
+// Note: NextFrame resumes right before IUpdate, NextFixedTick right before the next IFixedUpdate, both on the main thread
+// Note: RunAsync and ParallelFor resume the coroutine on the worker that finished the job, without blocking a thread
+// Note: tasks still suspended when the scheduler goes away are destroyed, jobs in flight are waited on first
+// ---
+struct CoroutineScheduler final {
+    friend core::App;
+
+private:
+    struct _RootTask {
+        struct promise_type;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        struct _FinalAwaiter {
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+            void await_suspend(Handle handle) const noexcept { handle.promise().schedulerPtr->_Retire(handle); }
+            void await_resume() const noexcept {}
+        };
+
+        struct promise_type {
+            CoroutineScheduler* schedulerPtr = nullptr;
+
+            [[nodiscard]] _RootTask get_return_object() noexcept { return {Handle::from_promise(*this)}; }
+            [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+            [[nodiscard]] _FinalAwaiter final_suspend() const noexcept { return {}; }
+            void return_void() const noexcept {}
+            void unhandled_exception() const noexcept { std::terminate(); }
+        };
+
+        Handle handle;
+    };
+
+    struct _ParkAwaiter {
+        CoroutineScheduler* schedulerPtr;
+        std::vector<std::coroutine_handle<>>* waitersPtr;
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) const { this->schedulerPtr->_Park(*this->waitersPtr, handle); }
+        void await_resume() const noexcept {}
+    };
+
+    template <typename FunctionT>
+    struct _JobAwaiter {
+        using ResultT = std::invoke_result_t<FunctionT&>;
+
+        CoroutineScheduler* schedulerPtr;
+        FunctionT function;
+        std::conditional_t<std::is_void_v<ResultT>, std::monostate, std::optional<ResultT>> result {};
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            CoroutineScheduler& scheduler = *this->schedulerPtr;
+            scheduler._pooledCount.fetch_add(1, std::memory_order_relaxed);
+
+            scheduler._threadPool->Submit([this, handle, &scheduler] {
+                if constexpr (std::is_void_v<ResultT>) this->function();
+                else this->result.emplace(this->function());
+
+                // The awaiter dies once the coroutine moves on, only the scheduler is touched after this
+                handle.resume();
+                scheduler._pooledCount.fetch_sub(1, std::memory_order_release);
+            });
+        }
+
+        ResultT await_resume()
+        {
+            if constexpr (!std::is_void_v<ResultT>) return std::move(*this->result);
+        }
+    };
+
+    template <typename BodyT>
+    struct _ParallelForAwaiter {
+        CoroutineScheduler* schedulerPtr;
+        BodyT  body;
+        size_t count;
+        size_t minChunkSize;
+        size_t chunkCount = 0;
+        std::atomic<size_t> remainingCount {0};
+        std::coroutine_handle<> awaiting;
+
+        [[nodiscard]] bool await_ready()
+        {
+            this->chunkCount = GetParallelChunkCount(this->count, *this->schedulerPtr->_threadPool, this->minChunkSize);
+
+            if (this->chunkCount > 1) return false;
+            if (this->count != 0) this->body(size_t {0}, this->count);
+
+            return true;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            CoroutineScheduler& scheduler = *this->schedulerPtr;
+            const size_t CHUNK_COUNT = this->chunkCount;
+
+            this->awaiting = handle;
+            this->remainingCount.store(CHUNK_COUNT, std::memory_order_relaxed);
+            scheduler._pooledCount.fetch_add(1, std::memory_order_relaxed);
+
+            // The last chunk may resume the coroutine before this loop ends, nothing here reads the awaiter after a Submit
+            for (size_t chunk = 0; chunk < CHUNK_COUNT; chunk++)
+            {
+                scheduler._threadPool->Submit([this, &scheduler, chunk, CHUNK_COUNT] {
+                    this->body(this->count * chunk / CHUNK_COUNT, this->count * (chunk + 1) / CHUNK_COUNT);
+
+                    if (this->remainingCount.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+                    this->awaiting.resume();
+                    scheduler._pooledCount.fetch_sub(1, std::memory_order_release);
+                });
+            }
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    ThreadPool* _threadPool = nullptr;
+
+    std::mutex _mutex;
+    std::vector<std::coroutine_handle<>> _frameWaiters;
+    std::vector<std::coroutine_handle<>> _fixedTickWaiters;
+    std::vector<std::coroutine_handle<>> _resumingWaiters;
+    std::unordered_set<void*> _roots;
+
+    // Coroutines handed to the pool that didn't come back yet
+    std::atomic<uint32_t> _pooledCount {0};
+
+    [[nodiscard]] static _RootTask _RunRoot(AsyncTask<void> task);
+
+    void _Park(std::vector<std::coroutine_handle<>>& waiters, std::coroutine_handle<> handle);
+    void _Resume(std::vector<std::coroutine_handle<>>& waiters);
+    void _Retire(_RootTask::Handle handle) noexcept;
+
+    void _ResumeFrame() { this->_Resume(this->_frameWaiters); }
+    void _ResumeFixedTick() { this->_Resume(this->_fixedTickWaiters); }
+
+public:
+    CoroutineScheduler(CoroutineScheduler&&)                 = delete;
+    CoroutineScheduler(const CoroutineScheduler&)            = delete;
+    CoroutineScheduler& operator=(CoroutineScheduler&&)      = delete;
+    CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+
+    explicit CoroutineScheduler(ThreadPool* threadPool) noexcept : _threadPool {threadPool} {}
+    ~CoroutineScheduler() noexcept;
+
+    // Starts task on the calling thread, it runs until its first suspension before Spawn returns
+    void Spawn(AsyncTask<void> task);
+
+    [[nodiscard]] _ParkAwaiter NextFrame() noexcept { return {this, &this->_frameWaiters}; }
+    [[nodiscard]] _ParkAwaiter NextFixedTick() noexcept { return {this, &this->_fixedTickWaiters}; }
+
+    // co_await yields function's result, function runs as a pool job
+    template <typename FunctionT>
+    [[nodiscard]] _JobAwaiter<std::decay_t<FunctionT>> RunAsync(FunctionT&& function)
+    {
+        return {this, std::forward<FunctionT>(function)};
+    }
+
+    // co_await runs body(begin, end) over [0, count) in chunks across the pool, chunked like job::ParallelFor
+    template <typename BodyT>
+    [[nodiscard]] _ParallelForAwaiter<std::decay_t<BodyT>> ParallelFor(size_t count, BodyT&& body, size_t minChunkSize = 1)
+    {
+        return {this, std::forward<BodyT>(body), count, minChunkSize};
+    }
+
+    // Spawned tasks that haven't finished
+    [[nodiscard]] size_t GetLiveCount();
+};
+
+} // namespace dull::job
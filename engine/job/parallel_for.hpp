@@ -0,0 +1,61 @@
+#pragma once
+
+#include "engine/job/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace dull::job {
+
+// Chunks a range of count items is split into, about four per thread so uneven chunks still balance
+[[nodiscard]] inline size_t GetParallelChunkCount(size_t count, const ThreadPool& threadPool, size_t minChunkSize = 1) noexcept
+{
+    const size_t MAX_CHUNKS = (count + std::max<size_t>(minChunkSize, 1) - 1) / std::max<size_t>(minChunkSize, 1);
+    return std::min<size_t>(MAX_CHUNKS, (threadPool.GetThreadCount() + size_t {1}) * 4);
+}
+
+// ---
+// Runs body(begin, end) over [0, count) split in chunks across the pool and the calling thread, returns once all ran
+// Note: only a helper per worker is submitted, helpers and caller claim chunks from a shared counter
+// Note: chunks never get smaller than minChunkSize items, small ranges run inline
+// ---
+template <typename BodyT>
+void ParallelFor(ThreadPool& threadPool, size_t count, BodyT&& body, size_t minChunkSize = 1)
+{
+    const size_t CHUNK_COUNT = GetParallelChunkCount(count, threadPool, minChunkSize);
+
+    if (CHUNK_COUNT <= 1)
+    {
+        if (count != 0) body(size_t {0}, count);
+        return;
+    }
+
+    std::atomic<size_t>   nextChunk    {0};
+    const uint32_t        HELPER_COUNT = static_cast<uint32_t>(std::min<size_t>(threadPool.GetThreadCount(), CHUNK_COUNT - 1));
+    std::atomic<uint32_t> pendingCount {HELPER_COUNT};
+
+    const auto RUN_CHUNKS = [&] {
+        for (size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed); chunk < CHUNK_COUNT;
+             chunk = nextChunk.fetch_add(1, std::memory_order_relaxed))
+        {
+            body(count * chunk / CHUNK_COUNT, count * (chunk + 1) / CHUNK_COUNT);
+        }
+    };
+
+    for (uint32_t helper = 0; helper < HELPER_COUNT; helper++)
+    {
+        threadPool.Submit([&] {
+            RUN_CHUNKS();
+            pendingCount.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    RUN_CHUNKS();
+
+    // Helpers nobody picked up yet run here and find no chunk left
+    threadPool.Wait(pendingCount);
+}
+
+} // namespace dull::job
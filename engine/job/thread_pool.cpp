@@ -0,0 +1,125 @@
+#include "engine/job/thread_pool.hpp"
+
+#include <algorithm>
+
+namespace dull::job {
+
+static thread_local const ThreadPool* sCurrentPool = nullptr;
+static thread_local uint32_t sWorkerIndex = 0;
+
+ThreadPool::ThreadPool(uint32_t threadCount)
+{
+    if (threadCount == 0) threadCount = std::max(std::thread::hardware_concurrency(), 2U) - 1;
+
+    for (uint32_t queue = 0; queue <= threadCount; queue++) this->_queues.emplace_back(std::make_unique<_Queue>());
+
+    this->_threads.reserve(threadCount);
+    for (uint32_t worker = 0; worker < threadCount; worker++) this->_threads.emplace_back(&ThreadPool::_WorkerLoop, this, worker);
+}
+
+ThreadPool::~ThreadPool() noexcept
+{
+    {
+        std::lock_guard lock {this->_sleepMutex};
+        this->_isStopping = true;
+    }
+
+    this->_wakeCondition.notify_all();
+    for (std::thread& thread : this->_threads) thread.join();
+}
+
+[[nodiscard]] uint32_t ThreadPool::GetCurrentWorkerIndex() const noexcept
+{
+    return sCurrentPool == this ? sWorkerIndex : this->GetThreadCount();
+}
+
+void ThreadPool::Submit(Task task)
+{
+    uint32_t queueIndex = this->GetCurrentWorkerIndex();
+
+    // Outside threads spread their work over the workers
+    if (queueIndex == this->GetThreadCount() && !this->_threads.empty())
+        queueIndex = this->_nextQueue.fetch_add(1, std::memory_order_relaxed) % this->GetThreadCount();
+
+    // Counted before the push so a thief can never take the count below zero
+    this->_queuedCount.fetch_add(1, std::memory_order_release);
+
+    {
+        _Queue& queue = *this->_queues[queueIndex];
+        std::lock_guard lock {queue.mutex};
+        queue.tasks.push_back(std::move(task));
+    }
+
+    {
+        std::lock_guard lock {this->_sleepMutex};
+    }
+
+    this->_wakeCondition.notify_one();
+}
+
+void ThreadPool::Wait(const std::atomic<uint32_t>& pendingCounter)
+{
+    const uint32_t QUEUE_INDEX = this->GetCurrentWorkerIndex();
+
+    while (pendingCounter.load(std::memory_order_acquire) != 0)
+    {
+        if (!this->_TryRunOne(QUEUE_INDEX)) std::this_thread::yield();
+    }
+}
+
+[[nodiscard]] bool ThreadPool::_TryRunOne(uint32_t queueIndex)
+{
+    Task task;
+
+    {
+        _Queue& ownQueue = *this->_queues[queueIndex];
+        std::lock_guard lock {ownQueue.mutex};
+
+        if (!ownQueue.tasks.empty())
+        {
+            task = std::move(ownQueue.tasks.back());
+            ownQueue.tasks.pop_back();
+        }
+    }
+
+    const uint32_t QUEUE_COUNT = static_cast<uint32_t>(this->_queues.size());
+
+    for (uint32_t offset = 1; !task && offset < QUEUE_COUNT; offset++)
+    {
+        _Queue& victimQueue = *this->_queues[(queueIndex + offset) % QUEUE_COUNT];
+        std::lock_guard lock {victimQueue.mutex};
+
+        if (!victimQueue.tasks.empty())
+        {
+            task = std::move(victimQueue.tasks.front());
+            victimQueue.tasks.pop_front();
+        }
+    }
+
+    if (!task) return false;
+
+    this->_queuedCount.fetch_sub(1, std::memory_order_relaxed);
+    task();
+    return true;
+}
+
+void ThreadPool::_WorkerLoop(uint32_t workerIndex)
+{
+    sCurrentPool = this;
+    sWorkerIndex = workerIndex;
+
+    while (true)
+    {
+        if (this->_TryRunOne(workerIndex)) continue;
+
+        std::unique_lock lock {this->_sleepMutex};
+
+        this->_wakeCondition.wait(lock, [this] {
+            return this->_isStopping || this->_queuedCount.load(std::memory_order_acquire) != 0;
+        });
+
+        if (this->_isStopping && this->_queuedCount.load(std::memory_order_acquire) == 0) return;
+    }
+}
+
+} // namespace dull::job
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dull::job {
+
+using Task = std::move_only_function<void()>;
+
+// ---
+// Work-stealing pool of worker threads
+// Note: every worker owns a deque, it pops its own work LIFO and steals others' FIFO
+// ---
+struct ThreadPool final {
+private:
+    struct _Queue {
+        std::mutex       mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<_Queue>> _queues; // one per worker, last one is shared by outside threads
+    std::vector<std::thread> _threads;
+
+    std::atomic<uint32_t> _queuedCount {0};
+    std::atomic<uint32_t> _nextQueue   {0};
+
+    std::mutex              _sleepMutex;
+    std::condition_variable _wakeCondition;
+    bool                    _isStopping = false;
+
+    [[nodiscard]] bool _TryRunOne(uint32_t queueIndex);
+    void _WorkerLoop(uint32_t workerIndex);
+
+public:
+    ThreadPool(ThreadPool&&)                 = delete;
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(ThreadPool&&)      = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Note: threadCount of 0 picks one worker per hardware thread besides the caller
+    explicit ThreadPool(uint32_t threadCount = 0);
+    ~ThreadPool() noexcept;
+
+    [[nodiscard]] uint32_t GetThreadCount() const noexcept { return static_cast<uint32_t>(this->_threads.size()); }
+
+    // Index of the calling worker, or GetThreadCount() for threads outside the pool
+    [[nodiscard]] uint32_t GetCurrentWorkerIndex() const noexcept;
+
+    void Submit(Task task);
+
+    // Runs queued tasks on the calling thread until the counter drops to zero
+    void Wait(const std::atomic<uint32_t>& pendingCounter);
+};
+
+} // namespace dull::job
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace dull::job {
+
+// ---
+// Lock-free hand-off of whole values from one producer thread to one consumer thread
+// Note: the producer fills the back slot and publishes it, the consumer swaps the newest published slot to the front
+// Note: an unconsumed slot is replaced by the next publish, WaitConsumed holds the producer back instead
+// ---
+template <typename T>
+struct TripleBuffer final {
+private:
+    static constexpr uint8_t INDEX_MASK = 0b011;
+    static constexpr uint8_t FRESH_BIT  = 0b100;
+
+    std::array<T, 3> _slots {};
+
+    // Index of the published slot, FRESH_BIT while the consumer hasn't taken it
+    alignas(64) std::atomic<uint8_t> _middle {1};
+
+    alignas(64) uint8_t _backIndex  = 0; // producer only
+    alignas(64) uint8_t _frontIndex = 2; // consumer only
+
+public:
+    TripleBuffer(TripleBuffer&&)                 = delete;
+    TripleBuffer(const TripleBuffer&)            = delete;
+    TripleBuffer& operator=(TripleBuffer&&)      = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    TripleBuffer() = default;
+
+// --- Producer ---
+
+    [[nodiscard]] T& GetBack() noexcept { return this->_slots[this->_backIndex]; }
+
+    // The back slot becomes the published one, the previous published slot becomes the back
+    void Publish() noexcept
+    {
+        const uint8_t PREVIOUS = this->_middle.exchange(this->_backIndex | FRESH_BIT, std::memory_order_acq_rel);
+
+        this->_backIndex = PREVIOUS & INDEX_MASK;
+        this->_middle.notify_one();
+    }
+
+    // Blocks while the last published slot is still waiting for the consumer
+    void WaitConsumed() const noexcept
+    {
+        uint8_t state = this->_middle.load(std::memory_order_acquire);
+
+        while ((state & FRESH_BIT) != 0)
+        {
+            this->_middle.wait(state, std::memory_order_acquire);
+            state = this->_middle.load(std::memory_order_acquire);
+        }
+    }
+
+// --- Consumer ---
+
+    [[nodiscard]] T& GetFront() noexcept { return this->_slots[this->_frontIndex]; }
+
+    // Swaps the newest published slot to the front, false (front untouched) when nothing new was published
+    [[nodiscard]] bool Acquire() noexcept
+    {
+        if ((this->_middle.load(std::memory_order_relaxed) & FRESH_BIT) == 0) return false;
+
+        const uint8_t PREVIOUS = this->_middle.exchange(this->_frontIndex, std::memory_order_acq_rel);
+
+        this->_frontIndex = PREVIOUS & INDEX_MASK;
+        this->_middle.notify_one();
+        return true;
+    }
+
+    // Blocks until a slot newer than the front is published
+    void WaitPublished() const noexcept
+    {
+        uint8_t state = this->_middle.load(std::memory_order_acquire);
+
+        while ((state & FRESH_BIT) == 0)
+        {
+            this->_middle.wait(state, std::memory_order_acquire);
+            state = this->_middle.load(std::memory_order_acquire);
+        }
+    }
+};
+
+} // namespace dull::job
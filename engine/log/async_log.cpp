@@ -0,0 +1,510 @@
+#include "engine/log/async_log.hpp"
+#include "engine/profile/profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace dull::log {
+
+static constexpr size_t RING_CAPACITY   = 1 << 18;
+static constexpr size_t MAX_RECORD_SIZE = RING_CAPACITY / 4;
+static constexpr auto   DRAIN_INTERVAL  = std::chrono::milliseconds {2};
+
+static constexpr std::string_view ENGINE_TAG    = "[DULL]"; // text of config::DULL_TAG
+static constexpr std::string_view BINARY_MAGIC  = "DULLLOG1";
+
+static constexpr uint8_t BINARY_STRING = 1;
+static constexpr uint8_t BINARY_RECORD = 2;
+
+// ---
+// Single producer ring of variable sized records, written by its thread and drained by the log thread
+// Note: a record that doesn't fit before the end leaves a padding record and wraps to the start
+// ---
+struct _ThreadRing {
+    std::unique_ptr<std::byte[]> bytes = std::make_unique<std::byte[]>(RING_CAPACITY);
+    alignas(64) std::atomic<uint64_t> head {0};
+    alignas(64) std::atomic<uint64_t> tail {0};
+    uint64_t pendingHead = 0;
+};
+
+struct _PendingRecord {
+    int64_t timestamp;
+    _LogRecord record;
+    const std::byte* argsPtr;
+};
+
+// ---
+// Log thread and its outputs
+// Note: declared after the rings so it stops, and drains them one last time, before they are freed
+// ---
+struct _Backend {
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable flushCondition;
+    uint64_t flushRequest = 0;
+    uint64_t flushDone    = 0;
+    bool isStopping = false;
+    std::atomic<bool> isWakeRequested {false};
+
+    std::mutex outputMutex;
+    std::FILE* binaryFile = nullptr;
+    std::unordered_map<const char*, uint32_t> binaryStringIds;
+
+    std::vector<_PendingRecord> pending;
+    std::vector<_ThreadRing*> drainRings;
+    std::string text;
+
+    void Run();
+    void Drain();
+
+    ~_Backend() noexcept;
+};
+
+static std::mutex sRingMutex;
+static std::vector<std::unique_ptr<_ThreadRing>> sRings;
+static thread_local _ThreadRing* sThreadRing = nullptr;
+
+static _Backend sBackend;
+
+static std::atomic<uint64_t> sFrameIndex {0};
+static std::atomic<uint64_t> sDroppedCount {0};
+
+[[nodiscard]] static _ThreadRing& sGetThreadRing()
+{
+    if (sThreadRing != nullptr) [[likely]] return *sThreadRing;
+
+    std::lock_guard lock {sRingMutex};
+
+    sRings.push_back(std::make_unique<_ThreadRing>());
+    sThreadRing = sRings.back().get();
+
+    // The first thread to log starts the log thread
+    if (!sBackend.thread.joinable()) sBackend.thread = std::thread {&_Backend::Run, &sBackend};
+
+    return *sThreadRing;
+}
+
+[[nodiscard]] static constexpr std::string_view sGetLevelName(LogLevel level) noexcept
+{
+    switch (level)
+    {
+    case LogLevel::Trace  : return "TRACE";
+    case LogLevel::Debug  : return "DEBUG";
+    case LogLevel::Info   : return "INFO";
+    case LogLevel::Warning: return "WARNING";
+    case LogLevel::Error  : return "ERROR";
+    }
+
+    return "?";
+}
+
+[[nodiscard]] std::byte* AsyncLog::_Reserve(const _LogRecord& record) noexcept
+{
+    const size_t SIZE = (sizeof(_LogRecord) + record.argsSize + 7) & ~size_t {7};
+
+    if (SIZE > MAX_RECORD_SIZE) [[unlikely]]
+    {
+        sDroppedCount.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    _ThreadRing& ring = sGetThreadRing();
+
+    uint64_t head = ring.head.load(std::memory_order_relaxed);
+    const uint64_t USED       = head - ring.tail.load(std::memory_order_acquire);
+    const uint64_t FREE       = RING_CAPACITY - USED;
+    const uint64_t CONTIGUOUS = RING_CAPACITY - (head & (RING_CAPACITY - 1));
+    const uint64_t PADDING    = CONTIGUOUS < SIZE ? CONTIGUOUS : 0;
+
+    if (PADDING + SIZE > FREE) [[unlikely]]
+    {
+        sDroppedCount.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    if (PADDING != 0)
+    {
+        // Only the size and padding flag fit in the smallest gap, both sit in the first 8 bytes
+        const uint32_t PADDING_SIZE = static_cast<uint32_t>(PADDING);
+        const bool     IS_PADDING   = true;
+
+        std::byte* gapPtr = ring.bytes.get() + (head & (RING_CAPACITY - 1));
+        std::memcpy(gapPtr + offsetof(_LogRecord, size), &PADDING_SIZE, sizeof(PADDING_SIZE));
+        std::memcpy(gapPtr + offsetof(_LogRecord, isPadding), &IS_PADDING, sizeof(IS_PADDING));
+
+        head += PADDING;
+    }
+
+    _LogRecord header = record;
+    header.size      = static_cast<uint32_t>(SIZE);
+    header.timestamp = profile::Profiler::Now();
+
+    std::byte* recordPtr = ring.bytes.get() + (head & (RING_CAPACITY - 1));
+    std::memcpy(recordPtr, &header, sizeof(_LogRecord));
+
+    ring.pendingHead = head + SIZE;
+
+    // Bursts wake the log thread early instead of waiting out the drain interval
+    // Note: set without the mutex, a missed wake only costs one interval
+    if (USED < RING_CAPACITY / 2 && USED + PADDING + SIZE >= RING_CAPACITY / 2) [[unlikely]]
+    {
+        sBackend.isWakeRequested.store(true, std::memory_order_relaxed);
+        sBackend.wakeCondition.notify_one();
+    }
+
+    return recordPtr + sizeof(_LogRecord);
+}
+
+void AsyncLog::_Commit() noexcept { sThreadRing->head.store(sThreadRing->pendingHead, std::memory_order_release); }
+
+void AsyncLog::_BeginFrame() noexcept { sFrameIndex.fetch_add(1, std::memory_order_relaxed); }
+
+[[nodiscard]] uint64_t AsyncLog::GetFrameIndex() noexcept { return sFrameIndex.load(std::memory_order_relaxed); }
+
+[[nodiscard]] uint64_t AsyncLog::GetDroppedCount() noexcept { return sDroppedCount.load(std::memory_order_relaxed); }
+
+void AsyncLog::Flush()
+{
+    {
+        std::lock_guard lock {sRingMutex};
+        if (!sBackend.thread.joinable()) return;
+    }
+
+    std::unique_lock lock {sBackend.mutex};
+
+    const uint64_t REQUEST = ++sBackend.flushRequest;
+    sBackend.wakeCondition.notify_one();
+    sBackend.flushCondition.wait(lock, [REQUEST] { return sBackend.flushDone >= REQUEST; });
+}
+
+[[nodiscard]] bool AsyncLog::OpenBinaryOutput(const std::filesystem::path& path)
+{
+    CloseBinaryOutput();
+
+    std::FILE* filePtr = std::fopen(path.string().c_str(), "wb");
+
+    if (filePtr == nullptr) return false;
+
+    std::fwrite(BINARY_MAGIC.data(), 1, BINARY_MAGIC.size(), filePtr);
+
+    std::lock_guard lock {sBackend.outputMutex};
+    sBackend.binaryFile = filePtr;
+    sBackend.binaryStringIds.clear();
+
+    return true;
+}
+
+void AsyncLog::CloseBinaryOutput()
+{
+    Flush();
+
+    std::lock_guard lock {sBackend.outputMutex};
+
+    if (sBackend.binaryFile == nullptr) return;
+
+    std::fclose(sBackend.binaryFile);
+    sBackend.binaryFile = nullptr;
+}
+
+// --- Log thread ---
+
+void _Backend::Run()
+{
+    while (true)
+    {
+        uint64_t request  = 0;
+        bool     stopping = false;
+
+        {
+            std::unique_lock lock {this->mutex};
+            this->wakeCondition.wait_for(lock, DRAIN_INTERVAL, [this] {
+                return this->isStopping || this->flushRequest != this->flushDone || this->isWakeRequested.load(std::memory_order_relaxed);
+            });
+
+            this->isWakeRequested.store(false, std::memory_order_relaxed);
+
+            request  = this->flushRequest;
+            stopping = this->isStopping;
+        }
+
+        this->Drain();
+
+        {
+            std::lock_guard lock {this->mutex};
+            this->flushDone = request;
+        }
+
+        this->flushCondition.notify_all();
+
+        if (stopping) return;
+    }
+}
+
+static void sWriteBinary(std::FILE* filePtr, const void* data, size_t size) { std::fwrite(data, 1, size, filePtr); }
+
+[[nodiscard]] static uint32_t sGetBinaryStringId(_Backend& backend, const char* data, uint32_t size)
+{
+    const auto [it, IS_NEW] = backend.binaryStringIds.try_emplace(data, static_cast<uint32_t>(backend.binaryStringIds.size()));
+
+    if (IS_NEW)
+    {
+        sWriteBinary(backend.binaryFile, &BINARY_STRING, sizeof(BINARY_STRING));
+        sWriteBinary(backend.binaryFile, &it->second, sizeof(uint32_t));
+        sWriteBinary(backend.binaryFile, &size, sizeof(size));
+        sWriteBinary(backend.binaryFile, data, size);
+    }
+
+    return it->second;
+}
+
+// Note: no profile zones here, the log thread outlives the profiler rings at exit
+void _Backend::Drain()
+{
+    {
+        std::lock_guard lock {sRingMutex};
+
+        this->drainRings.clear();
+        for (const std::unique_ptr<_ThreadRing>& ring : sRings) this->drainRings.push_back(ring.get());
+    }
+
+    this->pending.clear();
+
+    std::vector<uint64_t> heads;
+    heads.reserve(this->drainRings.size());
+
+    for (_ThreadRing* ringPtr : this->drainRings)
+    {
+        const uint64_t HEAD = ringPtr->head.load(std::memory_order_acquire);
+        heads.push_back(HEAD);
+
+        for (uint64_t tail = ringPtr->tail.load(std::memory_order_relaxed); tail != HEAD;)
+        {
+            const std::byte* recordPtr = ringPtr->bytes.get() + (tail & (RING_CAPACITY - 1));
+
+            uint32_t size;
+            bool     isPadding;
+            std::memcpy(&size, recordPtr + offsetof(_LogRecord, size), sizeof(size));
+            std::memcpy(&isPadding, recordPtr + offsetof(_LogRecord, isPadding), sizeof(isPadding));
+
+            tail += size;
+
+            if (isPadding) continue;
+
+            _LogRecord record;
+            std::memcpy(&record, recordPtr, sizeof(_LogRecord));
+
+            this->pending.push_back({record.timestamp, record, recordPtr + sizeof(_LogRecord)});
+        }
+    }
+
+    // Records of all threads come out in time order
+    std::stable_sort(this->pending.begin(), this->pending.end(), [](const _PendingRecord& lhs, const _PendingRecord& rhs) {
+        return lhs.timestamp < rhs.timestamp;
+    });
+
+    {
+        std::lock_guard lock {this->outputMutex};
+
+        for (const _PendingRecord& entry : this->pending)
+        {
+            const _LogRecord& record = entry.record;
+
+            if (this->binaryFile != nullptr)
+            {
+                const int64_t  NANOSECONDS = profile::Profiler::ToNanoseconds(record.timestamp);
+                const uint32_t CHANNEL_ID  = sGetBinaryStringId(*this, record.channel, record.channelSize);
+                const uint32_t FORMAT_ID   = sGetBinaryStringId(*this, record.format, record.formatSize);
+
+                sWriteBinary(this->binaryFile, &BINARY_RECORD, sizeof(BINARY_RECORD));
+                sWriteBinary(this->binaryFile, &NANOSECONDS, sizeof(NANOSECONDS));
+                sWriteBinary(this->binaryFile, &record.level, sizeof(record.level));
+                sWriteBinary(this->binaryFile, &CHANNEL_ID, sizeof(CHANNEL_ID));
+                sWriteBinary(this->binaryFile, &FORMAT_ID, sizeof(FORMAT_ID));
+                sWriteBinary(this->binaryFile, &record.argsSize, sizeof(record.argsSize));
+                sWriteBinary(this->binaryFile, entry.argsPtr, record.argsSize);
+                continue;
+            }
+
+            this->text += ENGINE_TAG;
+            this->text += ' ';
+            this->text += std::string_view {record.channel, record.channelSize};
+            this->text += " [";
+            this->text += sGetLevelName(record.level);
+            this->text += "] ";
+
+            try
+            {
+                record.formatFn({record.format, record.formatSize}, entry.argsPtr, this->text);
+            }
+            catch (const std::exception& error)
+            {
+                this->text += "<format error: ";
+                this->text += error.what();
+                this->text += '>';
+            }
+
+            this->text += '\n';
+        }
+
+        if (this->binaryFile != nullptr && !this->pending.empty()) std::fflush(this->binaryFile);
+    }
+
+    // Space goes back to the producers only once everything in it was written out
+    for (size_t index = 0; index < this->drainRings.size(); index++)
+        this->drainRings[index]->tail.store(heads[index], std::memory_order_release);
+
+    if (this->text.empty()) return;
+
+    std::fwrite(this->text.data(), 1, this->text.size(), stdout);
+    std::fflush(stdout);
+    this->text.clear();
+}
+
+_Backend::~_Backend() noexcept
+{
+    if (!this->thread.joinable()) return;
+
+    {
+        std::lock_guard lock {this->mutex};
+        this->isStopping = true;
+    }
+
+    this->wakeCondition.notify_one();
+    this->thread.join();
+
+    if (this->binaryFile != nullptr) std::fclose(this->binaryFile);
+}
+
+// --- Binary decoding ---
+
+// Formats one tagged argument with the replacement field spec it was logged with
+static void sFormatTaggedArg(std::string_view spec, const std::byte*& cursor, std::string& out)
+{
+    const std::string FIELD = "{" + std::string {spec} + "}";
+    const auto FORMAT_ONE   = [&](const auto& value) {
+        std::vformat_to(std::back_inserter(out), FIELD, std::make_format_args(value));
+    };
+
+    switch (static_cast<_ArgTag>(*cursor))
+    {
+    case _ArgTag::Int    : FORMAT_ONE(_LogArg<int64_t>::Decode(cursor));          break;
+    case _ArgTag::UInt   : FORMAT_ONE(_LogArg<uint64_t>::Decode(cursor));         break;
+    case _ArgTag::Float  : FORMAT_ONE(_LogArg<float>::Decode(cursor));            break;
+    case _ArgTag::Double : FORMAT_ONE(_LogArg<double>::Decode(cursor));           break;
+    case _ArgTag::Bool   : FORMAT_ONE(_LogArg<bool>::Decode(cursor));             break;
+    case _ArgTag::Char   : FORMAT_ONE(_LogArg<char>::Decode(cursor));             break;
+    case _ArgTag::String : FORMAT_ONE(_LogArg<std::string_view>::Decode(cursor)); break;
+    case _ArgTag::Pointer: FORMAT_ONE(_LogArg<int*>::Decode(cursor));             break;
+    }
+}
+
+// Note: fields are filled in order, explicit argument indices are ignored
+static void sFormatTagged(std::string_view format, const std::byte* args, const std::byte* argsEnd, std::string& out)
+{
+    const std::byte* cursor = args;
+
+    for (size_t index = 0; index < format.size(); index++)
+    {
+        const char CHARACTER = format[index];
+
+        if ((CHARACTER == '{' || CHARACTER == '}') && index + 1 < format.size() && format[index + 1] == CHARACTER)
+        {
+            out += CHARACTER;
+            index++;
+            continue;
+        }
+
+        if (CHARACTER != '{')
+        {
+            out += CHARACTER;
+            continue;
+        }
+
+        const size_t CLOSE = format.find('}', index);
+
+        if (CLOSE == std::string_view::npos || cursor >= argsEnd) return;
+
+        std::string_view field = format.substr(index + 1, CLOSE - index - 1);
+        field.remove_prefix(std::min(field.find_first_not_of("0123456789"), field.size()));
+
+        sFormatTaggedArg(field, cursor, out);
+        index = CLOSE;
+    }
+}
+
+[[nodiscard]] bool AsyncLog::WriteBinaryAsText(const std::filesystem::path& binaryPath, const std::filesystem::path& textPath)
+{
+    std::ifstream input {binaryPath, std::ios::binary};
+    const std::string BYTES {std::istreambuf_iterator<char> {input}, std::istreambuf_iterator<char> {}};
+
+    if (!BYTES.starts_with(BINARY_MAGIC)) return false;
+
+    std::unordered_map<uint32_t, std::string_view> strings;
+    std::string text;
+    size_t offset = BINARY_MAGIC.size();
+
+    const auto READ = [&](void* destinationPtr, size_t size) {
+        if (BYTES.size() - offset < size) return false;
+
+        std::memcpy(destinationPtr, BYTES.data() + offset, size);
+        offset += size;
+        return true;
+    };
+
+    while (offset < BYTES.size())
+    {
+        uint8_t kind;
+        if (!READ(&kind, sizeof(kind))) return false;
+
+        if (kind == BINARY_STRING)
+        {
+            uint32_t id, size;
+            if (!READ(&id, sizeof(id)) || !READ(&size, sizeof(size)) || BYTES.size() - offset < size) return false;
+
+            strings[id] = std::string_view {BYTES}.substr(offset, size);
+            offset += size;
+            continue;
+        }
+
+        int64_t  nanoseconds;
+        LogLevel level;
+        uint32_t channelId, formatId, argsSize;
+
+        if (kind != BINARY_RECORD) return false;
+        if (!READ(&nanoseconds, sizeof(nanoseconds)) || !READ(&level, sizeof(level))) return false;
+        if (!READ(&channelId, sizeof(channelId)) || !READ(&formatId, sizeof(formatId)) || !READ(&argsSize, sizeof(argsSize))) return false;
+        if (BYTES.size() - offset < argsSize) return false;
+
+        const std::byte* argsPtr = reinterpret_cast<const std::byte*>(BYTES.data() + offset);
+        offset += argsSize;
+
+        text += std::format("{:.6f} {} {} [{}] ", static_cast<double>(nanoseconds) * 1e-9, ENGINE_TAG, strings[channelId], sGetLevelName(level));
+
+        try
+        {
+            sFormatTagged(strings[formatId], argsPtr, argsPtr + argsSize, text);
+        }
+        catch (const std::exception& error)
+        {
+            text += std::format("<format error: {}>", error.what());
+        }
+
+        text += '\n';
+    }
+
+    std::ofstream output {textPath, std::ios::binary};
+    output.write(text.data(), static_cast<std::streamsize>(text.size()));
+
+    return static_cast<bool>(output);
+}
+
+} // namespace dull::log
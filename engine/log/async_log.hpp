@@ -0,0 +1,175 @@
+#pragma once
+
+#include "engine/log/log_arg.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+// Lowest level compiled in, 0 trace, 1 debug, 2 info, 3 warning, 4 error
+#if !defined(DULL_LOG_MIN_LEVEL)
+    #if defined(NDEBUG)
+        #define DULL_LOG_MIN_LEVEL 2
+    #else
+        #define DULL_LOG_MIN_LEVEL 0
+    #endif
+#endif
+
+namespace dull::log {
+
+enum class LogLevel : uint8_t {
+    Trace   = 0,
+    Debug   = 1,
+    Info    = 2,
+    Warning = 3,
+    Error   = 4,
+};
+
+using _FormatFn = void (*)(std::string_view format, const std::byte* args, std::string& out);
+
+// Fixed part of a record in a thread ring, encoded arguments follow
+struct _LogRecord {
+    uint32_t size; // whole record, multiple of 8
+    LogLevel level;
+    bool     isPadding;
+    uint16_t channelSize;
+    uint32_t formatSize;
+    uint32_t argsSize;
+    const char* channel;
+    const char* format;
+    _FormatFn   formatFn;
+    int64_t     timestamp;
+};
+
+// ---
+// Asynchronous log backend for hot paths
+// Note: callers encode their arguments into a per-thread lock-free ring, a background thread formats and writes them
+// Note: a full ring drops the record and counts it, logging never blocks the caller
+// Note: format strings and channels must outlive the log (string literals), string arguments are copied
+// Note: zutil::Logger keeps logging synchronously, both write to stdout
+// ---
+struct AsyncLog final {
+    AsyncLog() = delete;
+
+    [[nodiscard]] static std::byte* _Reserve(const _LogRecord& record) noexcept;
+    static void _Commit() noexcept;
+
+    // Frame counter behind the DULL_LOG_EVERY_N_FRAMES macros, App advances it
+    static void _BeginFrame() noexcept;
+    [[nodiscard]] static uint64_t GetFrameIndex() noexcept;
+
+    // Blocks until every record committed before the call is written
+    static void Flush();
+
+    // Writes records in binary instead of text, decode them with WriteBinaryAsText
+    [[nodiscard]] static bool OpenBinaryOutput(const std::filesystem::path& path);
+    static void CloseBinaryOutput();
+
+    [[nodiscard]] static bool WriteBinaryAsText(const std::filesystem::path& binaryPath, const std::filesystem::path& textPath);
+
+    [[nodiscard]] static uint64_t GetDroppedCount() noexcept;
+};
+
+template <typename... ArgsT>
+void _FormatRecord(std::string_view format, const std::byte* args, std::string& out)
+{
+    const std::byte* cursor = args;
+
+    // Braced init decodes left to right
+    const std::tuple<typename _LogArg<ArgsT>::Decoded...> VALUES {_LogArg<ArgsT>::Decode(cursor)...};
+
+    std::apply([&](const auto&... values) {
+        std::vformat_to(std::back_inserter(out), format, std::make_format_args(values...));
+    }, VALUES);
+}
+
+template <LogArgument... ArgsT>
+void _Write(LogLevel level, std::string_view channel, std::format_string<const ArgsT&...> format, const ArgsT&... args) noexcept
+{
+    const std::string_view FORMAT = format.get();
+
+    const _LogRecord RECORD {
+        0,
+        level,
+        false,
+        static_cast<uint16_t>(channel.size()),
+        static_cast<uint32_t>(FORMAT.size()),
+        static_cast<uint32_t>((size_t {0} + ... + _LogArg<std::decay_t<ArgsT>>::GetSize(args))),
+        channel.data(),
+        FORMAT.data(),
+        &_FormatRecord<std::decay_t<ArgsT>...>,
+        0,
+    };
+
+    std::byte* cursor = AsyncLog::_Reserve(RECORD);
+
+    if (cursor == nullptr) [[unlikely]] return;
+
+    (_LogArg<std::decay_t<ArgsT>>::Encode(cursor, args), ...);
+    AsyncLog::_Commit();
+}
+
+// True once every frameCount frames per call site
+[[nodiscard]] inline bool _ShouldLogEvery(std::atomic<uint64_t>& nextFrame, uint64_t frameCount) noexcept
+{
+    const uint64_t FRAME = AsyncLog::GetFrameIndex();
+    uint64_t expected    = nextFrame.load(std::memory_order_relaxed);
+
+    return FRAME >= expected && nextFrame.compare_exchange_strong(expected, FRAME + frameCount, std::memory_order_relaxed);
+}
+
+} // namespace dull::log
+
+/// MACROS:
+
+#define DULL_LOG_AT(level, channel, ...) ::dull::log::_Write(::dull::log::LogLevel::level, channel, __VA_ARGS__)
+
+#if DULL_LOG_MIN_LEVEL <= 0
+    #define DULL_LOG_TRACE(channel, ...) DULL_LOG_AT(Trace, channel, __VA_ARGS__)
+#else
+    #define DULL_LOG_TRACE(channel, ...) ((void)0)
+#endif
+
+#if DULL_LOG_MIN_LEVEL <= 1
+    #define DULL_LOG_DEBUG(channel, ...) DULL_LOG_AT(Debug, channel, __VA_ARGS__)
+#else
+    #define DULL_LOG_DEBUG(channel, ...) ((void)0)
+#endif
+
+#if DULL_LOG_MIN_LEVEL <= 2
+    #define DULL_LOG_INFO(channel, ...) DULL_LOG_AT(Info, channel, __VA_ARGS__)
+#else
+    #define DULL_LOG_INFO(channel, ...) ((void)0)
+#endif
+
+#if DULL_LOG_MIN_LEVEL <= 3
+    #define DULL_LOG_WARNING(channel, ...) DULL_LOG_AT(Warning, channel, __VA_ARGS__)
+#else
+    #define DULL_LOG_WARNING(channel, ...) ((void)0)
+#endif
+
+#if DULL_LOG_MIN_LEVEL <= 4
+    #define DULL_LOG_ERROR(channel, ...) DULL_LOG_AT(Error, channel, __VA_ARGS__)
+#else
+    #define DULL_LOG_ERROR(channel, ...) ((void)0)
+#endif
+
+// Rate limited forms take one of the macros above, e.g. DULL_LOG_EVERY_N_FRAMES(DULL_LOG_INFO, 60, "[AI]", "{} agents", n)
+#define DULL_LOG_EVERY_N_FRAMES(logMacro, frameCount, channel, ...)                                      \
+    do {                                                                                                 \
+        static ::std::atomic<uint64_t> _dullLogNextFrame {0};                                            \
+        if (::dull::log::_ShouldLogEvery(_dullLogNextFrame, frameCount)) logMacro(channel, __VA_ARGS__); \
+    } while (false)
+
+#define DULL_LOG_ONCE(logMacro, channel, ...)                                                            \
+    do {                                                                                                 \
+        static ::std::atomic<bool> _dullLogIsDone {false};                                               \
+        if (!_dullLogIsDone.exchange(true, ::std::memory_order_relaxed)) logMacro(channel, __VA_ARGS__); \
+    } while (false)
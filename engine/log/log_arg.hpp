@@ -0,0 +1,122 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace dull::log {
+
+// ---
+// Wire encoding of a deferred log argument: a tag byte, then the value
+// Note: strings are copied into the record, everything else is stored by value
+// ---
+enum class _ArgTag : uint8_t {
+    Int,
+    UInt,
+    Float,
+    Double,
+    Bool,
+    Char,
+    String,
+    Pointer,
+};
+
+template <typename ValueT>
+struct _LogArg;
+
+template <typename ValueT, _ArgTag TAG, typename StoredT = ValueT>
+struct _ScalarLogArg {
+    using Decoded = StoredT;
+
+    [[nodiscard]] static constexpr size_t GetSize(const ValueT&) noexcept { return 1 + sizeof(StoredT); }
+
+    static void Encode(std::byte*& cursor, const ValueT& value) noexcept
+    {
+        const StoredT STORED = static_cast<StoredT>(value);
+
+        *cursor++ = static_cast<std::byte>(TAG);
+        std::memcpy(cursor, &STORED, sizeof(StoredT));
+        cursor += sizeof(StoredT);
+    }
+
+    [[nodiscard]] static Decoded Decode(const std::byte*& cursor) noexcept
+    {
+        StoredT stored;
+
+        std::memcpy(&stored, cursor + 1, sizeof(StoredT));
+        cursor += 1 + sizeof(StoredT);
+
+        return stored;
+    }
+};
+
+template <std::signed_integral ValueT>
+struct _LogArg<ValueT> : _ScalarLogArg<ValueT, _ArgTag::Int, int64_t> {};
+
+template <std::unsigned_integral ValueT>
+struct _LogArg<ValueT> : _ScalarLogArg<ValueT, _ArgTag::UInt, uint64_t> {};
+
+template <> struct _LogArg<bool>   : _ScalarLogArg<bool,   _ArgTag::Bool>   {};
+template <> struct _LogArg<char>   : _ScalarLogArg<char,   _ArgTag::Char>   {};
+template <> struct _LogArg<float>  : _ScalarLogArg<float,  _ArgTag::Float>  {};
+template <> struct _LogArg<double> : _ScalarLogArg<double, _ArgTag::Double> {};
+
+template <typename PointeeT>
+    requires (!std::same_as<std::remove_cv_t<PointeeT>, char>)
+struct _LogArg<PointeeT*> {
+    using Decoded = const void*;
+
+    [[nodiscard]] static constexpr size_t GetSize(PointeeT*) noexcept { return 1 + sizeof(uintptr_t); }
+
+    static void Encode(std::byte*& cursor, PointeeT* value) noexcept
+    {
+        _ScalarLogArg<uintptr_t, _ArgTag::Pointer>::Encode(cursor, reinterpret_cast<uintptr_t>(value));
+    }
+
+    [[nodiscard]] static Decoded Decode(const std::byte*& cursor) noexcept
+    {
+        return reinterpret_cast<const void*>(_ScalarLogArg<uintptr_t, _ArgTag::Pointer>::Decode(cursor));
+    }
+};
+
+struct _StringLogArg {
+    using Decoded = std::string_view;
+
+    [[nodiscard]] static size_t GetSize(std::string_view value) noexcept { return 1 + sizeof(uint32_t) + value.size(); }
+
+    static void Encode(std::byte*& cursor, std::string_view value) noexcept
+    {
+        const uint32_t SIZE = static_cast<uint32_t>(value.size());
+
+        *cursor++ = static_cast<std::byte>(_ArgTag::String);
+        std::memcpy(cursor, &SIZE, sizeof(SIZE));
+        std::memcpy(cursor + sizeof(SIZE), value.data(), value.size());
+        cursor += sizeof(SIZE) + value.size();
+    }
+
+    // Views into the record, valid while it is being formatted
+    [[nodiscard]] static Decoded Decode(const std::byte*& cursor) noexcept
+    {
+        uint32_t size;
+
+        std::memcpy(&size, cursor + 1, sizeof(size));
+        const char* dataPtr = reinterpret_cast<const char*>(cursor + 1 + sizeof(size));
+        cursor += 1 + sizeof(size) + size;
+
+        return {dataPtr, size};
+    }
+};
+
+template <> struct _LogArg<std::string>      : _StringLogArg {};
+template <> struct _LogArg<std::string_view> : _StringLogArg {};
+template <> struct _LogArg<const char*>      : _StringLogArg {};
+template <> struct _LogArg<char*>            : _StringLogArg {};
+
+template <typename ValueT>
+concept LogArgument = requires { typename _LogArg<std::decay_t<ValueT>>::Decoded; };
+
+} // namespace dull::log
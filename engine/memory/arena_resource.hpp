@@ -0,0 +1,36 @@
+#pragma once
+
+#include "engine/memory/linear_arena.hpp"
+
+#include <memory_resource>
+
+namespace dull::memory {
+
+// ---
+// std::pmr adapter over a LinearArena
+// Note: deallocation is a no-op, memory comes back when the arena resets
+// ---
+struct ArenaResource final : public std::pmr::memory_resource {
+private:
+    LinearArena& _arena;
+
+protected:
+    [[nodiscard]] void* do_allocate(size_t bytes, size_t alignment) final
+    {
+        return this->_arena.Allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void*, size_t, size_t) final {}
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept final
+    {
+        return this == &other;
+    }
+
+public:
+    explicit ArenaResource(LinearArena& arena) noexcept : _arena {arena} {}
+
+    [[nodiscard]] LinearArena& GetArena() const noexcept { return this->_arena; }
+};
+
+} // namespace dull::memory
@@ -0,0 +1,16 @@
+#include "engine/memory/frame_arena.hpp"
+
+namespace dull::memory {
+
+FrameArena::FrameArena(size_t capacity)
+    : _arenas {LinearArena {capacity}, LinearArena {capacity}}
+    , _resources {ArenaResource {_arenas[0]}, ArenaResource {_arenas[1]}}
+{}
+
+void FrameArena::_Swap() noexcept
+{
+    this->_currentIndex ^= 1;
+    this->_arenas[this->_currentIndex].Reset();
+}
+
+} // namespace dull::memory
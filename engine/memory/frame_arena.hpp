@@ -0,0 +1,44 @@
+#pragma once
+
+#include "engine/memory/arena_resource.hpp"
+#include "engine/memory/linear_arena.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+// Forward Declaration
+namespace dull::core { struct App; }
+
+namespace dull::memory {
+
+// ---
+// Pair of linear arenas swapped at the start of every frame
+// Note: current frame memory stays valid through the next frame, long enough to hand data across a frame edge
+// ---
+struct FrameArena final {
+    friend core::App;
+
+private:
+    LinearArena   _arenas[2];
+    ArenaResource _resources[2];
+    uint32_t      _currentIndex = 0;
+
+    // Note: resets what was the previous frame's arena, must not race with allocations
+    void _Swap() noexcept;
+
+public:
+    FrameArena(FrameArena&&)                 = delete;
+    FrameArena(const FrameArena&)            = delete;
+    FrameArena& operator=(FrameArena&&)      = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    explicit FrameArena(size_t capacity);
+
+    [[nodiscard]] LinearArena& GetCurrent () noexcept { return this->_arenas[this->_currentIndex];     }
+    [[nodiscard]] LinearArena& GetPrevious() noexcept { return this->_arenas[this->_currentIndex ^ 1]; }
+
+    // For std::pmr containers that live no longer than the next frame
+    [[nodiscard]] std::pmr::memory_resource& GetResource() noexcept { return this->_resources[this->_currentIndex]; }
+};
+
+} // namespace dull::memory
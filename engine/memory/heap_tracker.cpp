@@ -0,0 +1,109 @@
+#include "engine/memory/heap_tracker.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+    #include <malloc.h>
+#endif
+
+namespace dull::memory {
+
+#if DULL_HEAP_TRACKING_ENABLED
+
+static constinit std::atomic<uint64_t> sAllocationCount {0};
+static constinit std::atomic<uint64_t> sFreeCount       {0};
+static constinit std::atomic<uint64_t> sAllocatedBytes  {0};
+
+[[nodiscard]] HeapCounters GetHeapCounters() noexcept
+{
+    return {
+        sAllocationCount.load(std::memory_order_relaxed),
+        sFreeCount.load(std::memory_order_relaxed),
+        sAllocatedBytes.load(std::memory_order_relaxed),
+    };
+}
+
+[[nodiscard]] static void* sTrackedAllocate(size_t size, size_t alignment)
+{
+    if (size == 0) size = 1;
+
+    void* memoryPtr = nullptr;
+
+#if defined(_WIN32)
+    memoryPtr = alignment > alignof(std::max_align_t) ? _aligned_malloc(size, alignment) : std::malloc(size);
+#else
+    memoryPtr = alignment > alignof(std::max_align_t)
+        ? std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1))
+        : std::malloc(size)
+    ;
+#endif
+
+    if (memoryPtr == nullptr) [[unlikely]] throw std::bad_alloc {};
+
+    sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    sAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    return memoryPtr;
+}
+
+static void sTrackedFree(void* memoryPtr, size_t alignment) noexcept
+{
+    if (memoryPtr == nullptr) return;
+
+    sFreeCount.fetch_add(1, std::memory_order_relaxed);
+
+#if defined(_WIN32)
+    if (alignment > alignof(std::max_align_t)) { _aligned_free(memoryPtr); return; }
+#else
+    static_cast<void>(alignment);
+#endif
+
+    std::free(memoryPtr);
+}
+
+#else
+
+[[nodiscard]] HeapCounters GetHeapCounters() noexcept { return {}; }
+
+#endif
+
+} // namespace dull::memory
+
+#if DULL_HEAP_TRACKING_ENABLED
+
+// Array and nothrow forms of the standard library forward to these
+
+void* operator new(size_t size)
+{
+    return dull::memory::sTrackedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    return dull::memory::sTrackedAllocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* memoryPtr) noexcept
+{
+    dull::memory::sTrackedFree(memoryPtr, alignof(std::max_align_t));
+}
+
+void operator delete(void* memoryPtr, std::align_val_t alignment) noexcept
+{
+    dull::memory::sTrackedFree(memoryPtr, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* memoryPtr, size_t) noexcept
+{
+    dull::memory::sTrackedFree(memoryPtr, alignof(std::max_align_t));
+}
+
+void operator delete(void* memoryPtr, size_t, std::align_val_t alignment) noexcept
+{
+    dull::memory::sTrackedFree(memoryPtr, static_cast<size_t>(alignment));
+}
+
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(DULL_TRACK_HEAP_ALLOCATIONS)
+    #define DULL_HEAP_TRACKING_ENABLED 1
+#else
+    #define DULL_HEAP_TRACKING_ENABLED 0
+#endif
+
+namespace dull::memory {
+
+// ---
+// Process-wide global heap totals
+// Note: only counted when built with DULL_TRACK_HEAP_ALLOCATIONS, which replaces the global operator new / delete
+// ---
+struct HeapCounters {
+    uint64_t allocationCount = 0;
+    uint64_t freeCount       = 0;
+    uint64_t allocatedBytes  = 0;
+};
+
+inline constexpr bool IS_HEAP_TRACKING_ENABLED = DULL_HEAP_TRACKING_ENABLED;
+
+// All zero when heap tracking is compiled out
+[[nodiscard]] HeapCounters GetHeapCounters() noexcept;
+
+// ---
+// Memory activity of one frame
+// ---
+struct FrameMemoryStats {
+    uint64_t heapAllocationCount = 0;
+    uint64_t heapAllocatedBytes  = 0;
+    uint64_t arenaUsedBytes      = 0;
+    uint64_t arenaOverflowCount  = 0;
+};
+
+} // namespace dull::memory
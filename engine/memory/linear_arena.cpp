@@ -0,0 +1,83 @@
+#include "engine/memory/linear_arena.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <algorithm>
+#include <bit>
+
+namespace dull::memory {
+
+static constexpr std::align_val_t BUFFER_ALIGNMENT {64};
+
+LinearArena::LinearArena(size_t capacity)
+    : _buffer {static_cast<std::byte*>(::operator new(capacity, BUFFER_ALIGNMENT))}
+    , _capacity {capacity}
+{}
+
+LinearArena::~LinearArena() noexcept
+{
+    this->Reset();
+    ::operator delete(this->_buffer, BUFFER_ALIGNMENT);
+}
+
+[[nodiscard]] void* LinearArena::Allocate(size_t size, size_t alignment)
+{
+    zutil::Assert(std::has_single_bit(alignment), "LinearArena alignment must be a power of two");
+
+    const uintptr_t BASE = reinterpret_cast<uintptr_t>(this->_buffer);
+    size_t offset = this->_offset.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        const size_t ALIGNED_OFFSET = ((BASE + offset + alignment - 1) & ~(alignment - 1)) - BASE;
+        const size_t END_OFFSET     = ALIGNED_OFFSET + size;
+
+        if (END_OFFSET > this->_capacity) [[unlikely]] return this->_AllocateOverflow(size, alignment);
+
+        if (this->_offset.compare_exchange_weak(offset, END_OFFSET, std::memory_order_relaxed))
+            return this->_buffer + ALIGNED_OFFSET;
+    }
+}
+
+[[nodiscard]] void* LinearArena::_AllocateOverflow(size_t size, size_t alignment)
+{
+    const size_t BLOCK_ALIGNMENT = std::max(alignment, alignof(std::max_align_t));
+    void* memoryPtr = ::operator new(std::max<size_t>(size, 1), std::align_val_t {BLOCK_ALIGNMENT});
+
+    std::lock_guard lock {this->_overflowMutex};
+
+    this->_overflowBlocks.push_back({memoryPtr, BLOCK_ALIGNMENT});
+    this->_overflowBytes += size;
+    this->_overflowCount++;
+
+    return memoryPtr;
+}
+
+void LinearArena::Reset() noexcept
+{
+    const size_t USED_BYTES = this->GetUsedBytes();
+
+    for (const _OverflowBlock& block : this->_overflowBlocks)
+        ::operator delete(block.memoryPtr, std::align_val_t {block.alignment});
+
+    // Grow once to cover the whole previous round, steady state then never touches the heap
+    if (!this->_overflowBlocks.empty())
+    {
+        ::operator delete(this->_buffer, BUFFER_ALIGNMENT);
+
+        this->_capacity = std::bit_ceil(USED_BYTES);
+        this->_buffer   = static_cast<std::byte*>(::operator new(this->_capacity, BUFFER_ALIGNMENT));
+    }
+
+    this->_overflowBlocks.clear();
+    this->_overflowBytes = 0;
+    this->_overflowCount = 0;
+    this->_offset.store(0, std::memory_order_relaxed);
+}
+
+[[nodiscard]] size_t LinearArena::GetUsedBytes() const noexcept
+{
+    return this->_offset.load(std::memory_order_relaxed) + this->_overflowBytes;
+}
+
+} // namespace dull::memory
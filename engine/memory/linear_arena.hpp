@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dull::memory {
+
+// ---
+// Bump allocator over one block, everything is released at once by Reset
+// Note: Allocate is lock-free and safe across threads, Reset must not race with it
+// Note: requests past the block spill to the heap, Reset then grows the block so the next round fits
+// ---
+struct LinearArena final {
+private:
+    struct _OverflowBlock {
+        void*  memoryPtr;
+        size_t alignment;
+    };
+
+    std::byte* _buffer = nullptr;
+    size_t _capacity = 0;
+    std::atomic<size_t> _offset {0};
+
+    std::mutex _overflowMutex;
+    std::vector<_OverflowBlock> _overflowBlocks;
+    size_t _overflowBytes = 0;
+    size_t _overflowCount = 0;
+
+    [[nodiscard]] void* _AllocateOverflow(size_t size, size_t alignment);
+
+public:
+    LinearArena(LinearArena&&)                 = delete;
+    LinearArena(const LinearArena&)            = delete;
+    LinearArena& operator=(LinearArena&&)      = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    explicit LinearArena(size_t capacity);
+    ~LinearArena() noexcept;
+
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    // Note: destructors never run, so only trivially destructible types are allowed
+    template <typename T, typename... ArgTs>
+        requires std::is_trivially_destructible_v<T>
+    [[nodiscard]] T* New(ArgTs&&... args)
+    {
+        return ::new (this->Allocate(sizeof(T), alignof(T))) T(std::forward<ArgTs>(args)...);
+    }
+
+    // Value initialized array, valid until the next Reset
+    template <typename T>
+        requires std::is_trivially_destructible_v<T>
+    [[nodiscard]] std::span<T> NewArray(size_t count)
+    {
+        T* elements = static_cast<T*>(this->Allocate(sizeof(T) * count, alignof(T)));
+
+        for (size_t index = 0; index < count; index++) ::new (elements + index) T();
+
+        return {elements, count};
+    }
+
+    void Reset() noexcept;
+
+    [[nodiscard]] size_t GetCapacity() const noexcept { return this->_capacity; }
+
+    // Allocations that spilled to the heap since the last Reset
+    [[nodiscard]] size_t GetOverflowCount() const noexcept { return this->_overflowCount; }
+
+    // Bytes handed out since the last Reset, alignment padding and overflow included
+    [[nodiscard]] size_t GetUsedBytes() const noexcept;
+};
+
+} // namespace dull::memory
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace dull::memory {
+
+// ---
+// Fixed-size slots for one object type, recycled through an intrusive free list
+// Note: pages of PAGE_SIZE slots come from the upstream resource and are kept until the pool dies
+// Note: not thread-safe, give every worker its own pool
+// ---
+template <typename T, size_t PAGE_SIZE = 64>
+    requires (PAGE_SIZE > 0)
+struct ObjectPool final {
+private:
+    union _Slot {
+        _Slot* nextFreePtr;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    std::pmr::memory_resource* _upstreamPtr;
+    std::pmr::vector<_Slot*> _pages;
+    _Slot* _freeListPtr = nullptr;
+    size_t _liveCount   = 0;
+
+    void _AddPage()
+    {
+        _Slot* page = static_cast<_Slot*>(this->_upstreamPtr->allocate(sizeof(_Slot) * PAGE_SIZE, alignof(_Slot)));
+
+        this->_pages.push_back(page);
+
+        for (size_t index = PAGE_SIZE; index-- > 0;)
+        {
+            page[index].nextFreePtr = this->_freeListPtr;
+            this->_freeListPtr = &page[index];
+        }
+    }
+
+public:
+    ObjectPool(ObjectPool&&)                 = delete;
+    ObjectPool(const ObjectPool&)            = delete;
+    ObjectPool& operator=(ObjectPool&&)      = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    explicit ObjectPool(std::pmr::memory_resource* upstreamPtr = std::pmr::get_default_resource())
+        : _upstreamPtr {upstreamPtr}
+        , _pages {upstreamPtr}
+    {}
+
+    ~ObjectPool() noexcept
+    {
+        zutil::Assert(this->_liveCount == 0, "ObjectPool destroyed with live objects");
+
+        for (_Slot* page : this->_pages)
+            this->_upstreamPtr->deallocate(page, sizeof(_Slot) * PAGE_SIZE, alignof(_Slot));
+    }
+
+    template <typename... ArgTs>
+    [[nodiscard]] T* Create(ArgTs&&... args)
+    {
+        if (this->_freeListPtr == nullptr) [[unlikely]] this->_AddPage();
+
+        _Slot* slot = this->_freeListPtr;
+        this->_freeListPtr = slot->nextFreePtr;
+        this->_liveCount++;
+
+        return ::new (slot->storage) T(std::forward<ArgTs>(args)...);
+    }
+
+    void Destroy(T* objectPtr) noexcept
+    {
+        if (objectPtr == nullptr) return;
+
+        objectPtr->~T();
+
+        _Slot* slot = reinterpret_cast<_Slot*>(objectPtr);
+        slot->nextFreePtr  = this->_freeListPtr;
+        this->_freeListPtr = slot;
+        this->_liveCount--;
+    }
+
+    // Reserves pages up front so the first Create calls don't allocate
+    void Reserve(size_t objectCount)
+    {
+        while (this->GetCapacity() < objectCount) this->_AddPage();
+    }
+
+    [[nodiscard]] size_t GetLiveCount() const noexcept { return this->_liveCount; }
+    [[nodiscard]] size_t GetCapacity () const noexcept { return this->_pages.size() * PAGE_SIZE; }
+};
+
+} // namespace dull::memory
@@ -0,0 +1,743 @@
+#include "engine/nav/nav_grid.hpp"
+#include "engine/job/parallel_for.hpp"
+#include "engine/profile/profiler.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdlib>
+
+namespace dull::nav {
+
+static constexpr uint16_t NIL_LOCAL = std::numeric_limits<uint16_t>::max();
+
+static constexpr uint8_t DIRTY_MARK        = 1 << 0;
+static constexpr uint8_t REBUILT_MARK      = 1 << 1;
+static constexpr uint8_t EAST_BORDER_MARK  = 1 << 2;
+static constexpr uint8_t SOUTH_BORDER_MARK = 1 << 3;
+
+static constexpr std::array<util::Vec2i, 8> DIRECTIONS = {{
+    {1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1},
+}};
+
+// Exact cost between two cells on an empty grid
+[[nodiscard]] static uint32_t sOctile(int32_t deltaX, int32_t deltaY) noexcept
+{
+    const uint32_t DX = static_cast<uint32_t>(std::abs(deltaX));
+    const uint32_t DY = static_cast<uint32_t>(std::abs(deltaY));
+
+    return STRAIGHT_COST * std::max(DX, DY) + (DIAGONAL_COST - STRAIGHT_COST) * std::min(DX, DY);
+}
+
+// Heap order popping the lowest estimate first, the deepest entry on ties
+static constexpr auto OPEN_ORDER = [](const auto& left, const auto& right) noexcept {
+    return left.estimate != right.estimate ? left.estimate > right.estimate : left.cost < right.cost;
+};
+
+NavGrid::NavGrid(const NavGridConfig& config)
+    : _config {config}
+{
+    zutil::Assert(config.width > 0 && config.height > 0, "Nav grid needs a positive size");
+    zutil::Assert(config.clusterSize >= 4 && config.clusterSize <= 128, "Nav grid cluster size must be between 4 and 128");
+
+    this->_clusterCountX = (config.width + config.clusterSize - 1) / config.clusterSize;
+    this->_clusterCountY = (config.height + config.clusterSize - 1) / config.clusterSize;
+
+    const size_t CLUSTER_COUNT = static_cast<size_t>(this->_clusterCountX) * this->_clusterCountY;
+
+    this->_cells.assign(static_cast<size_t>(config.width) * config.height, 1);
+    this->_clusters.resize(CLUSTER_COUNT);
+    this->_eastBorders.resize(CLUSTER_COUNT);
+    this->_southBorders.resize(CLUSTER_COUNT);
+    this->_clusterMarks.assign(CLUSTER_COUNT, 0);
+
+    for (uint32_t index = 0; index < CLUSTER_COUNT; index++)
+    {
+        _Cluster& cluster = this->_clusters[index];
+        cluster.originX = static_cast<int32_t>(index % this->_clusterCountX) * config.clusterSize;
+        cluster.originY = static_cast<int32_t>(index / this->_clusterCountX) * config.clusterSize;
+        cluster.width   = std::min(config.clusterSize, config.width - cluster.originX);
+        cluster.height  = std::min(config.clusterSize, config.height - cluster.originY);
+
+        this->_MarkDirty(index);
+    }
+}
+
+bool NavGrid::SetWalkable(int32_t x, int32_t y, bool isWalkable)
+{
+    if (!this->IsInside(x, y)) return false;
+
+    uint8_t& cell = this->_cells[y * this->_config.width + x];
+
+    if ((cell != 0) == isWalkable) return true;
+
+    cell = isWalkable ? 1 : 0;
+    this->_MarkDirty(this->GetClusterIndex(x, y));
+    return true;
+}
+
+void NavGrid::_MarkDirty(uint32_t cluster)
+{
+    if ((this->_clusterMarks[cluster] & DIRTY_MARK) != 0) return;
+
+    this->_clusterMarks[cluster] |= DIRTY_MARK;
+    this->_dirtyClusters.push_back(cluster);
+}
+
+void NavGrid::Rebuild(job::ThreadPool* threadPoolPtr)
+{
+    DULL_PROFILE_ZONE("NavGrid::Rebuild");
+
+    this->_rebuiltClusters.clear();
+
+    if (this->_dirtyClusters.empty()) return;
+
+    const auto MARK_REBUILT = [this](uint32_t cluster) {
+        if ((this->_clusterMarks[cluster] & REBUILT_MARK) != 0) return;
+
+        this->_clusterMarks[cluster] |= REBUILT_MARK;
+        this->_rebuiltClusters.push_back(cluster);
+    };
+
+    const auto REBUILD_BORDER = [this](uint32_t cluster, bool isEast) {
+        const uint8_t MARK = isEast ? EAST_BORDER_MARK : SOUTH_BORDER_MARK;
+
+        if ((this->_clusterMarks[cluster] & MARK) != 0) return;
+
+        this->_clusterMarks[cluster] |= MARK;
+        this->_RebuildBorder(cluster, isEast);
+    };
+
+    const uint32_t COUNT_X = static_cast<uint32_t>(this->_clusterCountX);
+    const uint32_t COUNT_Y = static_cast<uint32_t>(this->_clusterCountY);
+
+    // Entrances on every side of a dirty cluster change, so do the links of the neighbours sharing them
+    for (const uint32_t CLUSTER : this->_dirtyClusters)
+    {
+        const uint32_t X = CLUSTER % COUNT_X;
+        const uint32_t Y = CLUSTER / COUNT_X;
+
+        MARK_REBUILT(CLUSTER);
+
+        if (X + 1 < COUNT_X) { REBUILD_BORDER(CLUSTER, true);            MARK_REBUILT(CLUSTER + 1);       }
+        if (Y + 1 < COUNT_Y) { REBUILD_BORDER(CLUSTER, false);           MARK_REBUILT(CLUSTER + COUNT_X); }
+        if (X > 0)           { REBUILD_BORDER(CLUSTER - 1, true);        MARK_REBUILT(CLUSTER - 1);       }
+        if (Y > 0)           { REBUILD_BORDER(CLUSTER - COUNT_X, false); MARK_REBUILT(CLUSTER - COUNT_X); }
+    }
+
+    for (const uint32_t CLUSTER : this->_rebuiltClusters) this->_GatherNodes(CLUSTER);
+
+    // Clusters only write their own tables, so they link independently
+    const auto LINK_CLUSTERS = [this](size_t begin, size_t end) {
+        NavScratch scratch;
+
+        for (size_t index = begin; index < end; index++) this->_LinkNodes(this->_clusters[this->_rebuiltClusters[index]], scratch);
+    };
+
+    if (threadPoolPtr != nullptr) job::ParallelFor(*threadPoolPtr, this->_rebuiltClusters.size(), LINK_CLUSTERS, 4);
+    else LINK_CLUSTERS(0, this->_rebuiltClusters.size());
+
+    for (const uint32_t CLUSTER : this->_rebuiltClusters) this->_clusterMarks[CLUSTER] = 0;
+    this->_dirtyClusters.clear();
+}
+
+[[nodiscard]] uint32_t NavGrid::_AllocateNode(uint32_t cell, uint32_t cluster)
+{
+    uint32_t node = 0;
+
+    if (this->_freeNodes.empty())
+    {
+        node = static_cast<uint32_t>(this->_nodes.size());
+        this->_nodes.emplace_back();
+    }
+    else
+    {
+        node = this->_freeNodes.back();
+        this->_freeNodes.pop_back();
+    }
+
+    this->_nodes[node] = {cell, cluster, NIL_NODE, 0};
+    return node;
+}
+
+void NavGrid::_FreeNode(uint32_t node) noexcept
+{
+    this->_nodes[node].cluster = NIL_NODE;
+    this->_nodes[node].twin    = NIL_NODE;
+    this->_freeNodes.push_back(node);
+}
+
+void NavGrid::_RebuildBorder(uint32_t cluster, bool isEast)
+{
+    std::vector<uint32_t>& border = isEast ? this->_eastBorders[cluster] : this->_southBorders[cluster];
+
+    for (const uint32_t NODE : border)
+    {
+        this->_FreeNode(this->_nodes[NODE].twin);
+        this->_FreeNode(NODE);
+    }
+
+    border.clear();
+
+    const _Cluster& CLUSTER   = this->_clusters[cluster];
+    const uint32_t  NEIGHBOUR = isEast ? cluster + 1 : cluster + static_cast<uint32_t>(this->_clusterCountX);
+    const int32_t   LENGTH    = isEast ? CLUSTER.height : CLUSTER.width;
+    const int32_t   STEP_X    = isEast ? 1 : 0;
+    const int32_t   STEP_Y    = isEast ? 0 : 1;
+    const int32_t   WIDTH     = this->_config.width;
+
+    const auto INSIDE = [&CLUSTER, isEast](int32_t offset) -> util::Vec2i {
+        return isEast ? util::Vec2i {CLUSTER.originX + CLUSTER.width - 1, CLUSTER.originY + offset}
+                      : util::Vec2i {CLUSTER.originX + offset, CLUSTER.originY + CLUSTER.height - 1};
+    };
+
+    const auto ADD_ENTRANCE = [&](int32_t offset) {
+        const util::Vec2i CELL = INSIDE(offset);
+        const uint32_t INSIDE_NODE  = this->_AllocateNode(static_cast<uint32_t>(CELL.y * WIDTH + CELL.x), cluster);
+        const uint32_t OUTSIDE_NODE = this->_AllocateNode(static_cast<uint32_t>((CELL.y + STEP_Y) * WIDTH + CELL.x + STEP_X), NEIGHBOUR);
+
+        this->_nodes[INSIDE_NODE].twin  = OUTSIDE_NODE;
+        this->_nodes[OUTSIDE_NODE].twin = INSIDE_NODE;
+        border.push_back(INSIDE_NODE);
+    };
+
+    int32_t runStart = -1;
+
+    // Runs where both sides are open, one past the end closes the last run
+    for (int32_t offset = 0; offset <= LENGTH; offset++)
+    {
+        const util::Vec2i CELL = offset < LENGTH ? INSIDE(offset) : util::Vec2i {-1, -1};
+        const bool IS_OPEN = offset < LENGTH && this->_IsOpen(CELL.x, CELL.y) && this->_IsOpen(CELL.x + STEP_X, CELL.y + STEP_Y);
+
+        if (IS_OPEN)
+        {
+            if (runStart < 0) runStart = offset;
+            continue;
+        }
+
+        if (runStart < 0) continue;
+
+        const int32_t RUN_END = offset - 1;
+
+        if (RUN_END - runStart + 1 >= WIDE_ENTRANCE)
+        {
+            ADD_ENTRANCE(runStart);
+            ADD_ENTRANCE(RUN_END);
+        }
+        else ADD_ENTRANCE((runStart + RUN_END) / 2);
+
+        runStart = -1;
+    }
+}
+
+void NavGrid::_GatherNodes(uint32_t cluster)
+{
+    _Cluster& target = this->_clusters[cluster];
+    target.nodes.clear();
+
+    const auto ADD = [this, &target](uint32_t node) {
+        this->_nodes[node].localIndex = static_cast<uint32_t>(target.nodes.size());
+        target.nodes.push_back(node);
+    };
+
+    const uint32_t X = cluster % static_cast<uint32_t>(this->_clusterCountX);
+    const uint32_t Y = cluster / static_cast<uint32_t>(this->_clusterCountX);
+
+    for (const uint32_t NODE : this->_eastBorders[cluster]) ADD(NODE);
+    for (const uint32_t NODE : this->_southBorders[cluster]) ADD(NODE);
+
+    if (X > 0) for (const uint32_t NODE : this->_eastBorders[cluster - 1]) ADD(this->_nodes[NODE].twin);
+    if (Y > 0) for (const uint32_t NODE : this->_southBorders[cluster - this->_clusterCountX]) ADD(this->_nodes[NODE].twin);
+}
+
+void NavGrid::_NextLocalStamp(NavScratch& scratch, size_t cellCount)
+{
+    if (scratch._localCosts.size() < cellCount)
+    {
+        scratch._localCosts.resize(cellCount);
+        scratch._localParents.resize(cellCount);
+        scratch._localStamps.resize(cellCount, 0);
+        scratch._targetStamps.resize(cellCount, 0);
+    }
+
+    // Stamps tell visited cells apart without clearing, they only get wiped when the counter wraps
+    if (++scratch._localStamp == 0)
+    {
+        std::ranges::fill(scratch._localStamps, 0);
+        std::ranges::fill(scratch._targetStamps, 0);
+        scratch._localStamp = 1;
+    }
+}
+
+void NavGrid::_NextNodeStamp(NavScratch& scratch) const
+{
+    if (scratch._nodeCosts.size() < this->_nodes.size())
+    {
+        scratch._nodeCosts.resize(this->_nodes.size());
+        scratch._nodeParents.resize(this->_nodes.size());
+        scratch._nodeStamps.resize(this->_nodes.size(), 0);
+    }
+
+    if (++scratch._nodeStamp == 0)
+    {
+        std::ranges::fill(scratch._nodeStamps, 0);
+        scratch._nodeStamp = 1;
+    }
+}
+
+[[nodiscard]] bool NavGrid::_SearchCluster(NavScratch& scratch, const _Cluster& cluster, uint32_t fromLocal, uint32_t goalLocal, uint32_t targetCount) const
+{
+    const uint32_t STAMP    = scratch._localStamp;
+    const int32_t  WIDTH    = cluster.width;
+    const bool     HAS_GOAL = goalLocal != NIL_NODE;
+    const int32_t  GOAL_X   = HAS_GOAL ? static_cast<int32_t>(goalLocal % WIDTH) : 0;
+    const int32_t  GOAL_Y   = HAS_GOAL ? static_cast<int32_t>(goalLocal / WIDTH) : 0;
+
+    const auto HEURISTIC = [&](int32_t localX, int32_t localY) {
+        return HAS_GOAL ? sOctile(GOAL_X - localX, GOAL_Y - localY) : 0U;
+    };
+
+    std::vector<NavScratch::_OpenEntry>& open = scratch._open;
+    open.clear();
+
+    scratch._localCosts[fromLocal]   = 0;
+    scratch._localParents[fromLocal] = NIL_LOCAL;
+    scratch._localStamps[fromLocal]  = STAMP;
+    open.push_back({HEURISTIC(static_cast<int32_t>(fromLocal % WIDTH), static_cast<int32_t>(fromLocal / WIDTH)), 0, fromLocal});
+
+    while (!open.empty())
+    {
+        std::ranges::pop_heap(open, OPEN_ORDER);
+        const NavScratch::_OpenEntry ENTRY = open.back();
+        open.pop_back();
+
+        // Improved after it was queued
+        if (ENTRY.cost != scratch._localCosts[ENTRY.index]) continue;
+
+        if (HAS_GOAL)
+        {
+            if (ENTRY.index == goalLocal) return true;
+        }
+        else if (scratch._targetStamps[ENTRY.index] == STAMP && --targetCount == 0) return true;
+
+        const int32_t LOCAL_X = static_cast<int32_t>(ENTRY.index % WIDTH);
+        const int32_t LOCAL_Y = static_cast<int32_t>(ENTRY.index / WIDTH);
+
+        for (uint32_t moves = cluster.moves[ENTRY.index]; moves != 0; moves &= moves - 1)
+        {
+            const uint32_t    DIRECTION_INDEX = static_cast<uint32_t>(std::countr_zero(moves));
+            const util::Vec2i DIRECTION       = DIRECTIONS[DIRECTION_INDEX];
+
+            const uint32_t NEXT = static_cast<uint32_t>(static_cast<int32_t>(ENTRY.index) + DIRECTION.y * WIDTH + DIRECTION.x);
+            const uint32_t COST = ENTRY.cost + (DIRECTION.x != 0 && DIRECTION.y != 0 ? DIAGONAL_COST : STRAIGHT_COST);
+
+            if (scratch._localStamps[NEXT] == STAMP && COST >= scratch._localCosts[NEXT]) continue;
+
+            scratch._localCosts[NEXT]   = COST;
+            scratch._localParents[NEXT] = static_cast<uint16_t>(ENTRY.index);
+            scratch._localStamps[NEXT]  = STAMP;
+
+            open.push_back({COST + HEURISTIC(LOCAL_X + DIRECTION.x, LOCAL_Y + DIRECTION.y), COST, NEXT});
+            std::ranges::push_heap(open, OPEN_ORDER);
+        }
+    }
+
+    return false;
+}
+
+void NavGrid::_BuildMoves(_Cluster& cluster) const
+{
+    cluster.moves.assign(static_cast<size_t>(cluster.width) * cluster.height, 0);
+
+    for (int32_t localY = 0; localY < cluster.height; localY++)
+    {
+        for (int32_t localX = 0; localX < cluster.width; localX++)
+        {
+            const int32_t X = cluster.originX + localX;
+            const int32_t Y = cluster.originY + localY;
+
+            if (!this->_IsOpen(X, Y)) continue;
+
+            uint8_t moves = 0;
+
+            for (uint32_t index = 0; index < DIRECTIONS.size(); index++)
+            {
+                const util::Vec2i DIRECTION = DIRECTIONS[index];
+                const int32_t NEXT_X = localX + DIRECTION.x;
+                const int32_t NEXT_Y = localY + DIRECTION.y;
+
+                if (NEXT_X < 0 || NEXT_Y < 0 || NEXT_X >= cluster.width || NEXT_Y >= cluster.height) continue;
+                if (!this->_IsOpen(X + DIRECTION.x, Y + DIRECTION.y)) continue;
+
+                // No cutting corners
+                if (DIRECTION.x != 0 && DIRECTION.y != 0 && (!this->_IsOpen(X + DIRECTION.x, Y) || !this->_IsOpen(X, Y + DIRECTION.y))) continue;
+
+                moves |= static_cast<uint8_t>(1U << index);
+            }
+
+            cluster.moves[localY * cluster.width + localX] = moves;
+        }
+    }
+}
+
+void NavGrid::_LinkNodes(_Cluster& cluster, NavScratch& scratch) const
+{
+    this->_BuildMoves(cluster);
+
+    const size_t COUNT = cluster.nodes.size();
+
+    cluster.costs.assign(COUNT * COUNT, NIL_COST);
+    cluster.pathBegins.assign(COUNT * COUNT, 0);
+    cluster.pathCells.clear();
+
+    const auto TO_LOCAL = [this, &cluster](uint32_t node) {
+        const util::Vec2i POSITION = this->_GetCellPosition(this->_nodes[node].cell);
+        return static_cast<uint32_t>((POSITION.y - cluster.originY) * cluster.width + POSITION.x - cluster.originX);
+    };
+
+    for (size_t from = 0; from < COUNT; from++)
+    {
+        cluster.costs[from * COUNT + from] = 0;
+
+        if (from + 1 == COUNT) break;
+
+        _NextLocalStamp(scratch, static_cast<size_t>(cluster.width) * cluster.height);
+
+        const uint32_t STAMP = scratch._localStamp;
+        uint32_t targetCount = 0;
+
+        for (size_t to = from + 1; to < COUNT; to++)
+        {
+            const uint32_t TARGET = TO_LOCAL(cluster.nodes[to]);
+
+            if (scratch._targetStamps[TARGET] == STAMP) continue;
+
+            scratch._targetStamps[TARGET] = STAMP;
+            targetCount++;
+        }
+
+        const uint32_t FROM_LOCAL = TO_LOCAL(cluster.nodes[from]);
+        (void)this->_SearchCluster(scratch, cluster, FROM_LOCAL, NIL_NODE, targetCount);
+
+        for (size_t to = from + 1; to < COUNT; to++)
+        {
+            const uint32_t TARGET = TO_LOCAL(cluster.nodes[to]);
+
+            if (scratch._localStamps[TARGET] != STAMP) continue;
+
+            cluster.costs[from * COUNT + to] = scratch._localCosts[TARGET];
+            cluster.costs[to * COUNT + from] = scratch._localCosts[TARGET];
+            cluster.pathBegins[from * COUNT + to] = static_cast<uint32_t>(cluster.pathCells.size());
+
+            // Length first, then the cells walked back from the target and flipped
+            const size_t LENGTH_SLOT = cluster.pathCells.size();
+            cluster.pathCells.push_back(0);
+
+            for (uint16_t local = static_cast<uint16_t>(TARGET); local != NIL_LOCAL; local = scratch._localParents[local])
+                cluster.pathCells.push_back(local);
+
+            std::reverse(cluster.pathCells.begin() + static_cast<std::ptrdiff_t>(LENGTH_SLOT) + 1, cluster.pathCells.end());
+            cluster.pathCells[LENGTH_SLOT] = static_cast<uint16_t>(cluster.pathCells.size() - LENGTH_SLOT - 1);
+        }
+    }
+
+    // A link matched by a detour over another entrance adds nothing to the search, the detour is taken instead
+    // Note: zero cost links between entrances sharing a cell never count as detours, so links can't cover each other
+    cluster.linkBegins.assign(COUNT + 1, 0);
+    cluster.links.clear();
+
+    for (size_t from = 0; from < COUNT; from++)
+    {
+        cluster.linkBegins[from] = static_cast<uint32_t>(cluster.links.size());
+
+        for (size_t to = 0; to < COUNT; to++)
+        {
+            const uint32_t COST = cluster.costs[from * COUNT + to];
+
+            if (to == from || COST == NIL_COST) continue;
+
+            bool isCovered = false;
+
+            for (size_t over = 0; over < COUNT && !isCovered; over++)
+            {
+                const uint32_t FIRST  = cluster.costs[from * COUNT + over];
+                const uint32_t SECOND = cluster.costs[over * COUNT + to];
+
+                isCovered = FIRST != 0 && SECOND != 0 && FIRST != NIL_COST && SECOND != NIL_COST && FIRST + SECOND == COST;
+            }
+
+            if (!isCovered) cluster.links.push_back(static_cast<uint32_t>(to));
+        }
+    }
+
+    cluster.linkBegins[COUNT] = static_cast<uint32_t>(cluster.links.size());
+}
+
+[[nodiscard]] bool NavGrid::_AppendLocalPath(
+    NavScratch& scratch, uint32_t cluster, uint32_t fromCell, uint32_t toCell, std::vector<util::Vec2i>& cells, uint32_t& cost
+) const
+{
+    if (fromCell == toCell) return true;
+
+    const _Cluster& CLUSTER = this->_clusters[cluster];
+
+    const auto TO_LOCAL = [this, &CLUSTER](uint32_t cell) {
+        const util::Vec2i POSITION = this->_GetCellPosition(cell);
+        return static_cast<uint32_t>((POSITION.y - CLUSTER.originY) * CLUSTER.width + POSITION.x - CLUSTER.originX);
+    };
+
+    const uint32_t FROM_LOCAL = TO_LOCAL(fromCell);
+    const uint32_t TO_LOCAL_INDEX = TO_LOCAL(toCell);
+
+    _NextLocalStamp(scratch, static_cast<size_t>(CLUSTER.width) * CLUSTER.height);
+
+    if (!this->_SearchCluster(scratch, CLUSTER, FROM_LOCAL, TO_LOCAL_INDEX, 0)) return false;
+
+    cost += scratch._localCosts[TO_LOCAL_INDEX];
+
+    scratch._segment.clear();
+
+    for (uint16_t local = static_cast<uint16_t>(TO_LOCAL_INDEX); local != FROM_LOCAL; local = scratch._localParents[local])
+        scratch._segment.push_back(local);
+
+    for (auto it = scratch._segment.rbegin(); it != scratch._segment.rend(); ++it)
+        cells.push_back({CLUSTER.originX + *it % CLUSTER.width, CLUSTER.originY + *it / CLUSTER.width});
+
+    return true;
+}
+
+void NavGrid::_AppendStoredPath(const _Cluster& cluster, uint32_t fromSlot, uint32_t toSlot, std::vector<util::Vec2i>& cells) const
+{
+    const size_t   COUNT  = cluster.nodes.size();
+    const uint32_t BEGIN  = cluster.pathBegins[std::min(fromSlot, toSlot) * COUNT + std::max(fromSlot, toSlot)];
+    const uint32_t LENGTH = cluster.pathCells[BEGIN];
+
+    const auto PUSH = [&cells, &cluster](uint16_t local) {
+        cells.push_back({cluster.originX + local % cluster.width, cluster.originY + local / cluster.width});
+    };
+
+    // The first cell of the walk is already in the path
+    if (fromSlot < toSlot) for (uint32_t step = 1; step < LENGTH; step++) PUSH(cluster.pathCells[BEGIN + 1 + step]);
+    else for (uint32_t step = LENGTH - 1; step-- > 0;) PUSH(cluster.pathCells[BEGIN + 1 + step]);
+}
+
+[[nodiscard]] bool NavGrid::FindLocalPath(NavScratch& scratch, util::Vec2i start, util::Vec2i goal, std::vector<util::Vec2i>& cells, uint32_t& cost) const
+{
+    if (!this->_IsOpen(start.x, start.y) || !this->_IsOpen(goal.x, goal.y)) return false;
+
+    const uint32_t CLUSTER = this->GetClusterIndex(start.x, start.y);
+
+    if (CLUSTER != this->GetClusterIndex(goal.x, goal.y)) return false;
+
+    const size_t FIRST = cells.size();
+    const int32_t WIDTH = this->_config.width;
+
+    cost = 0;
+    cells.push_back(start);
+
+    if (this->_AppendLocalPath(scratch, CLUSTER, static_cast<uint32_t>(start.y * WIDTH + start.x), static_cast<uint32_t>(goal.y * WIDTH + goal.x), cells, cost))
+        return true;
+
+    cells.resize(FIRST);
+    return false;
+}
+
+[[nodiscard]] bool NavGrid::FindRoute(NavScratch& scratch, util::Vec2i start, util::Vec2i goal, std::vector<uint32_t>& route) const
+{
+    route.clear();
+
+    if (!this->_IsOpen(start.x, start.y) || !this->_IsOpen(goal.x, goal.y)) return false;
+
+    const uint32_t START_CLUSTER = this->GetClusterIndex(start.x, start.y);
+    const uint32_t GOAL_CLUSTER  = this->GetClusterIndex(goal.x, goal.y);
+
+    // Settles every entrance of cluster reachable from cell, true when one is
+    const auto SEARCH_ENTRANCES = [this, &scratch](uint32_t clusterIndex, util::Vec2i cell) {
+        const _Cluster& CLUSTER = this->_clusters[clusterIndex];
+
+        _NextLocalStamp(scratch, static_cast<size_t>(CLUSTER.width) * CLUSTER.height);
+
+        const uint32_t STAMP = scratch._localStamp;
+        uint32_t targetCount = 0;
+
+        for (const uint32_t NODE : CLUSTER.nodes)
+        {
+            const util::Vec2i POSITION = this->_GetCellPosition(this->_nodes[NODE].cell);
+            const uint32_t LOCAL = static_cast<uint32_t>((POSITION.y - CLUSTER.originY) * CLUSTER.width + POSITION.x - CLUSTER.originX);
+
+            if (scratch._targetStamps[LOCAL] == STAMP) continue;
+
+            scratch._targetStamps[LOCAL] = STAMP;
+            targetCount++;
+        }
+
+        if (targetCount == 0) return;
+
+        const uint32_t FROM = static_cast<uint32_t>((cell.y - CLUSTER.originY) * CLUSTER.width + cell.x - CLUSTER.originX);
+        (void)this->_SearchCluster(scratch, CLUSTER, FROM, NIL_NODE, targetCount);
+    };
+
+    const auto ENTRANCE_COST = [this, &scratch](const _Cluster& cluster, uint32_t node) {
+        const util::Vec2i POSITION = this->_GetCellPosition(this->_nodes[node].cell);
+        const uint32_t LOCAL = static_cast<uint32_t>((POSITION.y - cluster.originY) * cluster.width + POSITION.x - cluster.originX);
+
+        return scratch._localStamps[LOCAL] == scratch._localStamp ? scratch._localCosts[LOCAL] : NIL_COST;
+    };
+
+    // Goal side first, the start side seeds the open list the local search shares
+    const _Cluster& GOAL = this->_clusters[GOAL_CLUSTER];
+    SEARCH_ENTRANCES(GOAL_CLUSTER, goal);
+
+    scratch._goalCosts.resize(GOAL.nodes.size());
+    for (size_t slot = 0; slot < GOAL.nodes.size(); slot++) scratch._goalCosts[slot] = ENTRANCE_COST(GOAL, GOAL.nodes[slot]);
+
+    const _Cluster& START = this->_clusters[START_CLUSTER];
+    SEARCH_ENTRANCES(START_CLUSTER, start);
+
+    this->_NextNodeStamp(scratch);
+
+    const uint32_t STAMP = scratch._nodeStamp;
+    std::vector<NavScratch::_OpenEntry>& open = scratch._open;
+    open.clear();
+
+    const auto HEURISTIC = [this, &goal](uint32_t node) {
+        const util::Vec2i POSITION = this->_GetCellPosition(this->_nodes[node].cell);
+        return sOctile(goal.x - POSITION.x, goal.y - POSITION.y);
+    };
+
+    const auto RELAX = [&scratch, &open, &HEURISTIC, STAMP](uint32_t node, uint32_t cost, uint32_t parent) {
+        if (scratch._nodeStamps[node] == STAMP && cost >= scratch._nodeCosts[node]) return;
+
+        scratch._nodeCosts[node]   = cost;
+        scratch._nodeParents[node] = parent;
+        scratch._nodeStamps[node]  = STAMP;
+
+        open.push_back({cost + HEURISTIC(node), cost, node});
+        std::ranges::push_heap(open, OPEN_ORDER);
+    };
+
+    for (const uint32_t NODE : START.nodes)
+    {
+        const uint32_t COST = ENTRANCE_COST(START, NODE);
+        if (COST != NIL_COST) RELAX(NODE, COST, NIL_NODE);
+    }
+
+    uint32_t bestCost = NIL_COST;
+    uint32_t bestNode = NIL_NODE;
+
+    while (!open.empty())
+    {
+        std::ranges::pop_heap(open, OPEN_ORDER);
+        const NavScratch::_OpenEntry ENTRY = open.back();
+        open.pop_back();
+
+        // The heuristic never overestimates, nothing left can beat the best goal link
+        if (ENTRY.estimate >= bestCost) break;
+        if (ENTRY.cost != scratch._nodeCosts[ENTRY.index]) continue;
+
+        const _Node& NODE = this->_nodes[ENTRY.index];
+
+        if (NODE.cluster == GOAL_CLUSTER && scratch._goalCosts[NODE.localIndex] != NIL_COST)
+        {
+            const uint32_t TOTAL = ENTRY.cost + scratch._goalCosts[NODE.localIndex];
+
+            if (TOTAL < bestCost)
+            {
+                bestCost = TOTAL;
+                bestNode = ENTRY.index;
+            }
+        }
+
+        RELAX(NODE.twin, ENTRY.cost + STRAIGHT_COST, ENTRY.index);
+
+        const _Cluster& CLUSTER = this->_clusters[NODE.cluster];
+        const size_t ROW = NODE.localIndex * CLUSTER.nodes.size();
+
+        for (uint32_t link = CLUSTER.linkBegins[NODE.localIndex]; link < CLUSTER.linkBegins[NODE.localIndex + 1]; link++)
+        {
+            const uint32_t SLOT = CLUSTER.links[link];
+            RELAX(CLUSTER.nodes[SLOT], ENTRY.cost + CLUSTER.costs[ROW + SLOT], ENTRY.index);
+        }
+    }
+
+    if (bestNode == NIL_NODE) return false;
+
+    for (uint32_t node = bestNode; node != NIL_NODE; node = scratch._nodeParents[node]) route.push_back(node);
+
+    std::ranges::reverse(route);
+    return true;
+}
+
+[[nodiscard]] bool NavGrid::RefineRoute(
+    NavScratch& scratch, util::Vec2i start, util::Vec2i goal, std::span<const uint32_t> route, std::vector<util::Vec2i>& cells, uint32_t& cost
+) const
+{
+    if (route.empty() || !this->_IsOpen(start.x, start.y) || !this->_IsOpen(goal.x, goal.y)) return false;
+
+    const uint32_t START_CLUSTER = this->GetClusterIndex(start.x, start.y);
+    const uint32_t GOAL_CLUSTER  = this->GetClusterIndex(goal.x, goal.y);
+
+    if (this->GetNodeCluster(route.front()) != START_CLUSTER || this->GetNodeCluster(route.back()) != GOAL_CLUSTER) return false;
+
+    const size_t FIRST = cells.size();
+    const int32_t WIDTH = this->_config.width;
+
+    const auto FAIL = [&cells, FIRST] {
+        cells.resize(FIRST);
+        return false;
+    };
+
+    cost = 0;
+    cells.push_back(start);
+
+    if (!this->_AppendLocalPath(scratch, START_CLUSTER, static_cast<uint32_t>(start.y * WIDTH + start.x), this->_nodes[route.front()].cell, cells, cost))
+        return FAIL();
+
+    for (size_t step = 1; step < route.size(); step++)
+    {
+        const uint32_t FROM = route[step - 1];
+        const uint32_t TO   = route[step];
+
+        if (this->GetNodeCluster(FROM) == NIL_NODE || this->GetNodeCluster(TO) == NIL_NODE) return FAIL();
+
+        const _Node& FROM_NODE = this->_nodes[FROM];
+        const _Node& TO_NODE   = this->_nodes[TO];
+
+        if (FROM_NODE.twin == TO)
+        {
+            cells.push_back(this->_GetCellPosition(TO_NODE.cell));
+            cost += STRAIGHT_COST;
+            continue;
+        }
+
+        if (FROM_NODE.cluster != TO_NODE.cluster) return FAIL();
+
+        const _Cluster& CLUSTER = this->_clusters[FROM_NODE.cluster];
+        const uint32_t EDGE = CLUSTER.costs[FROM_NODE.localIndex * CLUSTER.nodes.size() + TO_NODE.localIndex];
+
+        if (EDGE == NIL_COST) return FAIL();
+
+        cost += EDGE;
+        this->_AppendStoredPath(CLUSTER, FROM_NODE.localIndex, TO_NODE.localIndex, cells);
+    }
+
+    if (!this->_AppendLocalPath(scratch, GOAL_CLUSTER, this->_nodes[route.back()].cell, static_cast<uint32_t>(goal.y * WIDTH + goal.x), cells, cost))
+        return FAIL();
+
+    return true;
+}
+
+[[nodiscard]] bool NavGrid::FindPath(NavScratch& scratch, util::Vec2i start, util::Vec2i goal, std::vector<util::Vec2i>& cells, uint32_t& cost) const
+{
+    if (!this->_IsOpen(start.x, start.y) || !this->_IsOpen(goal.x, goal.y)) return false;
+
+    // A detour out of the cluster only wins when it can't be reached from inside
+    if (this->GetClusterIndex(start.x, start.y) == this->GetClusterIndex(goal.x, goal.y) && this->FindLocalPath(scratch, start, goal, cells, cost))
+        return true;
+
+    return this->FindRoute(scratch, start, goal, scratch._route) && this->RefineRoute(scratch, start, goal, scratch._route, cells, cost);
+}
+
+} // namespace dull::nav
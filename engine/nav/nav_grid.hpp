@@ -0,0 +1,215 @@
+#pragma once
+
+#include "engine/util/vec2.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+// Forward Declaration
+namespace dull::job { struct ThreadPool; }
+
+namespace dull::nav {
+
+// Move costs, diagonals are about sqrt(2) times a straight step
+inline constexpr uint32_t STRAIGHT_COST = 10;
+inline constexpr uint32_t DIAGONAL_COST = 14;
+
+inline constexpr uint32_t NIL_NODE = std::numeric_limits<uint32_t>::max();
+inline constexpr uint32_t NIL_COST = std::numeric_limits<uint32_t>::max();
+
+// ---
+// Size and clustering of a NavGrid
+// ---
+struct NavGridConfig final {
+    int32_t width       = 0; // cells
+    int32_t height      = 0; // cells
+    int32_t clusterSize = 32; // cells per cluster side, between 4 and 128
+};
+
+// ---
+// Per thread search buffers of a NavGrid
+// Note: a scratch serves one search at a time, give every thread searching the same grid its own
+// ---
+struct NavScratch final {
+    friend struct NavGrid;
+
+private:
+    struct _OpenEntry {
+        uint32_t estimate = 0; // cost so far plus heuristic
+        uint32_t cost     = 0;
+        uint32_t index    = 0;
+    };
+
+    // Cells of one cluster
+    std::vector<uint32_t> _localCosts;
+    std::vector<uint16_t> _localParents;
+    std::vector<uint32_t> _localStamps;
+    std::vector<uint32_t> _targetStamps;
+    uint32_t _localStamp = 0;
+
+    // Abstract graph
+    std::vector<uint32_t> _nodeCosts;
+    std::vector<uint32_t> _nodeParents;
+    std::vector<uint32_t> _nodeStamps;
+    std::vector<uint32_t> _goalCosts; // per node of the goal cluster
+    uint32_t _nodeStamp = 0;
+
+    std::vector<_OpenEntry> _open;
+    std::vector<uint16_t> _segment;
+    std::vector<uint32_t> _route;
+};
+
+// ---
+// Walkable grid with a hierarchical A* (HPA*) graph over it
+// Note: the grid is cut into square clusters, every open run along a cluster border gets one or two entrances
+// Note: entrances of a cluster are linked by their shortest path inside it, cost and cells are precomputed
+// Note: a search links start and goal into the graph, runs A* across entrances and stitches the stored paths
+// Note: moves go 8 ways, a diagonal needs both cells it cuts past to be open
+// Note: edits mark their cluster dirty, Rebuild only redoes dirty clusters and their neighbours, searches see edits once it ran
+// Note: searches are const and may run on many threads at once, each with its own scratch, but never during an edit or Rebuild
+// ---
+struct NavGrid final {
+private:
+    // Open runs at least this long get an entrance at each end instead of one in the middle
+    static constexpr int32_t WIDE_ENTRANCE = 6;
+
+    struct _Node {
+        uint32_t cell       = 0;
+        uint32_t cluster    = NIL_NODE; // NIL_NODE while on the free list
+        uint32_t twin       = NIL_NODE; // entrance across the border, a straight step away
+        uint32_t localIndex = 0;        // slot in the cluster node list
+    };
+
+    struct _Cluster {
+        int32_t originX = 0;
+        int32_t originY = 0;
+        int32_t width   = 0;
+        int32_t height  = 0;
+
+        std::vector<uint32_t> nodes;
+
+        // Row major node to node tables, paths are stored once for the lower to the higher slot, both ends included
+        std::vector<uint32_t> costs;
+        std::vector<uint32_t> pathBegins;
+        std::vector<uint16_t> pathCells; // cluster local cell indices
+
+        // Per slot, the links no detour over another entrance matches, the abstract search only walks these
+        std::vector<uint32_t> linkBegins;
+        std::vector<uint32_t> links;
+
+        // Per cell, a bit for every direction that stays inside and cuts no corner
+        std::vector<uint8_t> moves;
+    };
+
+    NavGridConfig _config;
+    int32_t _clusterCountX = 0;
+    int32_t _clusterCountY = 0;
+
+    std::vector<uint8_t> _cells; // 1 when walkable
+    std::vector<_Cluster> _clusters;
+    std::vector<_Node> _nodes;
+    std::vector<uint32_t> _freeNodes;
+
+    // Entrance nodes on the cluster side of its east and south border, twins sit on the neighbour side
+    std::vector<std::vector<uint32_t>> _eastBorders;
+    std::vector<std::vector<uint32_t>> _southBorders;
+
+    std::vector<uint32_t> _dirtyClusters;
+    std::vector<uint32_t> _rebuiltClusters;
+    std::vector<uint8_t>  _clusterMarks;
+
+    [[nodiscard]] bool _IsOpen(int32_t x, int32_t y) const noexcept
+    {
+        return x >= 0 && y >= 0 && x < this->_config.width && y < this->_config.height && this->_cells[y * this->_config.width + x] != 0;
+    }
+
+    [[nodiscard]] util::Vec2i _GetCellPosition(uint32_t cell) const noexcept
+    {
+        return {static_cast<int32_t>(cell % this->_config.width), static_cast<int32_t>(cell / this->_config.width)};
+    }
+
+    static void _NextLocalStamp(NavScratch& scratch, size_t cellCount);
+    void _NextNodeStamp(NavScratch& scratch) const;
+
+    [[nodiscard]] uint32_t _AllocateNode(uint32_t cell, uint32_t cluster);
+    void _FreeNode(uint32_t node) noexcept;
+    void _MarkDirty(uint32_t cluster);
+    void _RebuildBorder(uint32_t cluster, bool isEast);
+    void _GatherNodes(uint32_t cluster);
+    void _BuildMoves(_Cluster& cluster) const;
+    void _LinkNodes(_Cluster& cluster, NavScratch& scratch) const;
+
+    // Searches cluster from fromLocal, straight to goalLocal when given, otherwise until every target stamped in scratch is settled
+    [[nodiscard]] bool _SearchCluster(NavScratch& scratch, const _Cluster& cluster, uint32_t fromLocal, uint32_t goalLocal, uint32_t targetCount) const;
+
+    // Appends the cells after fromCell up to toCell, both inside cluster
+    [[nodiscard]] bool _AppendLocalPath(NavScratch& scratch, uint32_t cluster, uint32_t fromCell, uint32_t toCell, std::vector<util::Vec2i>& cells, uint32_t& cost) const;
+    void _AppendStoredPath(const _Cluster& cluster, uint32_t fromSlot, uint32_t toSlot, std::vector<util::Vec2i>& cells) const;
+
+public:
+    NavGrid(NavGrid&&)                 = delete;
+    NavGrid(const NavGrid&)            = delete;
+    NavGrid& operator=(NavGrid&&)      = delete;
+    NavGrid& operator=(const NavGrid&) = delete;
+
+    // Note: every cell starts walkable, the graph is built by the first Rebuild
+    explicit NavGrid(const NavGridConfig& config);
+
+// --- Cells ---
+
+    [[nodiscard]] bool IsInside(int32_t x, int32_t y) const noexcept
+    {
+        return x >= 0 && y >= 0 && x < this->_config.width && y < this->_config.height;
+    }
+
+    [[nodiscard]] bool IsWalkable(int32_t x, int32_t y) const noexcept { return this->_IsOpen(x, y); }
+
+    // Marks the cluster dirty when the cell changes, false outside the grid
+    bool SetWalkable(int32_t x, int32_t y, bool isWalkable);
+
+    // Rebuilds the graph of every dirty cluster and its neighbours, clusters go wide when a pool is given
+    void Rebuild(job::ThreadPool* threadPoolPtr = nullptr);
+
+    [[nodiscard]] bool IsDirty() const noexcept { return !this->_dirtyClusters.empty(); }
+
+    // Clusters whose entrances or links the last Rebuild replaced
+    [[nodiscard]] std::span<const uint32_t> GetRebuiltClusters() const noexcept { return this->_rebuiltClusters; }
+
+// --- Search ---
+
+    // Shortest path between two cells of one cluster that stays inside it, start and goal included
+    [[nodiscard]] bool FindLocalPath(NavScratch& scratch, util::Vec2i start, util::Vec2i goal, std::vector<util::Vec2i>& cells, uint32_t& cost) const;
+
+    // Entrances an abstract search passes from start to goal, start and goal themselves left out
+    [[nodiscard]] bool FindRoute(NavScratch& scratch, util::Vec2i start, util::Vec2i goal, std::vector<uint32_t>& route) const;
+
+    // Turns a route into cells, start and goal included
+    // Note: false when start or goal can't reach the route inside their cluster, or the route went stale
+    [[nodiscard]] bool RefineRoute(NavScratch& scratch, util::Vec2i start, util::Vec2i goal, std::span<const uint32_t> route, std::vector<util::Vec2i>& cells, uint32_t& cost) const;
+
+    // Local path when start and goal share a cluster, a refined route otherwise
+    [[nodiscard]] bool FindPath(NavScratch& scratch, util::Vec2i start, util::Vec2i goal, std::vector<util::Vec2i>& cells, uint32_t& cost) const;
+
+// --- Graph ---
+
+    [[nodiscard]] const NavGridConfig& GetConfig() const noexcept { return this->_config; }
+
+    [[nodiscard]] uint32_t GetClusterIndex(int32_t x, int32_t y) const noexcept
+    {
+        return static_cast<uint32_t>((y / this->_config.clusterSize) * this->_clusterCountX + x / this->_config.clusterSize);
+    }
+
+    [[nodiscard]] uint32_t GetClusterCount() const noexcept { return static_cast<uint32_t>(this->_clusters.size()); }
+
+    // Cluster of an entrance node, NIL_NODE for a freed one
+    [[nodiscard]] uint32_t GetNodeCluster(uint32_t node) const noexcept
+    {
+        return node < this->_nodes.size() ? this->_nodes[node].cluster : NIL_NODE;
+    }
+
+    [[nodiscard]] size_t GetNodeCount() const noexcept { return this->_nodes.size() - this->_freeNodes.size(); }
+};
+
+} // namespace dull::nav
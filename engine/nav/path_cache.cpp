@@ -0,0 +1,144 @@
+#include "engine/nav/path_cache.hpp"
+#include "engine/nav/nav_grid.hpp"
+
+namespace dull::nav {
+
+PathCache::PathCache(size_t capacity)
+    : _capacity {capacity}
+{
+    this->_entries.reserve(capacity);
+    this->_lookup.reserve(capacity);
+}
+
+void PathCache::_Link(uint32_t index) noexcept
+{
+    _Entry& entry = this->_entries[index];
+    entry.lruPrevious = NIL_ENTRY;
+    entry.lruNext     = this->_lruHead;
+
+    if (this->_lruHead != NIL_ENTRY) this->_entries[this->_lruHead].lruPrevious = index;
+    else this->_lruTail = index;
+
+    this->_lruHead = index;
+}
+
+void PathCache::_Unlink(uint32_t index) noexcept
+{
+    _Entry& entry = this->_entries[index];
+
+    if (entry.lruPrevious != NIL_ENTRY) this->_entries[entry.lruPrevious].lruNext = entry.lruNext;
+    else this->_lruHead = entry.lruNext;
+
+    if (entry.lruNext != NIL_ENTRY) this->_entries[entry.lruNext].lruPrevious = entry.lruPrevious;
+    else this->_lruTail = entry.lruPrevious;
+
+    entry.lruPrevious = NIL_ENTRY;
+    entry.lruNext     = NIL_ENTRY;
+}
+
+void PathCache::_Erase(uint32_t index)
+{
+    this->_Unlink(index);
+    this->_lookup.erase(this->_entries[index].key);
+    this->_entries[index].route.clear();
+    this->_freeEntries.push_back(index);
+}
+
+[[nodiscard]] bool PathCache::Find(uint64_t key, std::vector<uint32_t>& route)
+{
+    const auto FOUND = this->_lookup.find(key);
+
+    if (FOUND == this->_lookup.end()) return false;
+
+    const std::vector<uint32_t>& CACHED = this->_entries[FOUND->second].route;
+    route.assign(CACHED.begin(), CACHED.end());
+
+    if (this->_lruHead != FOUND->second)
+    {
+        this->_Unlink(FOUND->second);
+        this->_Link(FOUND->second);
+    }
+
+    return true;
+}
+
+void PathCache::Insert(uint64_t key, std::span<const uint32_t> route)
+{
+    if (this->_capacity == 0) return;
+
+    const auto FOUND = this->_lookup.find(key);
+    uint32_t index = NIL_ENTRY;
+
+    if (FOUND != this->_lookup.end())
+    {
+        index = FOUND->second;
+        this->_Unlink(index);
+    }
+    else
+    {
+        if (this->_lookup.size() == this->_capacity) this->_Erase(this->_lruTail);
+
+        if (this->_freeEntries.empty())
+        {
+            index = static_cast<uint32_t>(this->_entries.size());
+            this->_entries.emplace_back();
+        }
+        else
+        {
+            index = this->_freeEntries.back();
+            this->_freeEntries.pop_back();
+        }
+
+        this->_entries[index].key = key;
+        this->_lookup.emplace(key, index);
+    }
+
+    // Evicted entries keep their route capacity
+    this->_entries[index].route.assign(route.begin(), route.end());
+    this->_Link(index);
+}
+
+size_t PathCache::Invalidate(const NavGrid& grid)
+{
+    if (grid.GetRebuiltClusters().empty() || this->_lookup.empty()) return 0;
+
+    std::vector<uint8_t> isRebuilt(grid.GetClusterCount(), 0);
+    for (const uint32_t CLUSTER : grid.GetRebuiltClusters()) isRebuilt[CLUSTER] = 1;
+
+    size_t erasedCount = 0;
+
+    for (uint32_t index = this->_lruHead; index != NIL_ENTRY;)
+    {
+        const uint32_t NEXT = this->_entries[index].lruNext;
+
+        for (const uint32_t NODE : this->_entries[index].route)
+        {
+            const uint32_t CLUSTER = grid.GetNodeCluster(NODE);
+
+            if (CLUSTER == NIL_NODE || isRebuilt[CLUSTER] != 0)
+            {
+                this->_Erase(index);
+                erasedCount++;
+                break;
+            }
+        }
+
+        index = NEXT;
+    }
+
+    return erasedCount;
+}
+
+void PathCache::Clear()
+{
+    for (_Entry& entry : this->_entries) entry.route.clear();
+
+    this->_freeEntries.clear();
+    for (uint32_t index = static_cast<uint32_t>(this->_entries.size()); index-- > 0;) this->_freeEntries.push_back(index);
+
+    this->_lookup.clear();
+    this->_lruHead = NIL_ENTRY;
+    this->_lruTail = NIL_ENTRY;
+}
+
+} // namespace dull::nav
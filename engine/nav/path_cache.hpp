@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace dull::nav {
+
+// Forward Declaration
+struct NavGrid;
+
+// ---
+// Least recently used entrance routes keyed by their start and goal cluster
+// Note: holds at most capacity routes, inserting into a full cache drops the least recently used one
+// Note: not synchronized, PathService guards it
+// ---
+struct PathCache final {
+private:
+    static constexpr uint32_t NIL_ENTRY = std::numeric_limits<uint32_t>::max();
+
+    struct _Entry {
+        uint64_t key = 0;
+        std::vector<uint32_t> route;
+        uint32_t lruPrevious = NIL_ENTRY;
+        uint32_t lruNext     = NIL_ENTRY;
+    };
+
+    std::vector<_Entry> _entries;
+    std::vector<uint32_t> _freeEntries;
+    std::unordered_map<uint64_t, uint32_t> _lookup;
+
+    uint32_t _lruHead  = NIL_ENTRY; // most recently used
+    uint32_t _lruTail  = NIL_ENTRY;
+    size_t   _capacity = 0;
+
+    void _Link(uint32_t index) noexcept;
+    void _Unlink(uint32_t index) noexcept;
+    void _Erase(uint32_t index);
+
+public:
+    // Note: a capacity of 0 turns caching off
+    explicit PathCache(size_t capacity);
+
+    [[nodiscard]] static uint64_t MakeKey(uint32_t startCluster, uint32_t goalCluster) noexcept
+    {
+        return static_cast<uint64_t>(startCluster) << 32 | goalCluster;
+    }
+
+    // Copies the route out and marks it most recently used
+    [[nodiscard]] bool Find(uint64_t key, std::vector<uint32_t>& route);
+
+    // Replaces the route of a key already cached
+    void Insert(uint64_t key, std::span<const uint32_t> route);
+
+    // Drops every route with an entrance in a cluster grid just rebuilt, returns how many
+    // Note: run right after the rebuild, freed entrances are only reused inside rebuilt clusters
+    size_t Invalidate(const NavGrid& grid);
+
+    void Clear();
+
+    [[nodiscard]] size_t GetCount() const noexcept { return this->_lookup.size(); }
+    [[nodiscard]] size_t GetCapacity() const noexcept { return this->_capacity; }
+};
+
+} // namespace dull::nav
@@ -0,0 +1,242 @@
+#include "engine/nav/path_service.hpp"
+#include "engine/job/thread_pool.hpp"
+#include "engine/profile/profiler.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+namespace dull::nav {
+
+PathService::PathService(const PathServiceConfig& config, job::ThreadPool* threadPoolPtr)
+    : _grid {config.grid}
+    , _threadPoolPtr {threadPoolPtr}
+    , _cache {config.cacheCapacity}
+{
+    const uint32_t SOLVER_COUNT = threadPoolPtr != nullptr ? threadPoolPtr->GetThreadCount() : 1;
+
+    for (uint32_t solver = 0; solver < SOLVER_COUNT; solver++) this->_solvers.emplace_back(std::make_unique<_Solver>());
+}
+
+PathService::~PathService() noexcept
+{
+    if (this->_isWaveRunning) this->_threadPoolPtr->Wait(this->_pendingCount);
+}
+
+void PathService::Submit(std::span<const PathQuery> queries, PathCallback callback)
+{
+    if (queries.empty()) return;
+
+    this->_queuedBatches.push_back({this->_queuedQueries.size(), queries.size(), std::move(callback)});
+    this->_queuedQueries.insert(this->_queuedQueries.end(), queries.begin(), queries.end());
+}
+
+bool PathService::SetWalkable(int32_t x, int32_t y, bool isWalkable)
+{
+    if (!this->_grid.IsInside(x, y)) return false;
+
+    this->_edits.push_back({x, y, isWalkable});
+    return true;
+}
+
+void PathService::Update()
+{
+    DULL_PROFILE_ZONE("PathService::Update");
+
+    if (this->_isWaveRunning)
+    {
+        if (this->_pendingCount.load(std::memory_order_acquire) != 0) return;
+
+        this->_isWaveRunning = false;
+        this->_Deliver();
+    }
+
+    this->_ApplyEdits();
+
+    if (!this->_queuedBatches.empty()) this->_Launch();
+}
+
+void PathService::WaitAll()
+{
+    do
+    {
+        if (this->_isWaveRunning) this->_threadPoolPtr->Wait(this->_pendingCount);
+        this->Update();
+    }
+    while (this->IsBusy());
+}
+
+void PathService::_ApplyEdits()
+{
+    if (this->_edits.empty() && !this->_grid.IsDirty()) return;
+
+    const double START = this->_clock.INow();
+
+    for (const _Edit& EDIT : this->_edits) (void)this->_grid.SetWalkable(EDIT.x, EDIT.y, EDIT.isWalkable);
+    this->_edits.clear();
+
+    this->_grid.Rebuild(this->_threadPoolPtr);
+
+    {
+        std::lock_guard lock {this->_cacheMutex};
+        (void)this->_cache.Invalidate(this->_grid);
+        this->_stats.cachedRouteCount = this->_cache.GetCount();
+    }
+
+    this->_stats.nodeCount           = this->_grid.GetNodeCount();
+    this->_stats.rebuiltClusterCount = this->_grid.GetRebuiltClusters().size();
+    this->_stats.rebuildMs           = (this->_clock.INow() - START) * 1000.0;
+}
+
+void PathService::_Launch()
+{
+    std::swap(this->_waveQueries, this->_queuedQueries);
+    std::swap(this->_waveBatches, this->_queuedBatches);
+    this->_queuedQueries.clear();
+    this->_queuedBatches.clear();
+
+    this->_outcomes.resize(this->_waveQueries.size());
+    this->_nextChunk.store(0, std::memory_order_relaxed);
+
+    for (const std::unique_ptr<_Solver>& solverPtr : this->_solvers) solverPtr->cells.clear();
+
+    if (this->_threadPoolPtr == nullptr)
+    {
+        this->_RunSolver(0);
+        this->_Deliver();
+        return;
+    }
+
+    const size_t   CHUNK_COUNT  = (this->_waveQueries.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    const uint32_t SOLVER_COUNT = static_cast<uint32_t>(std::min(this->_solvers.size(), CHUNK_COUNT));
+
+    this->_pendingCount.store(SOLVER_COUNT, std::memory_order_relaxed);
+    this->_isWaveRunning = true;
+
+    for (uint32_t solver = 0; solver < SOLVER_COUNT; solver++) this->_threadPoolPtr->Submit([this, solver] { this->_RunSolver(solver); });
+}
+
+void PathService::_RunSolver(uint32_t solverIndex)
+{
+    _Solver& solver = *this->_solvers[solverIndex];
+
+    const size_t QUERY_COUNT = this->_waveQueries.size();
+    const bool   IS_WORKER   = this->_threadPoolPtr == nullptr || this->_threadPoolPtr->GetCurrentWorkerIndex() != this->_threadPoolPtr->GetThreadCount();
+
+    for (size_t chunk = this->_nextChunk.fetch_add(1, std::memory_order_relaxed); chunk * CHUNK_SIZE < QUERY_COUNT;
+         chunk = this->_nextChunk.fetch_add(1, std::memory_order_relaxed))
+    {
+        const size_t END = std::min((chunk + 1) * CHUNK_SIZE, QUERY_COUNT);
+
+        for (size_t query = chunk * CHUNK_SIZE; query < END; query++) this->_Solve(solver, solverIndex, query);
+
+        // Picked up by a thread waiting on other work, it gets back to that after one chunk
+        if (!IS_WORKER)
+        {
+            this->_threadPoolPtr->Submit([this, solverIndex] { this->_RunSolver(solverIndex); });
+            return;
+        }
+    }
+
+    if (this->_threadPoolPtr != nullptr) this->_pendingCount.fetch_sub(1, std::memory_order_release);
+}
+
+void PathService::_Solve(_Solver& solver, uint32_t solverIndex, size_t queryIndex)
+{
+    const PathQuery& QUERY = this->_waveQueries[queryIndex];
+    _Outcome& outcome = this->_outcomes[queryIndex];
+
+    outcome = {solverIndex, static_cast<uint32_t>(solver.cells.size()), 0, 0, false, false};
+
+    const NavGrid& GRID = this->_grid;
+
+    if (!GRID.IsWalkable(QUERY.start.x, QUERY.start.y) || !GRID.IsWalkable(QUERY.goal.x, QUERY.goal.y)) return;
+
+    const uint32_t START_CLUSTER = GRID.GetClusterIndex(QUERY.start.x, QUERY.start.y);
+    const uint32_t GOAL_CLUSTER  = GRID.GetClusterIndex(QUERY.goal.x, QUERY.goal.y);
+    const bool     IS_LOCAL      = START_CLUSTER == GOAL_CLUSTER;
+    const uint64_t KEY           = PathCache::MakeKey(START_CLUSTER, GOAL_CLUSTER);
+
+    // A shared route detours the most on short trips, clusters next to each other always search
+    const int32_t CLUSTER_SIZE = GRID.GetConfig().clusterSize;
+    const bool    IS_CACHED    = !IS_LOCAL
+        && (std::abs(QUERY.start.x / CLUSTER_SIZE - QUERY.goal.x / CLUSTER_SIZE) > 1 || std::abs(QUERY.start.y / CLUSTER_SIZE - QUERY.goal.y / CLUSTER_SIZE) > 1);
+
+    bool isFound = IS_LOCAL && GRID.FindLocalPath(solver.scratch, QUERY.start, QUERY.goal, solver.cells, outcome.cost);
+
+    if (IS_CACHED)
+    {
+        bool isCached = false;
+
+        {
+            std::lock_guard lock {this->_cacheMutex};
+            isCached = this->_cache.Find(KEY, solver.route);
+        }
+
+        // A start or goal walled off from the cached entrances inside its cluster needs a route of its own
+        isFound = isCached && GRID.RefineRoute(solver.scratch, QUERY.start, QUERY.goal, solver.route, solver.cells, outcome.cost);
+        outcome.isCached = isFound;
+
+        if (isFound) solver.hitCount++;
+        else solver.missCount++;
+    }
+
+    if (!isFound)
+    {
+        isFound = GRID.FindRoute(solver.scratch, QUERY.start, QUERY.goal, solver.route)
+               && GRID.RefineRoute(solver.scratch, QUERY.start, QUERY.goal, solver.route, solver.cells, outcome.cost);
+
+        if (isFound && IS_CACHED)
+        {
+            std::lock_guard lock {this->_cacheMutex};
+            this->_cache.Insert(KEY, solver.route);
+        }
+    }
+
+    outcome.isFound   = isFound;
+    outcome.cellCount = static_cast<uint32_t>(solver.cells.size() - outcome.cellBegin);
+}
+
+void PathService::_Deliver()
+{
+    DULL_PROFILE_ZONE("PathService::_Deliver");
+
+    this->_results.resize(this->_waveQueries.size());
+
+    for (size_t index = 0; index < this->_waveQueries.size(); index++)
+    {
+        const _Outcome& OUTCOME = this->_outcomes[index];
+        const std::vector<util::Vec2i>& CELLS = this->_solvers[OUTCOME.solver]->cells;
+
+        this->_results[index] = {
+            this->_waveQueries[index].start,
+            this->_waveQueries[index].goal,
+            std::span<const util::Vec2i> {CELLS.data() + OUTCOME.cellBegin, OUTCOME.cellCount},
+            OUTCOME.cost,
+            OUTCOME.isFound,
+            OUTCOME.isCached,
+        };
+
+        if (OUTCOME.isFound) this->_stats.foundCount++;
+    }
+
+    for (const std::unique_ptr<_Solver>& solverPtr : this->_solvers)
+    {
+        this->_stats.cacheHitCount  += std::exchange(solverPtr->hitCount, 0);
+        this->_stats.cacheMissCount += std::exchange(solverPtr->missCount, 0);
+    }
+
+    this->_stats.queryCount += this->_waveQueries.size();
+
+    {
+        std::lock_guard lock {this->_cacheMutex};
+        this->_stats.cachedRouteCount = this->_cache.GetCount();
+    }
+
+    // Callbacks may queue more work, it lands in the queued lists and waits for the next launch
+    for (_Batch& batch : this->_waveBatches) batch.callback(std::span<const PathResult> {this->_results}.subspan(batch.begin, batch.count));
+
+    this->_waveBatches.clear();
+}
+
+} // namespace dull::nav
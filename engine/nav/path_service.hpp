@@ -0,0 +1,168 @@
+#pragma once
+
+#include "engine/nav/nav_grid.hpp"
+#include "engine/nav/path_cache.hpp"
+#include "engine/platform/i_clock.hpp"
+#include "engine/util/vec2.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+// Forward Declaration
+namespace dull::job { struct ThreadPool; }
+
+namespace dull::nav {
+
+struct PathQuery final {
+    util::Vec2i start;
+    util::Vec2i goal;
+};
+
+// ---
+// Outcome of one PathQuery
+// Note: cells point into the service, they only stay valid during the callback
+// ---
+struct PathResult final {
+    util::Vec2i start;
+    util::Vec2i goal;
+    std::span<const util::Vec2i> cells; // start and goal included, empty without a path
+    uint32_t cost     = 0;              // STRAIGHT_COST per straight step, DIAGONAL_COST per diagonal one
+    bool     isFound  = false;
+    bool     isCached = false;          // walked a cached entrance route
+};
+
+// Receives the results of a batch in query order
+using PathCallback = std::move_only_function<void(std::span<const PathResult> results)>;
+
+// ---
+// Grid and cache setup of a PathService
+// ---
+struct PathServiceConfig final {
+    NavGridConfig grid;
+    size_t cacheCapacity = 4096; // entrance routes, 0 turns the cache off
+};
+
+// ---
+// Counters of a PathService since it was created
+// ---
+struct PathStats final {
+    uint64_t queryCount          = 0;
+    uint64_t foundCount          = 0;
+    uint64_t cacheHitCount       = 0; // queries refined from a cached route
+    uint64_t cacheMissCount      = 0;
+    size_t   cachedRouteCount    = 0;
+    size_t   nodeCount           = 0; // entrances in the graph
+    size_t   rebuiltClusterCount = 0; // last rebuild
+    double   rebuildMs           = 0.0;
+};
+
+// ---
+// Solves batches of path queries on the worker pool and hands the results back on the main thread
+// Note: batches submitted between two Update calls are solved together as one wave, workers claim queries in small chunks
+// Note: queries between clusters first look up the route cached for their start and goal cluster, only misses run the abstract search
+// Note: a cached route is shared by every start and goal of the cluster pair, paths stay valid but may run a few cells longer
+// Note: queries within a cluster or between neighbouring ones skip the cache
+// Note: cell edits are queued and applied between waves, only touched clusters are rebuilt and only routes through them are dropped
+// Note: a solver picked up by a thread outside the pool solves one chunk and hands itself back, so Wait calls elsewhere never stall on a wave
+// Note: main thread API, without a pool waves are solved and delivered inside Update
+// ---
+struct PathService final {
+private:
+    static constexpr size_t CHUNK_SIZE = 16;
+
+    struct _Batch {
+        size_t begin = 0;
+        size_t count = 0;
+        PathCallback callback;
+    };
+
+    struct _Edit {
+        int32_t x = 0;
+        int32_t y = 0;
+        bool isWalkable = false;
+    };
+
+    struct _Outcome {
+        uint32_t solver    = 0;
+        uint32_t cellBegin = 0;
+        uint32_t cellCount = 0;
+        uint32_t cost      = 0;
+        bool     isFound   = false;
+        bool     isCached  = false;
+    };
+
+    struct _Solver {
+        NavScratch scratch;
+        std::vector<util::Vec2i> cells;
+        std::vector<uint32_t> route;
+        uint64_t hitCount  = 0;
+        uint64_t missCount = 0;
+    };
+
+    NavGrid _grid;
+    job::ThreadPool* _threadPoolPtr = nullptr;
+    platform::SteadyClock _clock;
+
+    std::mutex _cacheMutex;
+    PathCache _cache;
+
+    std::vector<_Edit> _edits;
+    std::vector<PathQuery> _queuedQueries;
+    std::vector<_Batch> _queuedBatches;
+
+    // Owned by the solvers while a wave runs
+    std::vector<PathQuery> _waveQueries;
+    std::vector<_Batch> _waveBatches;
+    std::vector<_Outcome> _outcomes;
+    std::vector<std::unique_ptr<_Solver>> _solvers;
+    std::atomic<size_t>   _nextChunk    {0};
+    std::atomic<uint32_t> _pendingCount {0};
+    bool _isWaveRunning = false;
+
+    std::vector<PathResult> _results;
+    PathStats _stats;
+
+    void _ApplyEdits();
+    void _Launch();
+    void _RunSolver(uint32_t solverIndex);
+    void _Solve(_Solver& solver, uint32_t solverIndex, size_t queryIndex);
+    void _Deliver();
+
+public:
+    PathService(PathService&&)                 = delete;
+    PathService(const PathService&)            = delete;
+    PathService& operator=(PathService&&)      = delete;
+    PathService& operator=(const PathService&) = delete;
+
+    // Note: the graph is built by the first Update, cells set before it cost no extra rebuild
+    explicit PathService(const PathServiceConfig& config, job::ThreadPool* threadPoolPtr = nullptr);
+
+    // Note: waits for the running wave, its callbacks are dropped
+    ~PathService() noexcept;
+
+    // Queues queries for the next wave, callback runs once with all their results
+    void Submit(std::span<const PathQuery> queries, PathCallback callback);
+
+    // Queued until the running wave is done, false outside the grid
+    bool SetWalkable(int32_t x, int32_t y, bool isWalkable);
+
+    // Delivers a finished wave, applies queued edits and launches the queued batches
+    // Note: callbacks run in here, they may submit and edit but must not call Update or WaitAll
+    void Update();
+
+    // Blocks until every batch so far is delivered
+    void WaitAll();
+
+    [[nodiscard]] bool IsBusy() const noexcept { return this->_isWaveRunning || !this->_queuedBatches.empty(); }
+
+    // Note: queued edits only show up once applied
+    [[nodiscard]] const NavGrid& GetGrid() const noexcept { return this->_grid; }
+    [[nodiscard]] const PathStats& GetStats() const noexcept { return this->_stats; }
+};
+
+} // namespace dull::nav
@@ -0,0 +1,162 @@
+#include "engine/particle/particle_emitter.hpp"
+#include "engine/render/render_queue.hpp"
+#include "engine/util/color_batch.hpp"
+#include "engine/util/vec2_batch.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace dull::particle {
+
+// Age of a culled particle, past any lifetime
+static constexpr float DEAD_AGE = std::numeric_limits<float>::infinity();
+
+ParticleEmitter::ParticleEmitter(const EmitterConfig& config, uint64_t seed)
+    : _config {config}
+    , _positionX(config.capacity)
+    , _positionY(config.capacity)
+    , _velocityX(config.capacity)
+    , _velocityY(config.capacity)
+    , _age(config.capacity)
+    , _inverseLifetime(config.capacity)
+    , _colors(config.capacity)
+    , _weights(config.capacity)
+    , _randomState {seed}
+{
+    zutil::Assert(config.lifetimeMin > 0.0F && config.lifetimeMin <= config.lifetimeMax, "Particle lifetimes must be positive and ordered");
+    zutil::Assert(std::isfinite(config.lifetimeMax), "Particle lifetimes must be finite");
+}
+
+// splitmix64, any seed works, top 24 bits make the float
+[[nodiscard]] float ParticleEmitter::_NextUnit() noexcept
+{
+    uint64_t value = (this->_randomState += 0x9E3779B97F4A7C15);
+
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+    value ^= value >> 31;
+
+    return static_cast<float>(value >> 40) * (1.0F / 16777216.0F);
+}
+
+size_t ParticleEmitter::Emit(size_t count) noexcept
+{
+    const size_t SPAWN_COUNT = std::min(count, this->_config.capacity - this->_count);
+    const EmitterConfig& config = this->_config;
+
+    for (size_t index = this->_count; index < this->_count + SPAWN_COUNT; index++)
+    {
+        this->_positionX[index]       = config.position.x + this->_NextRange(-config.spawnExtent.x, config.spawnExtent.x);
+        this->_positionY[index]       = config.position.y + this->_NextRange(-config.spawnExtent.y, config.spawnExtent.y);
+        this->_velocityX[index]       = this->_NextRange(config.velocityMin.x, config.velocityMax.x);
+        this->_velocityY[index]       = this->_NextRange(config.velocityMin.y, config.velocityMax.y);
+        this->_age[index]             = 0.0F;
+        this->_inverseLifetime[index] = 1.0F / this->_NextRange(config.lifetimeMin, config.lifetimeMax);
+        this->_colors[index]          = config.startColor;
+    }
+
+    this->_count += SPAWN_COUNT;
+    return SPAWN_COUNT;
+}
+
+void ParticleEmitter::_SpawnDue(float deltaTime) noexcept
+{
+    this->_spawnCarry += this->_config.spawnRate * deltaTime;
+
+    const float SPAWN_COUNT = std::floor(this->_spawnCarry);
+    this->_spawnCarry -= SPAWN_COUNT;
+
+    (void)this->Emit(static_cast<size_t>(SPAWN_COUNT));
+}
+
+// Note: every pass is a straight loop over contiguous arrays, vec2 and color passes go through the batch kernels
+void ParticleEmitter::_Simulate(size_t begin, size_t end, float deltaTime, std::vector<uint32_t>& deadIndices) noexcept
+{
+    const size_t COUNT = end - begin;
+
+    const util::batch::Vec2Soa POSITIONS {{this->_positionX.data() + begin, COUNT}, {this->_positionY.data() + begin, COUNT}};
+    const util::batch::Vec2Soa VELOCITIES {{this->_velocityX.data() + begin, COUNT}, {this->_velocityY.data() + begin, COUNT}};
+
+    util::batch::Translate(VELOCITIES, this->_config.acceleration * deltaTime, VELOCITIES);
+    util::batch::AddScaled(POSITIONS, VELOCITIES, deltaTime, POSITIONS);
+
+    float* ages = this->_age.data();
+    const float* inverseLifetimes = this->_inverseLifetime.data();
+
+    for (size_t index = begin; index < end; index++) ages[index] += deltaTime;
+
+    // Branch free so it vectorizes, culled particles just age out
+    if (this->_config.bounds.has_value())
+    {
+        const util::Rect& BOUNDS = *this->_config.bounds;
+        const float RIGHT  = BOUNDS.x + BOUNDS.w;
+        const float BOTTOM = BOUNDS.y + BOUNDS.h;
+
+        for (size_t index = begin; index < end; index++)
+        {
+            const float X = this->_positionX[index];
+            const float Y = this->_positionY[index];
+            const bool IS_OUTSIDE = (X < BOUNDS.x) | (X > RIGHT) | (Y < BOUNDS.y) | (Y > BOTTOM);
+
+            ages[index] = IS_OUTSIDE ? DEAD_AGE : ages[index];
+        }
+    }
+
+    uint8_t* weights = this->_weights.data();
+
+    for (size_t index = begin; index < end; index++)
+        weights[index] = static_cast<uint8_t>(std::min(ages[index] * inverseLifetimes[index], 1.0F) * 255.0F);
+
+    util::batch::Lerp(this->_config.startColor, this->_config.endColor, {weights + begin, COUNT}, {this->_colors.data() + begin, COUNT});
+
+    for (size_t index = begin; index < end; index++)
+        if (ages[index] * inverseLifetimes[index] >= 1.0F) deadIndices.push_back(static_cast<uint32_t>(index));
+}
+
+void ParticleEmitter::_Compact(std::span<const uint32_t> deadIndices) noexcept
+{
+    // Back to front the last particle is always alive, dead ones above the hole were removed first
+    for (auto it = deadIndices.rbegin(); it != deadIndices.rend(); it++)
+    {
+        const size_t INDEX = *it;
+        const size_t LAST  = --this->_count;
+
+        if (INDEX == LAST) continue;
+
+        this->_positionX[INDEX]       = this->_positionX[LAST];
+        this->_positionY[INDEX]       = this->_positionY[LAST];
+        this->_velocityX[INDEX]       = this->_velocityX[LAST];
+        this->_velocityY[INDEX]       = this->_velocityY[LAST];
+        this->_age[INDEX]             = this->_age[LAST];
+        this->_inverseLifetime[INDEX] = this->_inverseLifetime[LAST];
+        this->_colors[INDEX]          = this->_colors[LAST];
+    }
+}
+
+void ParticleEmitter::_Submit(size_t begin, size_t end, render::RenderQueue& renderQueue) const
+{
+    const EmitterConfig& config = this->_config;
+    const float HALF_SIZE = config.size * 0.5F;
+
+    if (config.texture.IsNull())
+    {
+        for (size_t index = begin; index < end; index++)
+        {
+            const util::Rect RECT {this->_positionX[index] - HALF_SIZE, this->_positionY[index] - HALF_SIZE, config.size, config.size};
+            renderQueue.SubmitRect(RECT, this->_colors[index], config.layer, config.blend);
+        }
+
+        return;
+    }
+
+    for (size_t index = begin; index < end; index++)
+    {
+        const util::Rect RECT {this->_positionX[index] - HALF_SIZE, this->_positionY[index] - HALF_SIZE, config.size, config.size};
+        renderQueue.SubmitSprite(config.texture, config.source, RECT, this->_colors[index], config.layer, config.blend);
+    }
+}
+
+} // namespace dull::particle
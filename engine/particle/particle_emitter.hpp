@@ -0,0 +1,116 @@
+#pragma once
+
+#include "engine/render/render_batch.hpp"
+#include "engine/util/color_rgba.hpp"
+#include "engine/util/rect.hpp"
+#include "engine/util/vec2.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+// Forward Declaration
+namespace dull::render { struct RenderQueue; }
+
+namespace dull::particle {
+
+// Forward Declaration
+struct ParticleSystem;
+
+// ---
+// Spawn and look parameters of an emitter
+// Note: ranges are sampled uniformly per particle, min == max gives a constant
+// ---
+struct EmitterConfig final {
+    size_t capacity = 1024; // live particles at most, spawns past it are dropped
+
+    util::Vec2f position;
+    util::Vec2f spawnExtent;  // half size of the box particles spawn in around position
+    util::Vec2f velocityMin;
+    util::Vec2f velocityMax;
+    util::Vec2f acceleration; // gravity, wind
+    float lifetimeMin = 1.0F; // seconds
+    float lifetimeMax = 1.0F;
+    float spawnRate   = 0.0F; // particles per second, Emit bursts on top
+
+    // Particles leaving these bounds die on the next tick
+    std::optional<util::Rect> bounds;
+
+    // Blended over the lifetime with util::Color::Lerp
+    util::Color startColor = util::Color::White();
+    util::Color endColor   = {255, 255, 255, 0};
+
+    float size = 2.0F; // quad side in world units
+
+    // Null texture draws flat quads
+    render::Texture   texture;
+    util::Rect        source;
+    int16_t           layer = 0;
+    render::BlendMode blend = render::BlendMode::Additive;
+};
+
+// ---
+// Particles of one emitter, stored as structure of arrays
+// Note: dead particles are swap-and-pop compacted, so live particles always fill [0, count) but don't keep their order
+// Note: deterministic for a given seed, spawns draw from the emitter's own generator on the main thread
+// ---
+struct ParticleEmitter final {
+    friend ParticleSystem;
+
+private:
+    EmitterConfig _config;
+
+    std::vector<float> _positionX;
+    std::vector<float> _positionY;
+    std::vector<float> _velocityX;
+    std::vector<float> _velocityY;
+    std::vector<float> _age;
+    std::vector<float> _inverseLifetime;
+    std::vector<util::Color> _colors;
+    std::vector<uint8_t> _weights; // color weights of the last tick
+
+    size_t   _count       = 0;
+    float    _spawnCarry  = 0.0F;
+    uint64_t _randomState = 0;
+
+    [[nodiscard]] float _NextUnit() noexcept;
+    [[nodiscard]] float _NextRange(float min, float max) noexcept { return min + (max - min) * this->_NextUnit(); }
+
+    // Integrates, ages, colors and culls [begin, end), appends the indices that died to deadIndices
+    // Note: ranges of one emitter can run on different threads at once
+    void _Simulate(size_t begin, size_t end, float deltaTime, std::vector<uint32_t>& deadIndices) noexcept;
+
+    // Removes ascending deadIndices back to front, each hole takes the current last particle
+    void _Compact(std::span<const uint32_t> deadIndices) noexcept;
+
+    // Spawns the particles spawnRate owes for deltaTime
+    void _SpawnDue(float deltaTime) noexcept;
+
+    void _Submit(size_t begin, size_t end, render::RenderQueue& renderQueue) const;
+
+public:
+    ParticleEmitter(ParticleEmitter&&)                 = delete;
+    ParticleEmitter(const ParticleEmitter&)            = delete;
+    ParticleEmitter& operator=(ParticleEmitter&&)      = delete;
+    ParticleEmitter& operator=(const ParticleEmitter&) = delete;
+
+    explicit ParticleEmitter(const EmitterConfig& config, uint64_t seed = 0x2545F4914F6CDD1D);
+
+    // Spawns count particles right away, returns how many fit
+    size_t Emit(size_t count) noexcept;
+
+    void Clear() noexcept { this->_count = 0; }
+
+    void SetPosition(const util::Vec2f& position) noexcept { this->_config.position = position; }
+    void SetSpawnRate(float spawnRate) noexcept { this->_config.spawnRate = spawnRate; }
+
+    [[nodiscard]] const EmitterConfig& GetConfig() const noexcept { return this->_config; }
+    [[nodiscard]] size_t GetCount() const noexcept { return this->_count; }
+    [[nodiscard]] size_t GetCapacity() const noexcept { return this->_config.capacity; }
+
+    [[nodiscard]] util::Vec2f GetPosition(size_t index) const noexcept { return {this->_positionX[index], this->_positionY[index]}; }
+    [[nodiscard]] std::span<const util::Color> GetColors() const noexcept { return {this->_colors.data(), this->_count}; }
+};
+
+} // namespace dull::particle
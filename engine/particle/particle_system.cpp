@@ -0,0 +1,95 @@
+#include "engine/particle/particle_system.hpp"
+#include "engine/job/parallel_for.hpp"
+#include "engine/profile/profiler.hpp"
+#include "engine/render/render_queue.hpp"
+
+#include <algorithm>
+
+namespace dull::particle {
+
+ParticleEmitter& ParticleSystem::AddEmitter(const EmitterConfig& config)
+{
+    return this->AddEmitter(config, this->_emitterSerial + 1);
+}
+
+ParticleEmitter& ParticleSystem::AddEmitter(const EmitterConfig& config, uint64_t seed)
+{
+    this->_emitterSerial++;
+    return *this->_emitters.emplace_back(std::make_unique<ParticleEmitter>(config, seed));
+}
+
+void ParticleSystem::RemoveEmitter(const ParticleEmitter& emitter) noexcept
+{
+    std::erase_if(this->_emitters, [&emitter](const std::unique_ptr<ParticleEmitter>& emitterPtr) { return emitterPtr.get() == &emitter; });
+}
+
+[[nodiscard]] size_t ParticleSystem::GetParticleCount() const noexcept
+{
+    size_t particleCount = 0;
+
+    for (const std::unique_ptr<ParticleEmitter>& emitterPtr : this->_emitters) particleCount += emitterPtr->GetCount();
+
+    return particleCount;
+}
+
+void ParticleSystem::_BuildChunks()
+{
+    this->_chunkCount = 0;
+
+    for (const std::unique_ptr<ParticleEmitter>& emitterPtr : this->_emitters)
+    {
+        for (size_t begin = 0; begin < emitterPtr->GetCount(); begin += CHUNK_SIZE)
+        {
+            if (this->_chunkCount == this->_chunks.size()) this->_chunks.emplace_back();
+
+            _Chunk& chunk = this->_chunks[this->_chunkCount++];
+            chunk.emitterPtr = emitterPtr.get();
+            chunk.begin      = begin;
+            chunk.end        = std::min(begin + CHUNK_SIZE, emitterPtr->GetCount());
+        }
+    }
+}
+
+template <typename FnT>
+void ParticleSystem::_ForEachChunk(bool isParallel, FnT&& fn)
+{
+    const auto RUN_CHUNKS = [this, &fn](size_t begin, size_t end) {
+        for (size_t index = begin; index < end; index++) fn(this->_chunks[index]);
+    };
+
+    if (isParallel && this->_threadPoolPtr != nullptr) job::ParallelFor(*this->_threadPoolPtr, this->_chunkCount, RUN_CHUNKS);
+    else RUN_CHUNKS(0, this->_chunkCount);
+}
+
+void ParticleSystem::Simulate(float deltaTime)
+{
+    DULL_PROFILE_ZONE("ParticleSystem::Simulate");
+
+    this->_BuildChunks();
+
+    this->_ForEachChunk(true, [deltaTime](_Chunk& chunk) {
+        chunk.deadIndices.clear();
+        chunk.emitterPtr->_Simulate(chunk.begin, chunk.end, deltaTime, chunk.deadIndices);
+    });
+
+    // Chunks of an emitter are in ascending order, walking them backwards keeps every hole below the live tail
+    for (size_t index = this->_chunkCount; index-- > 0;)
+    {
+        const _Chunk& chunk = this->_chunks[index];
+        chunk.emitterPtr->_Compact(chunk.deadIndices);
+    }
+
+    for (const std::unique_ptr<ParticleEmitter>& emitterPtr : this->_emitters) emitterPtr->_SpawnDue(deltaTime);
+}
+
+void ParticleSystem::Submit(render::RenderQueue& renderQueue)
+{
+    DULL_PROFILE_ZONE("ParticleSystem::Submit");
+
+    this->_BuildChunks();
+
+    const bool IS_PARALLEL = renderQueue.GetThreadPool() == this->_threadPoolPtr;
+    this->_ForEachChunk(IS_PARALLEL, [&renderQueue](const _Chunk& chunk) { chunk.emitterPtr->_Submit(chunk.begin, chunk.end, renderQueue); });
+}
+
+} // namespace dull::particle
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "engine/particle/particle_emitter.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Forward Declaration
+namespace dull::job { struct ThreadPool; }
+namespace dull::render { struct RenderQueue; }
+
+namespace dull::particle {
+
+// ---
+// Owns the emitters and steps all of them together
+// Note: particles of every emitter are cut into fixed size chunks, the chunks run across the pool
+// Note: compaction and spawning stay on the calling thread so results don't depend on scheduling
+// Note: App steps its system every fixed tick and submits it every frame before the render queue flushes
+// ---
+struct ParticleSystem final {
+private:
+    static constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+    struct _Chunk {
+        ParticleEmitter* emitterPtr = nullptr;
+        size_t begin = 0;
+        size_t end   = 0;
+        std::vector<uint32_t> deadIndices;
+    };
+
+    job::ThreadPool* _threadPoolPtr = nullptr;
+    std::vector<std::unique_ptr<ParticleEmitter>> _emitters;
+    uint64_t _emitterSerial = 0;
+
+    // Never shrinks, so dead index buffers keep their capacity between ticks
+    std::vector<_Chunk> _chunks;
+    size_t _chunkCount = 0;
+
+    void _BuildChunks();
+
+    template <typename FnT>
+    void _ForEachChunk(bool isParallel, FnT&& fn);
+
+public:
+    ParticleSystem(ParticleSystem&&)                 = delete;
+    ParticleSystem(const ParticleSystem&)            = delete;
+    ParticleSystem& operator=(ParticleSystem&&)      = delete;
+    ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+    // Note: without a pool everything runs on the calling thread
+    explicit ParticleSystem(job::ThreadPool* threadPoolPtr = nullptr) noexcept : _threadPoolPtr {threadPoolPtr} {}
+
+    // Emitters are seeded with their creation order unless given a seed
+    ParticleEmitter& AddEmitter(const EmitterConfig& config);
+    ParticleEmitter& AddEmitter(const EmitterConfig& config, uint64_t seed);
+    void RemoveEmitter(const ParticleEmitter& emitter) noexcept;
+    void Clear() noexcept { this->_emitters.clear(); }
+
+    // Integrates every particle, removes the dead ones and spawns what the emitter rates owe
+    void Simulate(float deltaTime);
+
+    // Queues a quad per particle
+    // Note: goes wide only when renderQueue was built with the same pool, its lanes are per pool worker
+    void Submit(render::RenderQueue& renderQueue);
+
+    [[nodiscard]] size_t GetEmitterCount() const noexcept { return this->_emitters.size(); }
+    [[nodiscard]] size_t GetParticleCount() const noexcept;
+};
+
+} // namespace dull::particle
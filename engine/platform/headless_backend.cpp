@@ -0,0 +1,54 @@
+#include "engine/platform/headless_backend.hpp"
+#include "engine/core/app.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace dull::platform {
+
+void HeadlessBackend::IOpen(const core::WindowContext& windowContext)
+{
+    this->_frameInterval = 1.0 / windowContext.ticksPerSecond;
+    this->_renderCost    = windowContext.simulatedRenderCost;
+    this->_isPaced       = windowContext.isPaced && windowContext.replayPath.empty();
+    this->_nextFrameTime = this->_wallClock.INow() + this->_frameInterval;
+}
+
+[[nodiscard]] IClock& HeadlessBackend::IGetClock() noexcept
+{
+    if (this->_isPaced) return this->_wallClock;
+    return this->_simulatedClock;
+}
+
+void HeadlessBackend::IDraw(const render::RenderBatchList& batchList)
+{
+    this->_recordedBatches   = batchList;
+    this->_drawnBatchCount  += batchList.batches.size();
+    this->_drawnVertexCount += batchList.vertices.size();
+}
+
+void HeadlessBackend::IEndFrame()
+{
+    // Spins rather than sleeps, a CPU bound draw submission is what it stands in for
+    if (this->_renderCost > 0.0)
+    {
+        const double END_TIME = this->_wallClock.INow() + this->_renderCost;
+        while (this->_wallClock.INow() < END_TIME) {}
+    }
+
+    if (!this->_isPaced)
+    {
+        this->_simulatedClock.Advance(this->_frameInterval);
+        return;
+    }
+
+    const double REMAINING_TIME = this->_nextFrameTime - this->_wallClock.INow();
+
+    if (REMAINING_TIME > 0.0) std::this_thread::sleep_for(std::chrono::duration<double>(REMAINING_TIME));
+
+    // Fall back to now when too far behind, instead of bursting to catch up
+    this->_nextFrameTime = std::max(this->_nextFrameTime, this->_wallClock.INow() - this->_frameInterval) + this->_frameInterval;
+}
+
+} // namespace dull::platform
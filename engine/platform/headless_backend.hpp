@@ -0,0 +1,56 @@
+#pragma once
+
+#include "engine/config.hpp"
+#include "engine/platform/i_backend.hpp"
+#include "engine/render/render_batch.hpp"
+
+#include <cstdint>
+
+namespace dull::platform {
+
+// ---
+// Backend without window or GPU
+// Note: unpaced runs as fast as possible on simulated time, one fixed tick per frame
+// Note: paced runs sleep to hold the App tick rate on the wall clock
+// Note: draws are recorded instead of presented, the last frame's batches stay readable
+// Note: a simulated render cost keeps the presenting thread busy for that long every frame
+// ---
+struct HeadlessBackend final : public IBackend {
+    friend core::App;
+
+private:
+    SteadyClock _wallClock;
+    ManualClock _simulatedClock;
+    double _frameInterval = 1.0 / config::TICKS_PER_SECOND;
+    double _nextFrameTime = 0.0;
+    double _renderCost    = 0.0;
+    bool   _isPaced       = false;
+
+    render::RenderBatchList _recordedBatches;
+    uint64_t _drawnBatchCount  = 0;
+    uint64_t _drawnVertexCount = 0;
+
+protected:
+    void IOpen (const core::WindowContext& windowContext) final;
+    void IClose() final {}
+
+    [[nodiscard]] bool IShouldClose() final { return false; }
+
+    void IPollInput(InputSnapshot& input) final { input = {}; }
+
+    void IBeginFrame() final {}
+    void IDraw      (const render::RenderBatchList& batchList) final;
+    void IEndFrame  () final;
+
+    [[nodiscard]] IClock& IGetClock() noexcept final;
+
+public:
+    // Note: pipelined Apps present on the render thread, read these once the App is closed
+    [[nodiscard]] const render::RenderBatchList& GetRecordedBatches() const noexcept { return this->_recordedBatches; }
+
+    // Totals over every frame drawn so far
+    [[nodiscard]] uint64_t GetDrawnBatchCount () const noexcept { return this->_drawnBatchCount;  }
+    [[nodiscard]] uint64_t GetDrawnVertexCount() const noexcept { return this->_drawnVertexCount; }
+};
+
+} // namespace dull::platform
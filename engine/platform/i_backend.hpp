@@ -0,0 +1,44 @@
+#pragma once
+
+#include "engine/platform/i_clock.hpp"
+#include "engine/platform/input_snapshot.hpp"
+
+#include <cstdint>
+
+// Forward Declaration
+namespace dull::core { struct App; struct WindowContext; }
+namespace dull::render { struct RenderBatchList; struct RenderPipeline; }
+
+namespace dull::platform {
+
+enum class BackendType : uint8_t {
+    Window,   // raylib window with GPU presentation
+    Headless, // no window, draws are only recorded
+};
+
+// ---
+// Interface for all platform layers the application can run on
+// ---
+struct IBackend {
+    friend core::App;
+    friend render::RenderPipeline;
+
+public:
+    virtual ~IBackend() = default;
+
+protected:
+    virtual void IOpen (const core::WindowContext& windowContext) = 0;
+    virtual void IClose() = 0;
+
+    [[nodiscard]] virtual bool IShouldClose() = 0;
+
+    virtual void IPollInput(InputSnapshot& input) = 0;
+
+    virtual void IBeginFrame() = 0;
+    virtual void IDraw      (const render::RenderBatchList& batchList) = 0;
+    virtual void IEndFrame  () = 0;
+
+    [[nodiscard]] virtual IClock& IGetClock() noexcept = 0;
+};
+
+} // namespace dull::platform
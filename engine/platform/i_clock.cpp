@@ -0,0 +1,27 @@
+#include "engine/platform/i_clock.hpp"
+
+namespace dull::platform {
+
+[[nodiscard]] double SteadyClock::INow() const noexcept
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - this->_startTime).count();
+}
+
+WarpClock::WarpClock(const IClock& source, double timeScale) noexcept
+    : _source {source}, _timeScale {timeScale}, _sourceBase {source.INow()}
+{}
+
+[[nodiscard]] double WarpClock::INow() const noexcept
+{
+    return this->_warpBase + (this->_source.INow() - this->_sourceBase) * this->_timeScale;
+}
+
+void WarpClock::SetTimeScale(double timeScale) noexcept
+{
+    // Rebase so the warped time stays continuous across scale changes
+    this->_warpBase   = this->INow();
+    this->_sourceBase = this->_source.INow();
+    this->_timeScale  = timeScale;
+}
+
+} // namespace dull::platform
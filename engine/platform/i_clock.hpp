@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+namespace dull::platform {
+
+// ---
+// Interface for all time sources of application
+// Note: returns seconds since an arbitrary epoch, must never go backwards
+// ---
+struct IClock {
+    virtual ~IClock() = default;
+
+    [[nodiscard]] virtual double INow() const noexcept = 0;
+};
+
+// ---
+// Monotonic wall clock, starts at zero on construction
+// ---
+struct SteadyClock final : public IClock {
+private:
+    std::chrono::steady_clock::time_point _startTime = std::chrono::steady_clock::now();
+
+public:
+    [[nodiscard]] double INow() const noexcept final;
+};
+
+// ---
+// Clock which only moves when told to
+// Note: mainly used for replays and synthetic runs
+// Note: one thread may move it while others read it, moving it from several threads at once races
+// ---
+struct ManualClock final : public IClock {
+private:
+    std::atomic<double> _time = 0.0;
+
+public:
+    [[nodiscard]] double INow() const noexcept final { return this->_time.load(std::memory_order_relaxed); }
+
+    void Advance(double seconds) noexcept { this->Set(this->INow() + seconds); }
+    void Set(double time) noexcept { this->_time.store(time, std::memory_order_relaxed); }
+};
+
+// ---
+// Clock scaling the flow of another clock
+// ---
+struct WarpClock final : public IClock {
+private:
+    const IClock& _source;
+    double _timeScale  = 1.0;
+    double _sourceBase = 0.0;
+    double _warpBase   = 0.0;
+
+public:
+    explicit WarpClock(const IClock& source, double timeScale = 1.0) noexcept;
+
+    [[nodiscard]] double INow() const noexcept final;
+    [[nodiscard]] double GetTimeScale() const noexcept { return this->_timeScale; }
+
+    void SetTimeScale(double timeScale) noexcept;
+};
+
+} // namespace dull::platform
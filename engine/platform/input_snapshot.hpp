@@ -0,0 +1,53 @@
+#pragma once
+
+#include "engine/util/vec2.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace dull::platform {
+
+// ---
+// Raw device state sampled once per frame by the backend
+// Note: key and button codes are raylib's, fixed size and trivially copyable so it can be recorded as is
+// ---
+struct InputSnapshot final {
+    static constexpr uint32_t KEY_COUNT    = 352; // rl::KEY_KB_MENU is the highest key code
+    static constexpr uint32_t KEY_WORDS    = KEY_COUNT / 64 + (KEY_COUNT % 64 != 0);
+    static constexpr uint32_t BUTTON_COUNT = 7;   // rl::MOUSE_BUTTON_LEFT .. rl::MOUSE_BUTTON_BACK
+
+    std::array<uint64_t, KEY_WORDS> keyWords {};
+    uint8_t     mouseButtons  = 0;
+    util::Vec2f mousePosition = util::Vec2f::Zero();
+    float       mouseWheel    = 0.0F;
+
+    [[nodiscard]] constexpr bool IsKeyDown(uint32_t key) const noexcept
+    {
+        return key < KEY_COUNT && ((this->keyWords[key / 64] >> (key % 64)) & 1) != 0;
+    }
+
+    [[nodiscard]] constexpr bool IsMouseButtonDown(uint32_t button) const noexcept
+    {
+        return button < BUTTON_COUNT && ((this->mouseButtons >> button) & 1) != 0;
+    }
+
+    constexpr void SetKey(uint32_t key, bool isDown) noexcept
+    {
+        if (key >= KEY_COUNT) return;
+
+        const uint64_t BIT = uint64_t {1} << (key % 64);
+        this->keyWords[key / 64] = isDown ? (this->keyWords[key / 64] | BIT) : (this->keyWords[key / 64] & ~BIT);
+    }
+
+    constexpr void SetMouseButton(uint32_t button, bool isDown) noexcept
+    {
+        if (button >= BUTTON_COUNT) return;
+
+        const uint8_t BIT = static_cast<uint8_t>(1U << button);
+        this->mouseButtons = static_cast<uint8_t>(isDown ? (this->mouseButtons | BIT) : (this->mouseButtons & ~BIT));
+    }
+
+    constexpr bool operator == (const InputSnapshot& other) const noexcept = default;
+};
+
+} // namespace dull::platform
@@ -0,0 +1,158 @@
+#include "engine/platform/mapped_file.hpp"
+
+#include <utility>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace dull::platform {
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : _data {std::exchange(other._data, nullptr)}
+    , _size {std::exchange(other._size, 0)}
+    , _isOpen {std::exchange(other._isOpen, false)}
+#if defined(_WIN32)
+    , _fileHandle {std::exchange(other._fileHandle, nullptr)}
+    , _mappingHandle {std::exchange(other._mappingHandle, nullptr)}
+#endif
+{}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this == &other) return *this;
+
+    this->_Close();
+
+    this->_data   = std::exchange(other._data, nullptr);
+    this->_size   = std::exchange(other._size, 0);
+    this->_isOpen = std::exchange(other._isOpen, false);
+
+#if defined(_WIN32)
+    this->_fileHandle    = std::exchange(other._fileHandle, nullptr);
+    this->_mappingHandle = std::exchange(other._mappingHandle, nullptr);
+#endif
+
+    return *this;
+}
+
+#if defined(_WIN32)
+
+[[nodiscard]] bool MappedFile::Open(const std::string& path) noexcept
+{
+    this->_Close();
+
+    HANDLE fileHandle = CreateFileA(
+        path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+    );
+
+    if (fileHandle == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize {};
+
+    if (!GetFileSizeEx(fileHandle, &fileSize))
+    {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    this->_fileHandle = fileHandle;
+    this->_size       = static_cast<size_t>(fileSize.QuadPart);
+    this->_isOpen     = true;
+
+    // Zero sized files can't be mapped, they stay open with an empty span
+    if (this->_size == 0) return true;
+
+    this->_mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (this->_mappingHandle == nullptr)
+    {
+        this->_Close();
+        return false;
+    }
+
+    this->_data = static_cast<const std::byte*>(MapViewOfFile(this->_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+
+    if (this->_data == nullptr)
+    {
+        this->_Close();
+        return false;
+    }
+
+    return true;
+}
+
+void MappedFile::_Close() noexcept
+{
+    if (this->_data != nullptr) UnmapViewOfFile(this->_data);
+    if (this->_mappingHandle != nullptr) CloseHandle(this->_mappingHandle);
+    if (this->_fileHandle != nullptr) CloseHandle(this->_fileHandle);
+
+    this->_data          = nullptr;
+    this->_size          = 0;
+    this->_isOpen        = false;
+    this->_fileHandle    = nullptr;
+    this->_mappingHandle = nullptr;
+}
+
+#else
+
+[[nodiscard]] bool MappedFile::Open(const std::string& path) noexcept
+{
+    this->_Close();
+
+    const int FILE_DESCRIPTOR = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (FILE_DESCRIPTOR < 0) return false;
+
+    struct stat fileStatus {};
+
+    if (::fstat(FILE_DESCRIPTOR, &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode))
+    {
+        ::close(FILE_DESCRIPTOR);
+        return false;
+    }
+
+    this->_size   = static_cast<size_t>(fileStatus.st_size);
+    this->_isOpen = true;
+
+    // Zero sized files can't be mapped, they stay open with an empty span
+    if (this->_size != 0)
+    {
+        void* mappedPtr = ::mmap(nullptr, this->_size, PROT_READ, MAP_PRIVATE, FILE_DESCRIPTOR, 0);
+
+        if (mappedPtr == MAP_FAILED)
+        {
+            ::close(FILE_DESCRIPTOR);
+            this->_size   = 0;
+            this->_isOpen = false;
+            return false;
+        }
+
+        this->_data = static_cast<const std::byte*>(mappedPtr);
+    }
+
+    // The mapping keeps its own reference to the file
+    ::close(FILE_DESCRIPTOR);
+    return true;
+}
+
+void MappedFile::_Close() noexcept
+{
+    if (this->_data != nullptr) ::munmap(const_cast<std::byte*>(this->_data), this->_size);
+
+    this->_data   = nullptr;
+    this->_size   = 0;
+    this->_isOpen = false;
+}
+
+#endif
+
+} // namespace dull::platform
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+namespace dull::platform {
+
+// ---
+// Read-only memory mapping of a whole file
+// Note: mmap on POSIX, a file mapping view on Windows, pages are faulted in by the OS on first touch
+// ---
+struct MappedFile final {
+private:
+    const std::byte* _data = nullptr;
+    size_t _size   = 0;
+    bool   _isOpen = false;
+
+#if defined(_WIN32)
+    void* _fileHandle    = nullptr;
+    void* _mappingHandle = nullptr;
+#endif
+
+    void _Close() noexcept;
+
+public:
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile() noexcept = default;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    ~MappedFile() noexcept { this->_Close(); }
+
+    // Note: an empty file opens successfully with an empty span
+    [[nodiscard]] bool Open(const std::string& path) noexcept;
+
+    [[nodiscard]] bool IsOpen() const noexcept { return this->_isOpen; }
+    [[nodiscard]] std::span<const std::byte> GetBytes() const noexcept { return {this->_data, this->_size}; }
+    [[nodiscard]] size_t GetSize() const noexcept { return this->_size; }
+};
+
+} // namespace dull::platform
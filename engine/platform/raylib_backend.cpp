@@ -0,0 +1,100 @@
+#include "engine/platform/raylib_backend.hpp"
+#include "engine/core/app.hpp"
+#include "engine/render/render_batch.hpp"
+#include "engine/util/rect.hpp"
+
+#include <vendor/raylib.h>
+
+namespace dull::platform {
+
+// raylib culls clockwise triangles (on screen, y down), winding is fixed up here so lines drawn in any direction show
+static void sDrawTriangle(const util::Vec2f& a, const util::Vec2f& b, const util::Vec2f& c, util::Color color)
+{
+    if ((b - a).Cross(c - a) < 0.0F) rl::DrawTriangle(a, b, c, color);
+    else                             rl::DrawTriangle(a, c, b, color);
+}
+
+[[nodiscard]] double RaylibClock::INow() const noexcept { return rl::GetTime(); }
+
+void RaylibBackend::IOpen(const core::WindowContext& windowContext)
+{
+    int configFlags = {
+        (windowContext.isVsyncEnabled ? rl::FLAG_VSYNC_HINT       : 0) |
+        (windowContext.isResizeable   ? rl::FLAG_WINDOW_RESIZABLE : 0)
+    };
+
+    rl::SetConfigFlags(configFlags);
+    rl::InitWindow(windowContext.dimension.x, windowContext.dimension.y, windowContext.title.c_str());
+    rl::SetExitKey(rl::KEY_NULL);
+}
+
+void RaylibBackend::IClose() { rl::CloseWindow(); }
+
+[[nodiscard]] bool RaylibBackend::IShouldClose() { return rl::WindowShouldClose(); }
+
+void RaylibBackend::IPollInput(InputSnapshot& input)
+{
+    for (uint32_t key = 0; key < InputSnapshot::KEY_COUNT; key++)
+        input.SetKey(key, rl::IsKeyDown(static_cast<int>(key)));
+
+    for (uint32_t button = 0; button < InputSnapshot::BUTTON_COUNT; button++)
+        input.SetMouseButton(button, rl::IsMouseButtonDown(static_cast<int>(button)));
+
+    input.mousePosition = rl::GetMousePosition();
+    input.mouseWheel    = rl::GetMouseWheelMove();
+}
+
+void RaylibBackend::IBeginFrame()
+{
+    rl::BeginDrawing();
+    rl::ClearBackground(rl::BLACK);
+}
+
+// Batches arrive sorted by texture and blend mode, so raylib's internal batcher only flushes at batch edges
+void RaylibBackend::IDraw(const render::RenderBatchList& batchList)
+{
+    for (const render::DrawBatch& batch : batchList.batches)
+    {
+        rl::BeginBlendMode(static_cast<int>(batch.blend));
+
+        const rl::Texture2D TEXTURE = {
+            batch.texture.id,
+            batch.texture.width,
+            batch.texture.height,
+            1,
+            rl::PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+        };
+
+        for (uint32_t vertex = batch.firstVertex; vertex < batch.firstVertex + batch.vertexCount; vertex += 4)
+        {
+            const render::Vertex* quad = &batchList.vertices[vertex];
+
+            if (batch.texture.IsNull())
+            {
+                sDrawTriangle(quad[0].position, quad[1].position, quad[2].position, quad[0].color);
+                sDrawTriangle(quad[0].position, quad[2].position, quad[3].position, quad[0].color);
+                continue;
+            }
+
+            // Sprites are axis aligned, opposite corners are enough to rebuild both rectangles
+            rl::DrawTexturePro(
+                TEXTURE,
+                util::Rect {quad[0].uv, quad[2].uv - quad[0].uv},
+                util::Rect {quad[0].position, quad[2].position - quad[0].position},
+                util::Vec2f::Zero(),
+                0.0F,
+                quad[0].color
+            );
+        }
+    }
+
+    rl::EndBlendMode();
+}
+
+void RaylibBackend::IEndFrame()
+{
+    rl::DrawFPS(10, 10);
+    rl::EndDrawing();
+}
+
+} // namespace dull::platform
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "engine/platform/i_backend.hpp"
+
+namespace dull::platform {
+
+// ---
+// Clock driven by raylib's timer
+// ---
+struct RaylibClock final : public IClock {
+    [[nodiscard]] double INow() const noexcept final;
+};
+
+// ---
+// Window backend presenting through raylib
+// ---
+struct RaylibBackend final : public IBackend {
+    friend core::App;
+
+private:
+    RaylibClock _clock;
+
+protected:
+    void IOpen (const core::WindowContext& windowContext) final;
+    void IClose() final;
+
+    [[nodiscard]] bool IShouldClose() final;
+
+    void IPollInput(InputSnapshot& input) final;
+
+    void IBeginFrame() final;
+    void IDraw      (const render::RenderBatchList& batchList) final;
+    void IEndFrame  () final;
+
+    [[nodiscard]] IClock& IGetClock() noexcept final { return this->_clock; }
+};
+
+} // namespace dull::platform
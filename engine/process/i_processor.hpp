@@ -5,11 +5,15 @@ namespace dull::core { struct App; }
 
 namespace dull::process {
 
+// Forward Declaration
+struct ProcessorGraph;
+
 // ---
 // Interface for all logic processing elements of application
 // ---
 struct IProcessor {
     friend core::App;
+    friend ProcessorGraph;
 
 protected:
     virtual ~IProcessor() = default;
@@ -0,0 +1,114 @@
+#include "engine/process/processor_graph.hpp"
+#include "engine/core/app.hpp"
+#include "engine/job/thread_pool.hpp"
+#include "engine/profile/profiler.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace dull::process {
+
+[[nodiscard]] static bool sIsOverlapping(const std::vector<ResourceId>& lhs, const std::vector<ResourceId>& rhs) noexcept
+{
+    return std::ranges::any_of(lhs, [&rhs](ResourceId id) { return std::ranges::find(rhs, id) != rhs.end(); });
+}
+
+[[nodiscard]] bool ProcessorGraph::_IsConflicting(const ResourceAccess& lhs, const ResourceAccess& rhs) noexcept
+{
+    // Nothing known about what an undeclared stage touches, it orders against everything
+    if (lhs.IsUndeclared() || rhs.IsUndeclared()) return true;
+
+    return sIsOverlapping(lhs.writes, rhs.writes)
+        || sIsOverlapping(lhs.writes, rhs.reads)
+        || sIsOverlapping(lhs.reads , rhs.writes)
+    ;
+}
+
+void ProcessorGraph::Add(IProcessor& processor, ResourceAccess access, const char* name)
+{
+    this->_stages.push_back({processor, std::move(access), name, {}, 0});
+}
+
+void ProcessorGraph::_BuildEdges()
+{
+    for (_Stage& stage : this->_stages)
+    {
+        stage.dependents.clear();
+        stage.dependencyCount = 0;
+    }
+
+    // Registration order breaks ties, so edges always point from earlier to later stages
+    for (uint32_t later = 0; later < this->_stages.size(); later++)
+    {
+        for (uint32_t earlier = 0; earlier < later; earlier++)
+        {
+            if (!ProcessorGraph::_IsConflicting(this->_stages[earlier].access, this->_stages[later].access)) continue;
+
+            this->_stages[earlier].dependents.push_back(later);
+            this->_stages[later].dependencyCount++;
+        }
+    }
+
+    this->_remainingDependencies = std::make_unique<std::atomic<uint32_t>[]>(this->_stages.size());
+}
+
+void ProcessorGraph::IInit()
+{
+    this->_threadPool = &core::App::GetInstance().GetThreadPool();
+    this->_BuildEdges();
+
+    for (_Stage& stage : this->_stages) stage.processor.IInit();
+}
+
+void ProcessorGraph::IShutdown()
+{
+    for (auto stage = this->_stages.rbegin(); stage != this->_stages.rend(); stage++) stage->processor.IShutdown();
+}
+
+void ProcessorGraph::_Execute(void (IProcessor::*callback)())
+{
+    if (this->_threadPool == nullptr || this->_threadPool->GetThreadCount() == 0 || this->_stages.size() < 2)
+    {
+        for (_Stage& stage : this->_stages)
+        {
+            DULL_PROFILE_ZONE(stage.name);
+            (stage.processor.*callback)();
+        }
+
+        return;
+    }
+
+    this->_currentCallback = callback;
+    this->_pendingStageCount.store(static_cast<uint32_t>(this->_stages.size()), std::memory_order_relaxed);
+
+    for (uint32_t stageIndex = 0; stageIndex < this->_stages.size(); stageIndex++)
+        this->_remainingDependencies[stageIndex].store(this->_stages[stageIndex].dependencyCount, std::memory_order_relaxed);
+
+    for (uint32_t stageIndex = 0; stageIndex < this->_stages.size(); stageIndex++)
+    {
+        if (this->_stages[stageIndex].dependencyCount != 0) continue;
+        this->_threadPool->Submit([this, stageIndex] { this->_RunStage(stageIndex); });
+    }
+
+    this->_threadPool->Wait(this->_pendingStageCount);
+}
+
+void ProcessorGraph::_RunStage(uint32_t stageIndex)
+{
+    _Stage& stage = this->_stages[stageIndex];
+
+    {
+        DULL_PROFILE_ZONE(stage.name);
+        (stage.processor.*this->_currentCallback)();
+    }
+
+    for (uint32_t dependent : stage.dependents)
+    {
+        if (this->_remainingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) != 1) continue;
+        this->_threadPool->Submit([this, dependent] { this->_RunStage(dependent); });
+    }
+
+    this->_pendingStageCount.fetch_sub(1, std::memory_order_release);
+}
+
+} // namespace dull::process
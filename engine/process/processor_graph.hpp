@@ -0,0 +1,97 @@
+#pragma once
+
+#include "engine/process/i_processor.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Forward Declaration
+namespace dull::job { struct ThreadPool; }
+
+namespace dull::process {
+
+using ResourceId = uint32_t;
+
+// FNV-1a hash of a resource name
+[[nodiscard]] constexpr ResourceId MakeResourceId(std::string_view name) noexcept
+{
+    ResourceId hash = 2166136261U;
+
+    for (char character : name)
+    {
+        hash ^= static_cast<uint8_t>(character);
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+// ---
+// Resources a processor touches during its update callbacks
+// Note: an access declaring nothing conflicts with every stage, so processors added without one run serially
+// ---
+struct ResourceAccess final {
+    std::vector<ResourceId> reads;
+    std::vector<ResourceId> writes;
+
+    // Opt in for stages sharing no state at all, they run beside anything without declaring resources
+    bool isStateless = false;
+
+    [[nodiscard]] bool IsUndeclared() const noexcept { return this->reads.empty() && this->writes.empty() && !this->isStateless; }
+};
+
+// ---
+// Processor running many processors as a dependency graph
+// Note: stages whose resource accesses do not conflict run in parallel on the App thread pool
+// Note: running in parallel is opt in, a stage needs declared resources or ResourceAccess::isStateless
+// Note: IInit runs in registration order, IShutdown in reverse registration order
+// ---
+struct ProcessorGraph final : public IProcessor {
+private:
+    struct _Stage {
+        IProcessor&           processor;
+        ResourceAccess        access;
+        const char*           name;
+        std::vector<uint32_t> dependents;
+        uint32_t              dependencyCount = 0;
+    };
+
+    std::vector<_Stage> _stages;
+    std::unique_ptr<std::atomic<uint32_t>[]> _remainingDependencies;
+    std::atomic<uint32_t> _pendingStageCount {0};
+
+    job::ThreadPool* _threadPool = nullptr;
+    void (IProcessor::*_currentCallback)() = nullptr;
+
+    [[nodiscard]] static bool _IsConflicting(const ResourceAccess& lhs, const ResourceAccess& rhs) noexcept;
+
+    void _BuildEdges();
+    void _Execute(void (IProcessor::*callback)());
+    void _RunStage(uint32_t stageIndex);
+
+protected:
+    void IInit       () final;
+    void IUpdate     () final { this->_Execute(&IProcessor::IUpdate);      }
+    void IFixedUpdate() final { this->_Execute(&IProcessor::IFixedUpdate); }
+    void IShutdown   () final;
+
+public:
+    ProcessorGraph() = default;
+    ~ProcessorGraph() override = default;
+
+    ProcessorGraph(ProcessorGraph&&)                 = delete;
+    ProcessorGraph(const ProcessorGraph&)            = delete;
+    ProcessorGraph& operator=(ProcessorGraph&&)      = delete;
+    ProcessorGraph& operator=(const ProcessorGraph&) = delete;
+
+    // Note: must be called before App::Run, processors with no declared access run after every earlier stage and before every later one
+    // Note: name labels the stage's profile zones, it must outlive the profiler like every zone name (a string literal)
+    void Add(IProcessor& processor, ResourceAccess access = {}, const char* name = "ProcessorGraph::Stage");
+
+    [[nodiscard]] size_t GetStageCount() const noexcept { return this->_stages.size(); }
+};
+
+} // namespace dull::process
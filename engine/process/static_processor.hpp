@@ -0,0 +1,110 @@
+#pragma once
+
+#include "engine/process/i_processor.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace dull::process {
+
+// --- Static processor callbacks ---
+// Note: plain member functions, a processor defines only the callbacks it needs
+
+template <typename ProcessorT> concept _HasInit        = requires (ProcessorT& processor) { processor.Init();        };
+template <typename ProcessorT> concept _HasUpdate      = requires (ProcessorT& processor) { processor.Update();      };
+template <typename ProcessorT> concept _HasFixedUpdate = requires (ProcessorT& processor) { processor.FixedUpdate(); };
+template <typename ProcessorT> concept _HasShutdown    = requires (ProcessorT& processor) { processor.Shutdown();    };
+
+template <typename ProcessorT>
+concept StaticProcessable = std::is_default_constructible_v<ProcessorT> && (
+    _HasInit<ProcessorT> || _HasUpdate<ProcessorT> || _HasFixedUpdate<ProcessorT> || _HasShutdown<ProcessorT>
+);
+
+// ---
+// Processor running a fixed set of processors known at compile time
+// Note: processors are held by value and dispatched statically, the calls inline into one another
+// Note: a plain App reaches it through IProcessor, one indirect call per callback for the whole set
+// Note: a StaticApp calls it directly, the frame loop inlines the whole set
+// Note: Init and the updates run in declaration order, Shutdown in reverse declaration order
+// ---
+template <StaticProcessable... ProcessorTs>
+struct StaticProcessor final : public IProcessor {
+    friend core::App;
+
+private:
+    std::tuple<ProcessorTs...> _processors;
+
+    template <typename ProcessorT>
+    static void _Init(ProcessorT& processor)
+    {
+        if constexpr (_HasInit<ProcessorT>) processor.Init();
+    }
+
+    template <typename ProcessorT>
+    static void _Update(ProcessorT& processor)
+    {
+        if constexpr (_HasUpdate<ProcessorT>) processor.Update();
+    }
+
+    template <typename ProcessorT>
+    static void _FixedUpdate(ProcessorT& processor)
+    {
+        if constexpr (_HasFixedUpdate<ProcessorT>) processor.FixedUpdate();
+    }
+
+    template <typename ProcessorT>
+    static void _Shutdown(ProcessorT& processor)
+    {
+        if constexpr (_HasShutdown<ProcessorT>) processor.Shutdown();
+    }
+
+    template <size_t... INDICES>
+    void _ShutdownReversed(std::index_sequence<INDICES...>)
+    {
+        constexpr size_t LAST_INDEX = sizeof...(ProcessorTs) - 1;
+
+        (StaticProcessor::_Shutdown(std::get<LAST_INDEX - INDICES>(this->_processors)), ...);
+    }
+
+protected:
+    void IInit() final
+    {
+        std::apply([](auto&... processors) { (StaticProcessor::_Init(processors), ...); }, this->_processors);
+    }
+
+    void IUpdate() final
+    {
+        std::apply([](auto&... processors) { (StaticProcessor::_Update(processors), ...); }, this->_processors);
+    }
+
+    void IFixedUpdate() final
+    {
+        std::apply([](auto&... processors) { (StaticProcessor::_FixedUpdate(processors), ...); }, this->_processors);
+    }
+
+    void IShutdown() final
+    {
+        if constexpr (sizeof...(ProcessorTs) > 0) this->_ShutdownReversed(std::index_sequence_for<ProcessorTs...> {});
+    }
+
+public:
+    StaticProcessor() = default;
+    ~StaticProcessor() override = default;
+
+    StaticProcessor(StaticProcessor&&)                 = delete;
+    StaticProcessor(const StaticProcessor&)            = delete;
+    StaticProcessor& operator=(StaticProcessor&&)      = delete;
+    StaticProcessor& operator=(const StaticProcessor&) = delete;
+
+    template <typename ProcessorT>
+    [[nodiscard]] ProcessorT& Get() noexcept { return std::get<ProcessorT>(this->_processors); }
+
+    template <typename ProcessorT>
+    [[nodiscard]] const ProcessorT& Get() const noexcept { return std::get<ProcessorT>(this->_processors); }
+
+    [[nodiscard]] static constexpr size_t GetProcessorCount() noexcept { return sizeof...(ProcessorTs); }
+};
+
+} // namespace dull::process
@@ -0,0 +1,286 @@
+#include "engine/profile/profiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #include <x86intrin.h>
+    #define DULL_PROFILER_TSC
+#endif
+
+namespace dull::profile {
+
+static constexpr size_t RING_CAPACITY  = 1 << 14;
+static constexpr size_t SUMMARY_WINDOW = 240;
+
+// ---
+// Single producer ring, written by its thread and drained by the main thread
+// Note: a full ring drops the new event and counts it, the producer never blocks and never overwrites undrained slots
+// ---
+struct _RawEvent {
+    const char* name           = nullptr;
+    int64_t     startTimestamp = 0;
+    int64_t     endTimestamp   = 0;
+};
+
+struct _ThreadRing {
+    std::array<_RawEvent, RING_CAPACITY> events;
+    std::atomic<uint64_t> head {0};
+    std::atomic<uint64_t> tail {0};
+    std::atomic<uint64_t> droppedCount {0};
+    uint32_t threadId = 0;
+};
+
+struct _ZoneHistory {
+    std::array<int64_t, SUMMARY_WINDOW> frameTotalsNs {};
+    size_t   sampleCount  = 0;
+    size_t   cursor       = 0;
+    int64_t  frameTotalNs = 0;
+    uint32_t frameCalls   = 0;
+    uint32_t lastCalls    = 0;
+};
+
+static std::mutex sRingMutex;
+static std::vector<std::unique_ptr<_ThreadRing>> sRings;
+static thread_local _ThreadRing* sThreadRing = nullptr;
+
+static std::vector<ZoneEvent> sFrameEvents;
+static std::unordered_map<std::string_view, _ZoneHistory> sZoneHistories;
+
+static std::vector<ZoneEvent> sCapturedEvents;
+static size_t sMaxCapturedEvents = 0;
+static bool sIsCapturing = false;
+
+[[nodiscard]] static _ThreadRing& sGetThreadRing()
+{
+    if (sThreadRing != nullptr) [[likely]] return *sThreadRing;
+
+    std::lock_guard lock {sRingMutex};
+
+    sRings.push_back(std::make_unique<_ThreadRing>());
+    sThreadRing = sRings.back().get();
+    sThreadRing->threadId = static_cast<uint32_t>(sRings.size() - 1);
+
+    return *sThreadRing;
+}
+
+[[nodiscard]] static int64_t sSteadyNanoseconds() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#if defined(DULL_PROFILER_TSC)
+
+// Cycle counter reads cost a fraction of a clock call, they are mapped to nanoseconds against a steady clock anchor
+static const int64_t sAnchorTimestamp   = static_cast<int64_t>(__rdtsc());
+static const int64_t sAnchorNanoseconds = sSteadyNanoseconds();
+static double sNanosecondsPerTick = 1.0;
+
+static void sCalibrate() noexcept
+{
+    const int64_t ELAPSED_TICKS       = static_cast<int64_t>(__rdtsc()) - sAnchorTimestamp;
+    const int64_t ELAPSED_NANOSECONDS = sSteadyNanoseconds() - sAnchorNanoseconds;
+
+    // Too early for a stable ratio
+    if (ELAPSED_NANOSECONDS < 1'000'000) return;
+
+    sNanosecondsPerTick = static_cast<double>(ELAPSED_NANOSECONDS) / static_cast<double>(ELAPSED_TICKS);
+}
+
+[[nodiscard]] int64_t Profiler::Now() noexcept { return static_cast<int64_t>(__rdtsc()); }
+
+[[nodiscard]] int64_t Profiler::ToNanoseconds(int64_t timestamp) noexcept
+{
+    return sAnchorNanoseconds + static_cast<int64_t>(static_cast<double>(timestamp - sAnchorTimestamp) * sNanosecondsPerTick);
+}
+
+#else
+
+static void sCalibrate() noexcept {}
+
+[[nodiscard]] int64_t Profiler::Now() noexcept { return sSteadyNanoseconds(); }
+[[nodiscard]] int64_t Profiler::ToNanoseconds(int64_t timestamp) noexcept { return timestamp; }
+
+#endif
+
+void Profiler::_Record(const char* name, int64_t startTimestamp, int64_t endTimestamp) noexcept
+{
+    _ThreadRing& ring = sGetThreadRing();
+    const uint64_t HEAD = ring.head.load(std::memory_order_relaxed);
+
+    // The drain releases the slots it copied, anything newer is still being read
+    if (HEAD - ring.tail.load(std::memory_order_acquire) >= RING_CAPACITY) [[unlikely]]
+    {
+        ring.droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ring.events[HEAD & (RING_CAPACITY - 1)] = {name, startTimestamp, endTimestamp};
+    ring.head.store(HEAD + 1, std::memory_order_release);
+}
+
+void Profiler::EndFrame()
+{
+    sCalibrate();
+    sFrameEvents.clear();
+
+    {
+        std::lock_guard lock {sRingMutex};
+
+        for (const std::unique_ptr<_ThreadRing>& ring : sRings)
+        {
+            const uint64_t HEAD = ring->head.load(std::memory_order_acquire);
+            const uint64_t TAIL = ring->tail.load(std::memory_order_relaxed);
+
+            for (uint64_t index = TAIL; index < HEAD; index++)
+            {
+                const _RawEvent& event = ring->events[index & (RING_CAPACITY - 1)];
+
+                sFrameEvents.push_back({
+                    event.name,
+                    Profiler::ToNanoseconds(event.startTimestamp),
+                    Profiler::ToNanoseconds(event.endTimestamp),
+                    ring->threadId
+                });
+            }
+
+            ring->tail.store(HEAD, std::memory_order_release);
+        }
+    }
+
+    for (const ZoneEvent& event : sFrameEvents)
+    {
+        _ZoneHistory& history = sZoneHistories[event.name];
+        history.frameTotalNs += event.endNs - event.startNs;
+        history.frameCalls++;
+    }
+
+    for (auto& [name, history] : sZoneHistories)
+    {
+        if (history.frameCalls == 0) continue;
+
+        history.frameTotalsNs[history.cursor] = history.frameTotalNs;
+        history.cursor      = (history.cursor + 1) % SUMMARY_WINDOW;
+        history.sampleCount = std::min(history.sampleCount + 1, SUMMARY_WINDOW);
+        history.lastCalls   = history.frameCalls;
+
+        history.frameTotalNs = 0;
+        history.frameCalls   = 0;
+    }
+
+    if (!sIsCapturing) return;
+
+    const size_t CAPTURE_COUNT = std::min(sFrameEvents.size(), sMaxCapturedEvents - sCapturedEvents.size());
+    sCapturedEvents.insert(sCapturedEvents.end(), sFrameEvents.begin(), sFrameEvents.begin() + static_cast<std::ptrdiff_t>(CAPTURE_COUNT));
+
+    if (sCapturedEvents.size() == sMaxCapturedEvents) sIsCapturing = false;
+}
+
+[[nodiscard]] uint64_t Profiler::GetDroppedEventCount() noexcept
+{
+    std::lock_guard lock {sRingMutex};
+
+    uint64_t droppedCount = 0;
+    for (const std::unique_ptr<_ThreadRing>& ring : sRings) droppedCount += ring->droppedCount.load(std::memory_order_relaxed);
+
+    return droppedCount;
+}
+
+void Profiler::StartCapture(size_t maxEvents)
+{
+    sCapturedEvents.clear();
+    sCapturedEvents.reserve(maxEvents);
+    sMaxCapturedEvents = maxEvents;
+    sIsCapturing       = maxEvents > 0;
+}
+
+void Profiler::StopCapture() noexcept { sIsCapturing = false; }
+
+static void sWriteJsonString(std::ofstream& file, std::string_view text)
+{
+    file << '"';
+
+    for (char character : text)
+    {
+        if (character == '"' || character == '\\') file << '\\';
+        file << character;
+    }
+
+    file << '"';
+}
+
+[[nodiscard]] bool Profiler::WriteChromeTrace(const std::filesystem::path& path)
+{
+    std::ofstream file {path};
+    if (!file) return false;
+
+    const int64_t ORIGIN_NS = sCapturedEvents.empty() ? 0 : std::ranges::min_element(
+        sCapturedEvents, {}, &ZoneEvent::startNs
+    )->startNs;
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    for (size_t index = 0; index < sCapturedEvents.size(); index++)
+    {
+        const ZoneEvent& event = sCapturedEvents[index];
+
+        file << "{\"name\":";
+        sWriteJsonString(file, event.name);
+        file << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.threadId
+             << ",\"ts\":"  << static_cast<double>(event.startNs - ORIGIN_NS) / 1000.0
+             << ",\"dur\":" << static_cast<double>(event.endNs - event.startNs) / 1000.0
+             << (index + 1 < sCapturedEvents.size() ? "},\n" : "}\n");
+    }
+
+    file << "]}\n";
+    return static_cast<bool>(file);
+}
+
+[[nodiscard]] std::vector<ZoneSummary> Profiler::GetSummary()
+{
+    std::vector<ZoneSummary> summaries;
+    std::vector<int64_t> samples;
+
+    for (const auto& [name, history] : sZoneHistories)
+    {
+        if (history.sampleCount == 0) continue;
+
+        samples.assign(history.frameTotalsNs.begin(), history.frameTotalsNs.begin() + static_cast<std::ptrdiff_t>(history.sampleCount));
+        std::ranges::sort(samples);
+
+        int64_t totalNs = 0;
+        for (int64_t sample : samples) totalNs += sample;
+
+        const size_t P99_INDEX = std::min(samples.size() - 1, samples.size() * 99 / 100);
+
+        summaries.push_back({
+            name,
+            static_cast<double>(samples.front()) / 1e6,
+            static_cast<double>(totalNs) / static_cast<double>(samples.size()) / 1e6,
+            static_cast<double>(samples[P99_INDEX]) / 1e6,
+            history.lastCalls
+        });
+    }
+
+    std::ranges::sort(summaries, {}, &ZoneSummary::name);
+    return summaries;
+}
+
+void Profiler::LogSummary(zutil::Logger& logger)
+{
+    for (const ZoneSummary& summary : Profiler::GetSummary())
+    {
+        logger.Log(zutil::INFO, {
+            "{:<40} min {:>8.3f} ms | avg {:>8.3f} ms | p99 {:>8.3f} ms | {} calls",
+            summary.name, summary.minMs, summary.avgMs, summary.p99Ms, summary.callsPerFrame
+        });
+    }
+}
+
+} // namespace dull::profile
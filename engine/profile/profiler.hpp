@@ -0,0 +1,104 @@
+#pragma once
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+// Profiling compiles out only when both NDEBUG and DULL_PROFILER_OFF are defined
+#if defined(NDEBUG) && defined(DULL_PROFILER_OFF)
+    #define DULL_PROFILER_ENABLED 0
+#else
+    #define DULL_PROFILER_ENABLED 1
+#endif
+
+namespace dull::profile {
+
+// ---
+// One closed zone recorded by a thread
+// Note: name must point to storage that outlives the profiler, e.g. a string literal
+// ---
+struct ZoneEvent final {
+    const char* name    = nullptr;
+    int64_t     startNs = 0;
+    int64_t     endNs   = 0;
+    uint32_t    threadId = 0;
+};
+
+// ---
+// Rolling statistics of a zone, per frame totals over the recent window
+// ---
+struct ZoneSummary final {
+    std::string_view name;
+    double minMs = 0.0;
+    double avgMs = 0.0;
+    double p99Ms = 0.0;
+    uint32_t callsPerFrame = 0;
+};
+
+// ---
+// Collects zones recorded by all threads
+// Note: threads write to their own lock-free ring, the main thread drains them once per frame
+// ---
+struct Profiler final {
+    Profiler() = delete;
+
+    // Raw timestamp, CPU cycle counter where available, see ToNanoseconds
+    [[nodiscard]] static int64_t Now() noexcept;
+    [[nodiscard]] static int64_t ToNanoseconds(int64_t timestamp) noexcept;
+
+    static void _Record(const char* name, int64_t startTimestamp, int64_t endTimestamp) noexcept;
+
+    // Drains every thread ring and folds the frame into the rolling statistics
+    static void EndFrame();
+
+    // Events lost to full thread rings, a thread recording more than a ring holds between two EndFrame calls
+    [[nodiscard]] static uint64_t GetDroppedEventCount() noexcept;
+
+    // Keeps raw events from following frames for trace export, up to maxEvents
+    static void StartCapture(size_t maxEvents = 1 << 20);
+    static void StopCapture() noexcept;
+
+    // Writes captured events as Chrome trace-event JSON (chrome://tracing, Perfetto)
+    [[nodiscard]] static bool WriteChromeTrace(const std::filesystem::path& path);
+
+    [[nodiscard]] static std::vector<ZoneSummary> GetSummary();
+    static void LogSummary(zutil::Logger& logger);
+};
+
+// ---
+// Records the lifetime of the scope as a zone
+// ---
+struct ProfileZone final {
+private:
+    const char* _name;
+    int64_t     _startTimestamp;
+
+public:
+    explicit ProfileZone(const char* name) noexcept : _name {name}, _startTimestamp {Profiler::Now()} {}
+    ~ProfileZone() noexcept { Profiler::_Record(this->_name, this->_startTimestamp, Profiler::Now()); }
+
+    ProfileZone(ProfileZone&&)                 = delete;
+    ProfileZone(const ProfileZone&)            = delete;
+    ProfileZone& operator=(ProfileZone&&)      = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+};
+
+} // namespace dull::profile
+
+/// MACROS:
+
+#define DULL_PROFILE_CONCAT_INNER(lhs, rhs) lhs##rhs
+#define DULL_PROFILE_CONCAT(lhs, rhs) DULL_PROFILE_CONCAT_INNER(lhs, rhs)
+
+#if DULL_PROFILER_ENABLED
+    #define DULL_PROFILE_ZONE(name) const ::dull::profile::ProfileZone DULL_PROFILE_CONCAT(_dullProfileZone, __LINE__) {name}
+    #define DULL_PROFILE_FUNCTION() DULL_PROFILE_ZONE(__func__)
+    #define DULL_PROFILE_END_FRAME() ::dull::profile::Profiler::EndFrame()
+#else
+    #define DULL_PROFILE_ZONE(name) ((void)0)
+    #define DULL_PROFILE_FUNCTION() ((void)0)
+    #define DULL_PROFILE_END_FRAME() ((void)0)
+#endif
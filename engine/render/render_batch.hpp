@@ -0,0 +1,80 @@
+#pragma once
+
+#include "engine/util/color_rgba.hpp"
+#include "engine/util/vec2.hpp"
+
+#include <vendor/raylib.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace dull::render {
+
+// Note: values match rl::BlendMode
+enum class BlendMode : uint8_t {
+    Alpha      = 0,
+    Additive   = 1,
+    Multiplied = 2,
+};
+
+// ---
+// Non-owning reference to a GPU texture
+// Note: id 0 means untextured, the batch is drawn with flat colors
+// ---
+struct Texture {
+    uint32_t id     {0};
+    int32_t  width  {0};
+    int32_t  height {0};
+
+// --- Constructors ---
+
+    constexpr Texture() noexcept = default;
+
+    constexpr Texture(uint32_t id, int32_t width, int32_t height) noexcept
+        : id {id}, width {width}, height {height}
+    {}
+
+    constexpr Texture(const rl::Texture2D& rlTexture) noexcept
+        : id {rlTexture.id}, width {rlTexture.width}, height {rlTexture.height}
+    {}
+
+    [[nodiscard]] constexpr bool IsNull() const noexcept { return this->id == 0; }
+
+    constexpr bool operator == (const Texture& other) const noexcept = default;
+};
+
+// ---
+// Vertex of a batched quad
+// Note: uv is in texels, quads are wound top-left, top-right, bottom-right, bottom-left
+// ---
+struct Vertex {
+    util::Vec2f position;
+    util::Vec2f uv;
+    util::Color color;
+};
+
+// ---
+// Run of quads sharing texture and blend mode, drawn as one submission
+// ---
+struct DrawBatch {
+    Texture   texture;
+    BlendMode blend       = BlendMode::Alpha;
+    uint32_t  firstVertex = 0;
+    uint32_t  vertexCount = 0;
+};
+
+// ---
+// Everything a backend needs to draw one frame
+// ---
+struct RenderBatchList {
+    std::vector<Vertex>    vertices;
+    std::vector<DrawBatch> batches;
+
+    void Clear() noexcept
+    {
+        this->vertices.clear();
+        this->batches.clear();
+    }
+};
+
+} // namespace dull::render
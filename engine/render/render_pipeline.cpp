@@ -0,0 +1,80 @@
+#include "engine/render/render_pipeline.hpp"
+#include "engine/core/app.hpp"
+#include "engine/profile/profiler.hpp"
+#include "engine/render/render_queue.hpp"
+
+namespace dull::render {
+
+void RenderPipeline::_Start(platform::IBackend& backend, const core::WindowContext& windowContext)
+{
+    this->_backendPtr = &backend;
+    this->_thread     = std::thread {[this, windowContext] { this->_RenderLoop(windowContext); }};
+
+    this->_isBackendOpen.wait(false, std::memory_order_acquire);
+}
+
+void RenderPipeline::_Stop() noexcept
+{
+    if (!this->_thread.joinable()) return;
+
+    // The last submitted frame still gets presented
+    this->_frames.WaitConsumed();
+    this->_frames.GetBack().isClosing = true;
+    this->_frames.Publish();
+
+    this->_thread.join();
+}
+
+void RenderPipeline::_RenderLoop(const core::WindowContext& windowContext)
+{
+    this->_backendPtr->IOpen(windowContext);
+
+    this->_isBackendOpen.store(true, std::memory_order_release);
+    this->_isBackendOpen.notify_one();
+
+    while (true)
+    {
+        this->_frames.WaitPublished();
+        (void)this->_frames.Acquire();
+
+        const _Frame& frame = this->_frames.GetFront();
+
+        if (frame.isClosing) break;
+
+        DULL_PROFILE_ZONE("RenderPipeline::Present");
+
+        _InputFrame& inputFrame = this->_inputs.GetBack();
+
+        this->_backendPtr->IPollInput(inputFrame.input);
+        inputFrame.isCloseRequested = this->_backendPtr->IShouldClose();
+        this->_inputs.Publish();
+
+        this->_backendPtr->IBeginFrame();
+        this->_backendPtr->IDraw(frame.batchList);
+        this->_backendPtr->IEndFrame();
+
+        this->_presentedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    this->_backendPtr->IClose();
+}
+
+void RenderPipeline::_PollInput(platform::InputSnapshot& input) noexcept
+{
+    (void)this->_inputs.Acquire();
+    input = this->_inputs.GetFront().input;
+}
+
+void RenderPipeline::_Submit(RenderQueue& renderQueue)
+{
+    renderQueue.Flush(this->_frames.GetBack().batchList);
+
+    {
+        DULL_PROFILE_ZONE("RenderPipeline::WaitPresent");
+        this->_frames.WaitConsumed();
+    }
+
+    this->_frames.Publish();
+}
+
+} // namespace dull::render
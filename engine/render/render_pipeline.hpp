@@ -0,0 +1,76 @@
+#pragma once
+
+#include "engine/job/triple_buffer.hpp"
+#include "engine/platform/i_backend.hpp"
+#include "engine/platform/input_snapshot.hpp"
+#include "engine/render/render_batch.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+// Forward Declaration
+namespace dull::core { struct App; struct WindowContext; }
+
+namespace dull::render {
+
+// Forward Declaration
+struct RenderQueue;
+
+// ---
+// Render thread presenting frame N while the main thread simulates frame N+1
+// Note: the backend lives on the render thread from open to close, input and close requests come back through a second buffer
+// Note: the main thread waits only when the render thread hasn't picked up the previous frame yet, frames are never skipped
+// ---
+struct RenderPipeline final {
+    friend core::App;
+
+private:
+    struct _Frame {
+        RenderBatchList batchList;
+        bool isClosing = false;
+    };
+
+    struct _InputFrame {
+        platform::InputSnapshot input;
+        bool isCloseRequested = false;
+    };
+
+    platform::IBackend* _backendPtr = nullptr;
+    job::TripleBuffer<_Frame> _frames;
+    job::TripleBuffer<_InputFrame> _inputs;
+    std::atomic<bool> _isBackendOpen {false};
+    std::atomic<uint64_t> _presentedCount {0};
+    std::thread _thread;
+
+    // Opens the backend on a new render thread, returns once it's open
+    void _Start(platform::IBackend& backend, const core::WindowContext& windowContext);
+
+    // Presents the frame in flight, then closes the backend on the render thread
+    void _Stop() noexcept;
+
+    void _RenderLoop(const core::WindowContext& windowContext);
+
+    // Latest input the render thread polled, main thread only
+    void _PollInput(platform::InputSnapshot& input) noexcept;
+    [[nodiscard]] bool _IsCloseRequested() noexcept { return this->_inputs.GetFront().isCloseRequested; }
+
+    // Flushes the queue into the next frame and hands it to the render thread
+    void _Submit(RenderQueue& renderQueue);
+
+public:
+    RenderPipeline(RenderPipeline&&)                 = delete;
+    RenderPipeline(const RenderPipeline&)            = delete;
+    RenderPipeline& operator=(RenderPipeline&&)      = delete;
+    RenderPipeline& operator=(const RenderPipeline&) = delete;
+
+    RenderPipeline() = default;
+    ~RenderPipeline() noexcept { this->_Stop(); }
+
+    [[nodiscard]] bool IsActive() const noexcept { return this->_thread.joinable(); }
+
+    // Frames the render thread finished presenting
+    [[nodiscard]] uint64_t GetPresentedCount() const noexcept { return this->_presentedCount.load(std::memory_order_relaxed); }
+};
+
+} // namespace dull::render
@@ -0,0 +1,197 @@
+#include "engine/render/render_queue.hpp"
+#include "engine/job/thread_pool.hpp"
+#include "engine/profile/profiler.hpp"
+
+#include <utility>
+
+namespace dull::render {
+
+RenderQueue::RenderQueue(const job::ThreadPool* threadPoolPtr)
+    : _threadPoolPtr {threadPoolPtr}
+    , _lanes(threadPoolPtr == nullptr ? 1 : threadPoolPtr->GetThreadCount() + 1)
+{}
+
+void RenderQueue::_Push(const std::array<Vertex, 4>& vertices, const Texture& texture, int16_t layer, BlendMode blend)
+{
+    const uint32_t LANE_INDEX = this->_threadPoolPtr == nullptr ? 0 : this->_threadPoolPtr->GetCurrentWorkerIndex();
+
+    this->_lanes[LANE_INDEX].commands.push_back({_SortKey(layer, blend, texture), vertices, texture, blend});
+}
+
+void RenderQueue::SubmitRect(const util::Rect& rect, util::Color color, int16_t layer, BlendMode blend)
+{
+    const float RIGHT  = rect.x + rect.w;
+    const float BOTTOM = rect.y + rect.h;
+
+    this->_Push(
+        {
+            Vertex {{rect.x, rect.y}, {}, color},
+            Vertex {{RIGHT , rect.y}, {}, color},
+            Vertex {{RIGHT , BOTTOM}, {}, color},
+            Vertex {{rect.x, BOTTOM}, {}, color},
+        },
+        {}, layer, blend
+    );
+}
+
+void RenderQueue::SubmitSprite(
+    const Texture& texture,
+    const util::Rect& source,
+    const util::Rect& destination,
+    util::Color tint,
+    int16_t layer,
+    BlendMode blend
+) {
+    const float RIGHT      = destination.x + destination.w;
+    const float BOTTOM     = destination.y + destination.h;
+    const float SRC_RIGHT  = source.x + source.w;
+    const float SRC_BOTTOM = source.y + source.h;
+
+    this->_Push(
+        {
+            Vertex {{destination.x, destination.y}, {source.x , source.y  }, tint},
+            Vertex {{RIGHT        , destination.y}, {SRC_RIGHT, source.y  }, tint},
+            Vertex {{RIGHT        , BOTTOM       }, {SRC_RIGHT, SRC_BOTTOM}, tint},
+            Vertex {{destination.x, BOTTOM       }, {source.x , SRC_BOTTOM}, tint},
+        },
+        texture, layer, blend
+    );
+}
+
+void RenderQueue::SubmitLine(
+    const util::Vec2f& from,
+    const util::Vec2f& to,
+    float thickness,
+    util::Color color,
+    int16_t layer,
+    BlendMode blend
+) {
+    const util::Vec2f OFFSET = (to - from).Normalized().Perpendicular() * (thickness * 0.5F);
+
+    this->_Push(
+        {
+            Vertex {from + OFFSET, {}, color},
+            Vertex {to   + OFFSET, {}, color},
+            Vertex {to   - OFFSET, {}, color},
+            Vertex {from - OFFSET, {}, color},
+        },
+        {}, layer, blend
+    );
+}
+
+void RenderQueue::SubmitTriangle(
+    const util::Vec2f& a,
+    const util::Vec2f& b,
+    const util::Vec2f& c,
+    util::Color color,
+    int16_t layer,
+    BlendMode blend
+) {
+    // Degenerate quad, the last corner repeats so every command has the same shape
+    this->_Push(
+        {
+            Vertex {a, {}, color},
+            Vertex {b, {}, color},
+            Vertex {c, {}, color},
+            Vertex {c, {}, color},
+        },
+        {}, layer, blend
+    );
+}
+
+void RenderQueue::SubmitQuads(const Texture& texture, std::span<const Vertex> vertices, int16_t layer, BlendMode blend)
+{
+    const uint32_t LANE_INDEX = this->_threadPoolPtr == nullptr ? 0 : this->_threadPoolPtr->GetCurrentWorkerIndex();
+    const uint64_t KEY = _SortKey(layer, blend, texture);
+
+    std::vector<_Command>& commands = this->_lanes[LANE_INDEX].commands;
+
+    for (size_t index = 0; index + 4 <= vertices.size(); index += 4)
+        commands.push_back({KEY, {vertices[index], vertices[index + 1], vertices[index + 2], vertices[index + 3]}, texture, blend});
+}
+
+[[nodiscard]] size_t RenderQueue::GetCommandCount() const noexcept
+{
+    size_t commandCount = 0;
+
+    for (const _Lane& lane : this->_lanes) commandCount += lane.commands.size();
+
+    return commandCount;
+}
+
+// LSD radix sort, 8 bits per pass, stable so equal keys keep submission order
+// Note: bytes that are the same in every key are skipped, usually leaving 2-3 passes
+void RenderQueue::_SortEntries()
+{
+    if (this->_entries.size() < 2) return;
+
+    uint64_t varyingBits = 0;
+    const uint64_t FIRST_KEY = this->_entries.front().key;
+
+    for (const _SortEntry& entry : this->_entries) varyingBits |= entry.key ^ FIRST_KEY;
+
+    this->_scratch.resize(this->_entries.size());
+
+    for (uint32_t shift = 0; shift < 64; shift += 8)
+    {
+        if (((varyingBits >> shift) & 0xFF) == 0) continue;
+
+        std::array<uint32_t, 256> offsets {};
+
+        for (const _SortEntry& entry : this->_entries) offsets[(entry.key >> shift) & 0xFF]++;
+
+        uint32_t runningOffset = 0;
+
+        for (uint32_t& offset : offsets) runningOffset += std::exchange(offset, runningOffset);
+
+        for (const _SortEntry& entry : this->_entries) this->_scratch[offsets[(entry.key >> shift) & 0xFF]++] = entry;
+
+        this->_entries.swap(this->_scratch);
+    }
+}
+
+void RenderQueue::Flush(RenderBatchList& batchList)
+{
+    DULL_PROFILE_FUNCTION();
+
+    batchList.Clear();
+    this->_entries.clear();
+
+    // Only keys and pointers are sorted, commands stay in their lanes until copied out once
+    for (const _Lane& lane : this->_lanes)
+        for (const _Command& command : lane.commands) this->_entries.push_back({command.key, &command});
+
+    this->_SortEntries();
+
+    batchList.vertices.reserve(this->_entries.size() * 4);
+
+    for (const _SortEntry& entry : this->_entries)
+    {
+        const _Command& command = *entry.commandPtr;
+
+        if (
+            batchList.batches.empty()
+            || batchList.batches.back().texture != command.texture
+            || batchList.batches.back().blend   != command.blend
+        ) {
+            batchList.batches.push_back({
+                command.texture,
+                command.blend,
+                static_cast<uint32_t>(batchList.vertices.size()),
+                0
+            });
+        }
+
+        batchList.vertices.insert(batchList.vertices.end(), command.vertices.begin(), command.vertices.end());
+        batchList.batches.back().vertexCount += 4;
+    }
+
+    this->Clear();
+}
+
+void RenderQueue::Clear() noexcept
+{
+    for (_Lane& lane : this->_lanes) lane.commands.clear();
+}
+
+} // namespace dull::render
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "engine/render/render_batch.hpp"
+#include "engine/util/color_rgba.hpp"
+#include "engine/util/rect.hpp"
+#include "engine/util/vec2.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Forward Declaration
+namespace dull::job { struct ThreadPool; }
+
+namespace dull::render {
+
+// ---
+// Per-frame list of draw commands, sorted and merged into batches on flush
+// Note: commands draw by ascending layer, order inside a layer follows texture and blend mode, not submission
+// Note: safe to submit from the main thread and pool workers at once, every thread writes its own lane
+// ---
+struct RenderQueue final {
+private:
+    struct _Command {
+        uint64_t key;
+        std::array<Vertex, 4> vertices;
+        Texture   texture;
+        BlendMode blend;
+    };
+
+    struct _SortEntry {
+        uint64_t        key;
+        const _Command* commandPtr;
+    };
+
+    struct alignas(64) _Lane {
+        std::vector<_Command> commands;
+    };
+
+    const job::ThreadPool* _threadPoolPtr = nullptr;
+    std::vector<_Lane> _lanes;
+    std::vector<_SortEntry> _entries;
+    std::vector<_SortEntry> _scratch;
+
+    // layer (16) | blend (8) | unused (8) | texture (32)
+    [[nodiscard]] static constexpr uint64_t _SortKey(int16_t layer, BlendMode blend, const Texture& texture) noexcept
+    {
+        return (static_cast<uint64_t>(static_cast<uint16_t>(layer) ^ 0x8000U) << 48)
+            | (static_cast<uint64_t>(blend) << 32)
+            | texture.id
+        ;
+    }
+
+    void _Push(const std::array<Vertex, 4>& vertices, const Texture& texture, int16_t layer, BlendMode blend);
+    void _SortEntries();
+
+public:
+    RenderQueue(RenderQueue&&)                 = delete;
+    RenderQueue(const RenderQueue&)            = delete;
+    RenderQueue& operator=(RenderQueue&&)      = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
+    // Note: without a pool every submission must come from one thread
+    explicit RenderQueue(const job::ThreadPool* threadPoolPtr = nullptr);
+
+    void SubmitRect(const util::Rect& rect, util::Color color, int16_t layer = 0, BlendMode blend = BlendMode::Alpha);
+
+    void SubmitSprite(
+        const Texture& texture,
+        const util::Rect& source,
+        const util::Rect& destination,
+        util::Color tint = util::Color::White(),
+        int16_t layer = 0,
+        BlendMode blend = BlendMode::Alpha
+    );
+
+    void SubmitLine(
+        const util::Vec2f& from,
+        const util::Vec2f& to,
+        float thickness,
+        util::Color color,
+        int16_t layer = 0,
+        BlendMode blend = BlendMode::Alpha
+    );
+
+    void SubmitTriangle(
+        const util::Vec2f& a,
+        const util::Vec2f& b,
+        const util::Vec2f& c,
+        util::Color color,
+        int16_t layer = 0,
+        BlendMode blend = BlendMode::Alpha
+    );
+
+    // Queues prebuilt quads sharing a texture, four vertices each in Vertex winding
+    // Note: for cached geometry like tile map chunks, the key and lane are worked out once for the whole run
+    void SubmitQuads(const Texture& texture, std::span<const Vertex> vertices, int16_t layer = 0, BlendMode blend = BlendMode::Alpha);
+
+    [[nodiscard]] size_t GetCommandCount() const noexcept;
+    [[nodiscard]] const job::ThreadPool* GetThreadPool() const noexcept { return this->_threadPoolPtr; }
+
+    // Sorts everything submitted so far into batchList and empties the queue
+    // Note: must not race with submissions
+    void Flush(RenderBatchList& batchList);
+    void Clear() noexcept;
+};
+
+} // namespace dull::render
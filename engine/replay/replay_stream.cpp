@@ -0,0 +1,95 @@
+#include "engine/replay/replay_stream.hpp"
+
+#include <iterator>
+
+namespace dull::replay {
+
+ReplayWriter::ReplayWriter(const std::string& path)
+    : _file {path, std::ios::binary | std::ios::trunc}
+{
+    this->_buffer.reserve(FLUSH_SIZE * 2);
+}
+
+void ReplayWriter::WriteByte(uint8_t value) { this->_buffer.push_back(value); }
+
+void ReplayWriter::WriteVarint(uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        this->_buffer.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+
+    this->_buffer.push_back(static_cast<uint8_t>(value));
+}
+
+void ReplayWriter::WriteRaw64(uint64_t value)
+{
+    for (uint32_t shift = 0; shift < 64; shift += 8) this->_buffer.push_back(static_cast<uint8_t>(value >> shift));
+}
+
+void ReplayWriter::Commit()
+{
+    if (this->_buffer.size() >= FLUSH_SIZE) this->Flush();
+}
+
+void ReplayWriter::Flush() noexcept
+{
+    if (this->_buffer.empty()) return;
+
+    this->_file.write(reinterpret_cast<const char*>(this->_buffer.data()), static_cast<std::streamsize>(this->_buffer.size()));
+    this->_file.flush();
+    this->_writtenBytes += this->_buffer.size();
+    this->_buffer.clear();
+}
+
+ReplayReader::ReplayReader(const std::string& path)
+{
+    std::ifstream file {path, std::ios::binary};
+
+    if (!file.is_open())
+    {
+        this->_hasFailed = true;
+        return;
+    }
+
+    this->_bytes.assign(std::istreambuf_iterator<char> {file}, std::istreambuf_iterator<char> {});
+}
+
+[[nodiscard]] uint8_t ReplayReader::ReadByte() noexcept
+{
+    if (this->IsAtEnd()) [[unlikely]]
+    {
+        this->_hasFailed = true;
+        return 0;
+    }
+
+    return this->_bytes[this->_cursor++];
+}
+
+[[nodiscard]] uint64_t ReplayReader::ReadVarint() noexcept
+{
+    uint64_t value = 0;
+
+    for (uint32_t shift = 0; shift < 64; shift += 7)
+    {
+        const uint8_t BYTE = this->ReadByte();
+        value |= static_cast<uint64_t>(BYTE & 0x7F) << shift;
+
+        if ((BYTE & 0x80) == 0) return value;
+    }
+
+    this->_hasFailed = true;
+    return value;
+}
+
+[[nodiscard]] uint64_t ReplayReader::ReadRaw64() noexcept
+{
+    uint64_t value = 0;
+
+    for (uint32_t shift = 0; shift < 64; shift += 8) value |= static_cast<uint64_t>(this->ReadByte()) << shift;
+
+    return value;
+}
+
+} // namespace dull::replay
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace dull::replay {
+
+// ---
+// Buffered binary writer streaming to a file
+// Note: integers are LEB128 varints unless written raw
+// ---
+struct ReplayWriter final {
+private:
+    static constexpr size_t FLUSH_SIZE = 64 * 1024;
+
+    std::ofstream _file;
+    std::vector<uint8_t> _buffer;
+    uint64_t _writtenBytes = 0;
+
+public:
+    ReplayWriter(ReplayWriter&&)                 = delete;
+    ReplayWriter(const ReplayWriter&)            = delete;
+    ReplayWriter& operator=(ReplayWriter&&)      = delete;
+    ReplayWriter& operator=(const ReplayWriter&) = delete;
+
+    explicit ReplayWriter(const std::string& path);
+    ~ReplayWriter() noexcept { this->Flush(); }
+
+    [[nodiscard]] bool IsOpen() const noexcept { return this->_file.is_open(); }
+    [[nodiscard]] uint64_t GetWrittenBytes() const noexcept { return this->_writtenBytes; }
+
+    void WriteByte  (uint8_t value);
+    void WriteVarint(uint64_t value);
+    void WriteRaw64 (uint64_t value);
+
+    // Hands the buffer to the file once it's large enough, call at record boundaries
+    void Commit();
+    void Flush() noexcept;
+};
+
+// ---
+// Binary reader over a whole file loaded in memory
+// Note: reading past the end returns zeros and marks the reader failed instead of throwing
+// ---
+struct ReplayReader final {
+private:
+    std::vector<uint8_t> _bytes;
+    size_t _cursor    = 0;
+    bool   _hasFailed = false;
+
+public:
+    explicit ReplayReader(const std::string& path);
+
+    [[nodiscard]] bool IsAtEnd() const noexcept { return this->_cursor >= this->_bytes.size(); }
+    [[nodiscard]] bool HasFailed() const noexcept { return this->_hasFailed; }
+
+    [[nodiscard]] uint8_t  ReadByte  () noexcept;
+    [[nodiscard]] uint64_t ReadVarint() noexcept;
+    [[nodiscard]] uint64_t ReadRaw64 () noexcept;
+};
+
+} // namespace dull::replay
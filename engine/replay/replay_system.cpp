@@ -0,0 +1,247 @@
+#include "engine/replay/replay_system.hpp"
+#include "engine/core/app.hpp"
+
+#include <bit>
+#include <format>
+
+namespace dull::replay {
+
+ReplaySystem::ReplaySystem()
+: zutil::Logger {
+    {
+        config::DULL_TAG,
+        {"[REPLAY]", zutil::ANSI::EX_Black}
+    }
+}
+{}
+
+void ReplaySystem::_Open(const core::WindowContext& windowContext, const platform::IClock& liveClock)
+{
+    this->_liveClockPtr = &liveClock;
+
+    if (!windowContext.replayPath.empty())
+    {
+        this->_mode      = ReplayMode::Replay;
+        this->_readerPtr = std::make_unique<ReplayReader>(windowContext.replayPath);
+
+        zutil::Assert(!this->_readerPtr->HasFailed(), "Replay file could not be opened");
+        zutil::Assert(this->_readerPtr->ReadRaw64() == MAGIC, "Not a replay file");
+        zutil::Assert(this->_readerPtr->ReadVarint() == VERSION, "Unsupported replay version");
+        zutil::Assert(this->_readerPtr->ReadVarint() == windowContext.ticksPerSecond, "Replay recorded with another tick rate");
+
+        this->Log(zutil::INFO, {"Replaying '{}'", windowContext.replayPath});
+        return;
+    }
+
+    if (!windowContext.recordPath.empty())
+    {
+        this->_mode      = ReplayMode::Record;
+        this->_writerPtr = std::make_unique<ReplayWriter>(windowContext.recordPath);
+
+        zutil::Assert(this->_writerPtr->IsOpen(), "Replay file could not be created");
+
+        this->_writerPtr->WriteRaw64(MAGIC);
+        this->_writerPtr->WriteVarint(VERSION);
+        this->_writerPtr->WriteVarint(windowContext.ticksPerSecond);
+        this->Log(zutil::INFO, {"Recording '{}'", windowContext.recordPath});
+    }
+}
+
+[[nodiscard]] const platform::IClock& ReplaySystem::_GetClock() const noexcept
+{
+    if (this->_mode == ReplayMode::Replay) return this->_replayClock;
+    return *this->_liveClockPtr;
+}
+
+void ReplaySystem::_SyncTime(double& time)
+{
+    switch (this->_mode)
+    {
+    case ReplayMode::Record:
+        this->_writerPtr->WriteRaw64(std::bit_cast<uint64_t>(time));
+        this->_previousTimeBits = std::bit_cast<uint64_t>(time);
+        break;
+
+    case ReplayMode::Replay:
+        this->_previousTimeBits = this->_readerPtr->ReadRaw64();
+        time = std::bit_cast<double>(this->_previousTimeBits);
+        this->_replayClock.Set(time);
+        break;
+
+    case ReplayMode::Off: break;
+    }
+}
+
+[[nodiscard]] bool ReplaySystem::_PrepareFrame(platform::InputSnapshot& input)
+{
+    if (this->_mode != ReplayMode::Replay) return true;
+
+    ReplayReader& reader = *this->_readerPtr;
+
+    if (reader.IsAtEnd())
+    {
+        this->Log(zutil::INFO, {"Replay finished after {} frames", this->_frameCount});
+        return false;
+    }
+
+    this->_previousTimeBits ^= reader.ReadVarint();
+    this->_tickCount = static_cast<uint32_t>(reader.ReadVarint());
+
+    const uint8_t FLAGS = reader.ReadByte();
+
+    this->_ReadInput(this->_previousInput, FLAGS);
+    this->_hasHashes = (FLAGS & HASHES) != 0;
+
+    for (uint32_t tick = 0; this->_hasHashes && tick < this->_tickCount; tick++)
+    {
+        const uint64_t TICK_HASH = reader.ReadRaw64();
+        if (tick < this->_tickHashes.size()) this->_tickHashes[tick] = TICK_HASH;
+    }
+
+    if (reader.HasFailed())
+    {
+        this->Log(zutil::INFO, {"Replay log truncated after {} frames", this->_frameCount});
+        return false;
+    }
+
+    this->_replayClock.Set(std::bit_cast<double>(this->_previousTimeBits));
+    input = this->_previousInput;
+
+    return true;
+}
+
+void ReplaySystem::_BeginFrame(double time, uint32_t tickCount, const platform::InputSnapshot& input)
+{
+    this->_tickIndex = 0;
+
+    switch (this->_mode)
+    {
+    case ReplayMode::Record:
+    {
+        const uint64_t TIME_BITS = std::bit_cast<uint64_t>(time);
+
+        uint8_t flags = this->_stateHasher ? HASHES : 0;
+
+        for (uint32_t word = 0; word < platform::InputSnapshot::KEY_WORDS; word++)
+            if (input.keyWords[word] != this->_previousInput.keyWords[word]) flags |= KEYS;
+
+        if (input.mouseButtons  != this->_previousInput.mouseButtons ) flags |= BUTTONS;
+        if (input.mousePosition != this->_previousInput.mousePosition) flags |= POSITION;
+        if (input.mouseWheel    != 0.0F                              ) flags |= WHEEL;
+
+        this->_writerPtr->WriteVarint(TIME_BITS ^ this->_previousTimeBits);
+        this->_writerPtr->WriteVarint(tickCount);
+        this->_writerPtr->WriteByte(flags);
+        this->_WriteInput(input, flags);
+
+        this->_previousTimeBits = TIME_BITS;
+        this->_previousInput    = input;
+        this->_tickCount        = tickCount;
+        this->_hasHashes        = (flags & HASHES) != 0;
+        break;
+    }
+
+    case ReplayMode::Replay:
+        if (tickCount != this->_tickCount) this->_MarkDesync("fixed tick count");
+        break;
+
+    case ReplayMode::Off: break;
+    }
+}
+
+void ReplaySystem::_EndFixedTick()
+{
+    const uint32_t TICK_INDEX = this->_tickIndex++;
+
+    if (!this->_hasHashes || TICK_INDEX >= this->_tickCount || TICK_INDEX >= this->_tickHashes.size()) return;
+
+    switch (this->_mode)
+    {
+    case ReplayMode::Record:
+        this->_writerPtr->WriteRaw64(this->_stateHasher());
+        break;
+
+    case ReplayMode::Replay:
+        if (this->_stateHasher && this->_stateHasher() != this->_tickHashes[TICK_INDEX]) this->_MarkDesync("state hash");
+        break;
+
+    case ReplayMode::Off: break;
+    }
+}
+
+void ReplaySystem::_EndFrame()
+{
+    if (this->_mode == ReplayMode::Off) return;
+    if (this->_mode == ReplayMode::Record) this->_writerPtr->Commit();
+
+    this->_frameCount++;
+}
+
+// Keys: mask of the changed 64 key words, then each changed word XOR'd with its previous value
+// Position: float bits XOR'd with the previous ones, small moves keep the high bits equal
+void ReplaySystem::_WriteInput(const platform::InputSnapshot& input, uint8_t flags)
+{
+    ReplayWriter& writer = *this->_writerPtr;
+
+    if (flags & KEYS)
+    {
+        uint64_t changedWords = 0;
+
+        for (uint32_t word = 0; word < platform::InputSnapshot::KEY_WORDS; word++)
+            if (input.keyWords[word] != this->_previousInput.keyWords[word]) changedWords |= uint64_t {1} << word;
+
+        writer.WriteVarint(changedWords);
+
+        for (uint32_t word = 0; word < platform::InputSnapshot::KEY_WORDS; word++)
+            if ((changedWords >> word) & 1) writer.WriteVarint(input.keyWords[word] ^ this->_previousInput.keyWords[word]);
+    }
+
+    if (flags & BUTTONS) writer.WriteByte(input.mouseButtons);
+
+    if (flags & POSITION)
+    {
+        writer.WriteVarint(std::bit_cast<uint32_t>(input.mousePosition.x) ^ std::bit_cast<uint32_t>(this->_previousInput.mousePosition.x));
+        writer.WriteVarint(std::bit_cast<uint32_t>(input.mousePosition.y) ^ std::bit_cast<uint32_t>(this->_previousInput.mousePosition.y));
+    }
+
+    if (flags & WHEEL) writer.WriteVarint(std::bit_cast<uint32_t>(input.mouseWheel));
+}
+
+// Note: decodes in place over the previous frame's input
+void ReplaySystem::_ReadInput(platform::InputSnapshot& input, uint8_t flags) noexcept
+{
+    ReplayReader& reader = *this->_readerPtr;
+
+    if (flags & KEYS)
+    {
+        const uint64_t CHANGED_WORDS = reader.ReadVarint();
+
+        for (uint32_t word = 0; word < platform::InputSnapshot::KEY_WORDS; word++)
+            if ((CHANGED_WORDS >> word) & 1) input.keyWords[word] ^= reader.ReadVarint();
+    }
+
+    if (flags & BUTTONS) input.mouseButtons = reader.ReadByte();
+
+    if (flags & POSITION)
+    {
+        const uint32_t X_BITS = std::bit_cast<uint32_t>(input.mousePosition.x) ^ static_cast<uint32_t>(reader.ReadVarint());
+        const uint32_t Y_BITS = std::bit_cast<uint32_t>(input.mousePosition.y) ^ static_cast<uint32_t>(reader.ReadVarint());
+
+        input.mousePosition = {std::bit_cast<float>(X_BITS), std::bit_cast<float>(Y_BITS)};
+    }
+
+    input.mouseWheel = (flags & WHEEL) ? std::bit_cast<float>(static_cast<uint32_t>(reader.ReadVarint())) : 0.0F;
+}
+
+void ReplaySystem::_MarkDesync(const char* reason)
+{
+    if (this->_hasDesynced) return;
+
+    this->_hasDesynced = true;
+    this->_desyncFrame = this->_frameCount;
+    this->_desyncTick  = this->_tickIndex == 0 ? 0 : this->_tickIndex - 1;
+
+    this->Log(zutil::INFO, {"Desync ({}) at frame {}, fixed tick {}", reason, this->_desyncFrame, this->_desyncTick});
+}
+
+} // namespace dull::replay
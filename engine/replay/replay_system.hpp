@@ -0,0 +1,109 @@
+#pragma once
+
+#include "engine/config.hpp"
+#include "engine/platform/i_clock.hpp"
+#include "engine/platform/input_snapshot.hpp"
+#include "engine/replay/replay_stream.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+// Forward Declaration
+namespace dull::core { struct App; struct WindowContext; }
+
+namespace dull::replay {
+
+enum class ReplayMode : uint8_t {
+    Off,
+    Record, // streams every frame to WindowContext::recordPath
+    Replay, // feeds WindowContext::replayPath back headless, as fast as possible
+};
+
+// ---
+// Records and replays the clock samples, fixed tick counts and input of a session
+// Note: replays are exact as long as the simulation reads frame sampled time, not TimeSystem::GetTime
+// Note: frames are delta encoded against the previous one, an idle frame without state hashes takes under ten bytes
+// ---
+struct ReplaySystem final : public zutil::Logger {
+    friend core::App;
+
+private:
+    static constexpr uint64_t MAGIC   = 0x314C5052'4C4C5544ULL; // "DULLRPL1"
+    static constexpr uint64_t VERSION = 1;
+
+    enum _FrameFlag : uint8_t {
+        KEYS     = 1 << 0,
+        BUTTONS  = 1 << 1,
+        POSITION = 1 << 2,
+        WHEEL    = 1 << 3,
+        HASHES   = 1 << 4,
+    };
+
+    ReplayMode _mode = ReplayMode::Off;
+    const platform::IClock* _liveClockPtr = nullptr;
+    platform::ManualClock _replayClock;
+    std::unique_ptr<ReplayWriter> _writerPtr;
+    std::unique_ptr<ReplayReader> _readerPtr;
+    std::move_only_function<uint64_t()> _stateHasher;
+
+    platform::InputSnapshot _previousInput;
+    uint64_t _previousTimeBits = 0;
+    uint64_t _frameCount       = 0;
+
+    // Replay side of the current frame
+    std::array<uint64_t, config::MAX_FIXED_TICKS_PER_FRAME> _tickHashes {};
+    uint32_t _tickCount  = 0;
+    uint32_t _tickIndex  = 0;
+    bool     _hasHashes  = false;
+
+    bool     _hasDesynced = false;
+    uint64_t _desyncFrame = 0;
+    uint32_t _desyncTick  = 0;
+
+    explicit ReplaySystem();
+    ~ReplaySystem() noexcept = default;
+
+    void _Open(const core::WindowContext& windowContext, const platform::IClock& liveClock);
+
+    // Clock the TimeSystem has to read, the replay clock only moves to recorded samples
+    [[nodiscard]] const platform::IClock& _GetClock() const noexcept;
+
+    // Records a clock sample taken outside of frames, or replaces it with the recorded one
+    void _SyncTime(double& time);
+
+    // Replay: loads the next frame, moves the clock and overrides the polled input, false once the log ends
+    [[nodiscard]] bool _PrepareFrame(platform::InputSnapshot& input);
+
+    void _BeginFrame(double time, uint32_t tickCount, const platform::InputSnapshot& input);
+    void _EndFixedTick();
+    void _EndFrame();
+
+    void _WriteInput(const platform::InputSnapshot& input, uint8_t flags);
+    void _ReadInput(platform::InputSnapshot& input, uint8_t flags) noexcept;
+    void _MarkDesync(const char* reason);
+
+public:
+    ReplaySystem(ReplaySystem&&)                 = delete;
+    ReplaySystem(const ReplaySystem&)            = delete;
+    ReplaySystem& operator=(ReplaySystem&&)      = delete;
+    ReplaySystem& operator=(const ReplaySystem&) = delete;
+
+    [[nodiscard]] ReplayMode GetMode() const noexcept { return this->_mode; }
+
+    // Hashes the simulation after every fixed tick, recorded logs then verify it on replay
+    // Note: set it in IInit, before the first frame
+    void SetStateHasher(std::move_only_function<uint64_t()> stateHasher) { this->_stateHasher = std::move(stateHasher); }
+
+    [[nodiscard]] uint64_t GetFrameCount() const noexcept { return this->_frameCount; }
+
+    // First frame / fixed tick of that frame whose tick count or state hash differed from the log
+    [[nodiscard]] bool     HasDesynced   () const noexcept { return this->_hasDesynced; }
+    [[nodiscard]] uint64_t GetDesyncFrame() const noexcept { return this->_desyncFrame; }
+    [[nodiscard]] uint32_t GetDesyncTick () const noexcept { return this->_desyncTick;  }
+};
+
+} // namespace dull::replay
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace dull::replay {
+
+inline constexpr uint64_t STATE_HASH_SEED = 0xCBF29CE484222325ULL;
+
+// FNV-1a over raw bytes, chain calls through seed to hash several blocks
+[[nodiscard]] constexpr uint64_t HashBytes(std::span<const std::byte> bytes, uint64_t seed = STATE_HASH_SEED) noexcept
+{
+    constexpr uint64_t FNV_PRIME = 0x100000001B3ULL;
+
+    for (const std::byte BYTE : bytes) seed = (seed ^ static_cast<uint64_t>(BYTE)) * FNV_PRIME;
+
+    return seed;
+}
+
+// Note: padding bytes are hashed too, zero initialize states that have any
+template <typename ValueT>
+    requires std::is_trivially_copyable_v<ValueT>
+[[nodiscard]] uint64_t HashValue(const ValueT& value, uint64_t seed = STATE_HASH_SEED) noexcept
+{
+    return HashBytes(std::as_bytes(std::span {&value, 1}), seed);
+}
+
+template <typename ValueT>
+    requires std::is_trivially_copyable_v<ValueT>
+[[nodiscard]] uint64_t HashValues(std::span<const ValueT> values, uint64_t seed = STATE_HASH_SEED) noexcept
+{
+    return HashBytes(std::as_bytes(values), seed);
+}
+
+} // namespace dull::replay
@@ -0,0 +1,90 @@
+#include "engine/serial/binary_stream.hpp"
+
+#include <algorithm>
+
+namespace dull::serial {
+
+void BinaryWriter::WriteVarint(uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        this->_bytes.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+
+    this->_bytes.push_back(static_cast<uint8_t>(value));
+}
+
+void BinaryWriter::WriteRaw64(uint64_t value)
+{
+    for (uint32_t shift = 0; shift < 64; shift += 8) this->_bytes.push_back(static_cast<uint8_t>(value >> shift));
+}
+
+void BinaryWriter::WriteBytes(std::span<const uint8_t> bytes)
+{
+    this->_bytes.insert(this->_bytes.end(), bytes.begin(), bytes.end());
+}
+
+void BinaryWriter::WriteString(std::string_view text)
+{
+    this->WriteVarint(text.size());
+    this->_bytes.insert(this->_bytes.end(), text.begin(), text.end());
+}
+
+[[nodiscard]] uint8_t BinaryReader::ReadByte() noexcept
+{
+    if (this->IsAtEnd()) [[unlikely]]
+    {
+        this->_hasFailed = true;
+        return 0;
+    }
+
+    return static_cast<uint8_t>(this->_bytes[this->_cursor++]);
+}
+
+[[nodiscard]] uint64_t BinaryReader::ReadVarint() noexcept
+{
+    uint64_t value = 0;
+
+    for (uint32_t shift = 0; shift < 64; shift += 7)
+    {
+        const uint8_t BYTE = this->ReadByte();
+        value |= static_cast<uint64_t>(BYTE & 0x7F) << shift;
+
+        if ((BYTE & 0x80) == 0) return value;
+    }
+
+    this->_hasFailed = true;
+    return value;
+}
+
+[[nodiscard]] uint64_t BinaryReader::ReadRaw64() noexcept
+{
+    uint64_t value = 0;
+
+    for (uint32_t shift = 0; shift < 64; shift += 8) value |= static_cast<uint64_t>(this->ReadByte()) << shift;
+
+    return value;
+}
+
+[[nodiscard]] std::string BinaryReader::ReadString()
+{
+    const std::span<const std::byte> BYTES = this->ReadSpan(this->ReadVarint());
+    return {reinterpret_cast<const char*>(BYTES.data()), BYTES.size()};
+}
+
+[[nodiscard]] std::span<const std::byte> BinaryReader::ReadSpan(size_t byteCount) noexcept
+{
+    if (byteCount > this->_bytes.size() - std::min(this->_cursor, this->_bytes.size())) [[unlikely]]
+    {
+        this->_hasFailed = true;
+        this->_cursor    = this->_bytes.size();
+        return {};
+    }
+
+    const std::span<const std::byte> BYTES = this->_bytes.subspan(this->_cursor, byteCount);
+    this->_cursor += byteCount;
+    return BYTES;
+}
+
+} // namespace dull::serial
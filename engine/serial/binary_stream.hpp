@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dull::serial {
+
+// ---
+// Growable in-memory byte sink
+// Note: integers are LEB128 varints unless written raw, raw values are little endian
+// ---
+struct BinaryWriter final {
+private:
+    std::vector<uint8_t> _bytes;
+
+public:
+    void WriteByte  (uint8_t value) { this->_bytes.push_back(value); }
+    void WriteVarint(uint64_t value);
+    void WriteRaw64 (uint64_t value);
+    void WriteBytes (std::span<const uint8_t> bytes);
+    void WriteString(std::string_view text);
+
+    void Clear() noexcept { this->_bytes.clear(); }
+    void Reserve(size_t byteCount) { this->_bytes.reserve(byteCount); }
+
+    [[nodiscard]] std::span<const uint8_t> GetBytes() const noexcept { return this->_bytes; }
+    [[nodiscard]] size_t GetSize() const noexcept { return this->_bytes.size(); }
+};
+
+// ---
+// Cursor over bytes owned elsewhere
+// Note: reading past the end returns zeros and marks the reader failed instead of throwing
+// ---
+struct BinaryReader final {
+private:
+    std::span<const std::byte> _bytes;
+    size_t _cursor    = 0;
+    bool   _hasFailed = false;
+
+public:
+    explicit BinaryReader(std::span<const std::byte> bytes) noexcept : _bytes {bytes} {}
+
+    [[nodiscard]] bool IsAtEnd() const noexcept { return this->_cursor >= this->_bytes.size(); }
+    [[nodiscard]] bool HasFailed() const noexcept { return this->_hasFailed; }
+    [[nodiscard]] size_t GetCursor() const noexcept { return this->_cursor; }
+    [[nodiscard]] size_t GetRemaining() const noexcept { return this->IsAtEnd() ? 0 : this->_bytes.size() - this->_cursor; }
+
+    void Fail() noexcept { this->_hasFailed = true; }
+
+    [[nodiscard]] uint8_t  ReadByte  () noexcept;
+    [[nodiscard]] uint64_t ReadVarint() noexcept;
+    [[nodiscard]] uint64_t ReadRaw64 () noexcept;
+    [[nodiscard]] std::string ReadString();
+
+    // Hands out the next byteCount bytes and moves past them, empty on failure
+    [[nodiscard]] std::span<const std::byte> ReadSpan(size_t byteCount) noexcept;
+};
+
+// Signed values as varints, small magnitudes of either sign stay short
+[[nodiscard]] constexpr uint64_t ZigZagEncode(int64_t value) noexcept
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+[[nodiscard]] constexpr int64_t ZigZagDecode(uint64_t value) noexcept
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+} // namespace dull::serial
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "engine/component/timer.hpp"
+#include "engine/serial/binary_stream.hpp"
+#include "engine/util/color_rgba.hpp"
+#include "engine/util/rect.hpp"
+#include "engine/util/vec2.hpp"
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace dull::serial {
+
+// ---
+// Describes how a type is written to a binary stream
+// Note: either a FIELDS tuple of member pointers walked at compile time, or custom Write / Read functions
+// Note: snapshot components also need a NAME stable across runs, and bump an optional VERSION when their fields change
+// ---
+template <typename ValueT>
+struct SerialTraits;
+
+template <typename ValueT>
+concept FieldListed = requires { SerialTraits<ValueT>::FIELDS; };
+
+template <typename ValueT>
+concept CustomSerialized = requires (BinaryWriter& writer, BinaryReader& reader, const ValueT& value, ValueT& target) {
+    SerialTraits<ValueT>::Write(writer, value);
+    SerialTraits<ValueT>::Read(reader, target);
+};
+
+template <typename ValueT>
+concept Serializable =
+    std::is_arithmetic_v<ValueT> ||
+    std::is_enum_v<ValueT>       ||
+    FieldListed<ValueT>          ||
+    CustomSerialized<ValueT>
+;
+
+template <typename ValueT>
+    requires std::is_floating_point_v<ValueT> && (sizeof(ValueT) == 4 || sizeof(ValueT) == 8)
+using _FloatBits = std::conditional_t<sizeof(ValueT) == 4, uint32_t, uint64_t>;
+
+// ---
+// Writes value relative to reference, fields equal to their reference cost one byte
+// Note: integers store their zigzag difference, floats the xor of their bits
+// Note: custom serialized types ignore the reference
+// ---
+template <Serializable ValueT>
+void WriteDelta(BinaryWriter& writer, const ValueT& value, const ValueT& reference)
+{
+    if constexpr (CustomSerialized<ValueT>)
+    {
+        SerialTraits<ValueT>::Write(writer, value);
+    }
+    else if constexpr (FieldListed<ValueT>)
+    {
+        std::apply([&](auto... fields) { (WriteDelta(writer, value.*fields, reference.*fields), ...); }, SerialTraits<ValueT>::FIELDS);
+    }
+    else if constexpr (std::is_same_v<ValueT, bool>)
+    {
+        writer.WriteByte(value ? 1 : 0);
+    }
+    else if constexpr (std::is_enum_v<ValueT>)
+    {
+        WriteDelta(writer, std::to_underlying(value), std::to_underlying(reference));
+    }
+    else if constexpr (std::is_integral_v<ValueT>)
+    {
+        // Wrapping difference at the value width, so any pair round trips
+        using UnsignedT = std::make_unsigned_t<ValueT>;
+        const UnsignedT DIFFERENCE = static_cast<UnsignedT>(static_cast<UnsignedT>(value) - static_cast<UnsignedT>(reference));
+
+        writer.WriteVarint(ZigZagEncode(static_cast<std::make_signed_t<ValueT>>(DIFFERENCE)));
+    }
+    else
+    {
+        writer.WriteVarint(std::bit_cast<_FloatBits<ValueT>>(value) ^ std::bit_cast<_FloatBits<ValueT>>(reference));
+    }
+}
+
+template <Serializable ValueT>
+void ReadDelta(BinaryReader& reader, ValueT& value, const ValueT& reference)
+{
+    if constexpr (CustomSerialized<ValueT>)
+    {
+        SerialTraits<ValueT>::Read(reader, value);
+    }
+    else if constexpr (FieldListed<ValueT>)
+    {
+        std::apply([&](auto... fields) { (ReadDelta(reader, value.*fields, reference.*fields), ...); }, SerialTraits<ValueT>::FIELDS);
+    }
+    else if constexpr (std::is_same_v<ValueT, bool>)
+    {
+        value = reader.ReadByte() != 0;
+    }
+    else if constexpr (std::is_enum_v<ValueT>)
+    {
+        std::underlying_type_t<ValueT> underlying {};
+        ReadDelta(reader, underlying, std::to_underlying(reference));
+        value = static_cast<ValueT>(underlying);
+    }
+    else if constexpr (std::is_integral_v<ValueT>)
+    {
+        using UnsignedT = std::make_unsigned_t<ValueT>;
+        const UnsignedT DIFFERENCE = static_cast<UnsignedT>(ZigZagDecode(reader.ReadVarint()));
+
+        value = static_cast<ValueT>(static_cast<UnsignedT>(static_cast<UnsignedT>(reference) + DIFFERENCE));
+    }
+    else
+    {
+        value = std::bit_cast<ValueT>(static_cast<_FloatBits<ValueT>>(reader.ReadVarint()) ^ std::bit_cast<_FloatBits<ValueT>>(reference));
+    }
+}
+
+// Standalone values are written relative to their default
+template <Serializable ValueT>
+void Write(BinaryWriter& writer, const ValueT& value)
+{
+    if constexpr (CustomSerialized<ValueT>) SerialTraits<ValueT>::Write(writer, value);
+    else WriteDelta(writer, value, ValueT {});
+}
+
+template <Serializable ValueT>
+void Read(BinaryReader& reader, ValueT& value)
+{
+    if constexpr (CustomSerialized<ValueT>) SerialTraits<ValueT>::Read(reader, value);
+    else ReadDelta(reader, value, ValueT {});
+}
+
+// --- Built-in types ---
+
+template <typename ValueT>
+struct SerialTraits<util::Vec2<ValueT>> {
+    static constexpr auto FIELDS = std::tuple {&util::Vec2<ValueT>::x, &util::Vec2<ValueT>::y};
+};
+
+template <>
+struct SerialTraits<util::Rect> {
+    static constexpr auto FIELDS = std::tuple {&util::Rect::x, &util::Rect::y, &util::Rect::w, &util::Rect::h};
+};
+
+template <>
+struct SerialTraits<util::Color> {
+    static constexpr auto FIELDS = std::tuple {&util::Color::r, &util::Color::g, &util::Color::b, &util::Color::a};
+};
+
+// Note: reads and writes the App TimerSystem, a running timer resumes with its saved elapsed time
+template <>
+struct SerialTraits<component::Timer> {
+    static void Write(BinaryWriter& writer, const component::Timer& timer)
+    {
+        const bool IS_ACTIVE = timer.IsActive();
+
+        writer.WriteRaw64(std::bit_cast<uint64_t>(timer.GetMeasureTime()));
+        writer.WriteByte(static_cast<uint8_t>((timer.IsLooping() ? 1 : 0) | (IS_ACTIVE ? 2 : 0)));
+
+        if (IS_ACTIVE) writer.WriteRaw64(std::bit_cast<uint64_t>(timer.GetElapsed()));
+    }
+
+    static void Read(BinaryReader& reader, component::Timer& timer)
+    {
+        const double  MEASURE_TIME = std::bit_cast<double>(reader.ReadRaw64());
+        const uint8_t FLAGS        = reader.ReadByte();
+
+        timer.SetMeasureTime(MEASURE_TIME);
+        timer.SetLooping((FLAGS & 1) != 0);
+
+        if ((FLAGS & 2) != 0) timer.Start(std::bit_cast<double>(reader.ReadRaw64()));
+    }
+};
+
+} // namespace dull::serial
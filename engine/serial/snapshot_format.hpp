@@ -0,0 +1,25 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace dull::serial {
+
+// ---
+// Layout of a snapshot file, shared by SnapshotWriter and SnapshotReader
+// Note: magic | version | kind | sequence | base sequence | section count | sections, integers are varints
+// Note: section = component name | component version | payload size | payload, readers skip names they don't know
+// Note: full payload = count, then per entry index delta | generation | fields relative to the previous entry
+// Note: incremental payload = removed (count, index deltas), changed (count, index delta | fields relative to the base value),
+//       added (count, then like a full payload), all sorted by entity index
+// ---
+
+inline constexpr std::array<uint8_t, 8> SNAPSHOT_MAGIC   = {'D', 'U', 'L', 'L', 'S', 'N', 'P', '1'};
+inline constexpr uint64_t               SNAPSHOT_VERSION = 1;
+
+enum class SnapshotKind : uint8_t {
+    Full        = 0,
+    Incremental = 1, // only what changed since the previous save, applies on top of it
+};
+
+} // namespace dull::serial
@@ -0,0 +1,286 @@
+#include "engine/serial/snapshot_reader.hpp"
+#include "engine/platform/mapped_file.hpp"
+#include "engine/profile/profiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace dull::serial {
+
+SnapshotReader::SnapshotReader(const SnapshotSchema& schema)
+    : _schema {schema}
+{
+    const std::vector<_ComponentCodec>& codecs = this->_schema.GetCodecs();
+    size_t maxValueSize = 0;
+
+    for (const _ComponentCodec& codec : codecs) maxValueSize = std::max(maxValueSize, codec.size);
+
+    this->_columns.resize(codecs.size());
+    this->_pendingColumns.resize(codecs.size());
+    this->_isPending.resize(codecs.size());
+    this->_zeroValue.assign(maxValueSize, std::byte {0});
+}
+
+[[nodiscard]] bool SnapshotReader::Load(const std::string& path)
+{
+    platform::MappedFile file;
+    return file.Open(path) && this->Load(file.GetBytes());
+}
+
+[[nodiscard]] bool SnapshotReader::Load(std::span<const std::byte> bytes)
+{
+    DULL_PROFILE_FUNCTION();
+
+    BinaryReader reader {bytes};
+    const std::span<const std::byte> MAGIC = reader.ReadSpan(SNAPSHOT_MAGIC.size());
+
+    if (MAGIC.size() != SNAPSHOT_MAGIC.size() || std::memcmp(MAGIC.data(), SNAPSHOT_MAGIC.data(), MAGIC.size()) != 0) return false;
+    if (reader.ReadVarint() != SNAPSHOT_VERSION) return false;
+
+    const auto     KIND          = static_cast<SnapshotKind>(reader.ReadByte());
+    const uint64_t SEQUENCE      = reader.ReadVarint();
+    const uint64_t BASE_SEQUENCE = reader.ReadVarint();
+    const uint64_t SECTION_COUNT = reader.ReadVarint();
+
+    if (KIND != SnapshotKind::Full && KIND != SnapshotKind::Incremental) return false;
+    if (KIND == SnapshotKind::Incremental && (!this->_hasState || BASE_SEQUENCE != this->_sequence)) return false;
+
+    const std::vector<_ComponentCodec>& codecs = this->_schema.GetCodecs();
+    this->_isPending.assign(codecs.size(), false);
+
+    for (uint64_t section = 0; section < SECTION_COUNT && !reader.HasFailed(); section++)
+    {
+        const std::string NAME    = reader.ReadString();
+        const uint64_t    VERSION = reader.ReadVarint();
+        BinaryReader payload {reader.ReadSpan(reader.ReadVarint())};
+
+        const auto FOUND = std::ranges::find(codecs, NAME, &_ComponentCodec::name);
+
+        // Components this schema doesn't know about are skipped
+        if (FOUND == codecs.end()) continue;
+
+        const size_t CODEC_INDEX = static_cast<size_t>(FOUND - codecs.begin());
+
+        if (FOUND->version != VERSION || this->_isPending[CODEC_INDEX]) return false;
+
+        _ComponentColumn& column = this->_pendingColumns[CODEC_INDEX];
+        column.Clear();
+
+        const bool IS_READ = KIND == SnapshotKind::Full
+            ? this->_ReadEntries(payload, *FOUND, column)
+            : this->_ReadIncremental(payload, *FOUND, this->_columns[CODEC_INDEX], column);
+
+        if (!IS_READ || payload.HasFailed() || !payload.IsAtEnd()) return false;
+
+        this->_isPending[CODEC_INDEX] = true;
+    }
+
+    if (reader.HasFailed()) return false;
+
+    for (size_t codecIndex = 0; codecIndex < codecs.size(); codecIndex++)
+    {
+        // Full snapshots replace everything, incremental ones only the components they carry
+        if (this->_isPending[codecIndex]) std::swap(this->_columns[codecIndex], this->_pendingColumns[codecIndex]);
+        else if (KIND == SnapshotKind::Full) this->_columns[codecIndex].Clear();
+    }
+
+    this->_sequence = SEQUENCE;
+    this->_hasState = true;
+    return true;
+}
+
+[[nodiscard]] bool SnapshotReader::_ReadEntries(BinaryReader& reader, const _ComponentCodec& codec, _ComponentColumn& column)
+{
+    const uint64_t COUNT = reader.ReadVarint();
+
+    // Every entry takes at least two bytes, a larger count is corrupt and must not drive the allocation
+    if (COUNT > reader.GetRemaining() / 2) return false;
+
+    column.entities.resize(COUNT);
+    column.values.resize(COUNT * codec.size);
+
+    const std::byte* referencePtr = this->_zeroValue.data();
+    uint64_t index = 0;
+
+    for (size_t entry = 0; entry < COUNT; entry++)
+    {
+        const uint64_t DELTA = reader.ReadVarint();
+
+        // Indices strictly increase, only the first entry may sit at zero
+        if (entry != 0 && DELTA == 0) return false;
+
+        index += DELTA;
+
+        if (index >= std::numeric_limits<uint32_t>::max()) return false;
+
+        std::byte* valuePtr = column.values.data() + entry * codec.size;
+
+        column.entities[entry] = {static_cast<uint32_t>(index), static_cast<uint32_t>(reader.ReadVarint())};
+        codec.decode(reader, valuePtr, referencePtr);
+
+        referencePtr = valuePtr;
+    }
+
+    return true;
+}
+
+[[nodiscard]] bool SnapshotReader::_ReadIncremental(
+    BinaryReader& reader, const _ComponentCodec& codec, const _ComponentColumn& base, _ComponentColumn& column
+)
+{
+    const uint64_t REMOVED_COUNT = reader.ReadVarint();
+
+    if (REMOVED_COUNT > base.entities.size()) return false;
+
+    this->_removedIndices.resize(REMOVED_COUNT);
+    uint64_t index = 0;
+
+    for (uint32_t& removedIndex : this->_removedIndices)
+    {
+        index += reader.ReadVarint();
+        removedIndex = static_cast<uint32_t>(std::min<uint64_t>(index, std::numeric_limits<uint32_t>::max()));
+    }
+
+    _ComponentColumn& kept = this->_keptColumn;
+    kept.Clear();
+    kept.entities.reserve(base.entities.size());
+    kept.values.reserve(base.values.size());
+
+    const size_t BASE_COUNT = base.entities.size();
+    size_t baseRow    = 0;
+    size_t removedPos = 0;
+
+    // Base entries below endIndex that weren't removed carry over unchanged
+    const auto KEEP_UNTIL = [&](uint64_t endIndex)
+    {
+        for (; baseRow < BASE_COUNT && base.entities[baseRow].index < endIndex; baseRow++)
+        {
+            const uint32_t BASE_INDEX = base.entities[baseRow].index;
+
+            while (removedPos < this->_removedIndices.size() && this->_removedIndices[removedPos] < BASE_INDEX) removedPos++;
+
+            if (removedPos < this->_removedIndices.size() && this->_removedIndices[removedPos] == BASE_INDEX) continue;
+
+            const std::byte* BASE_VALUE_PTR = base.values.data() + baseRow * codec.size;
+
+            kept.entities.push_back(base.entities[baseRow]);
+            kept.values.insert(kept.values.end(), BASE_VALUE_PTR, BASE_VALUE_PTR + codec.size);
+        }
+    };
+
+    const uint64_t CHANGED_COUNT = reader.ReadVarint();
+    index = 0;
+
+    for (uint64_t changed = 0; changed < CHANGED_COUNT && !reader.HasFailed(); changed++)
+    {
+        index += reader.ReadVarint();
+        KEEP_UNTIL(index);
+
+        if (baseRow == BASE_COUNT || base.entities[baseRow].index != index) return false;
+
+        const std::byte* BASE_VALUE_PTR = base.values.data() + baseRow * codec.size;
+
+        kept.entities.push_back(base.entities[baseRow]);
+        kept.values.resize(kept.values.size() + codec.size);
+        codec.decode(reader, kept.values.data() + kept.values.size() - codec.size, BASE_VALUE_PTR);
+
+        baseRow++;
+    }
+
+    KEEP_UNTIL(std::numeric_limits<uint64_t>::max());
+
+    _ComponentColumn& added = this->_addedColumn;
+
+    if (!this->_ReadEntries(reader, codec, added)) return false;
+
+    // Both runs are sorted by index, merge them into the new column
+    column.entities.resize(kept.entities.size() + added.entities.size());
+    column.values.resize(kept.values.size() + added.values.size());
+
+    size_t keptRow  = 0;
+    size_t addedRow = 0;
+
+    for (size_t row = 0; row < column.entities.size(); row++)
+    {
+        const bool IS_KEPT = addedRow == added.entities.size()
+            || (keptRow < kept.entities.size() && kept.entities[keptRow].index < added.entities[addedRow].index);
+
+        if (!IS_KEPT && keptRow < kept.entities.size() && kept.entities[keptRow].index == added.entities[addedRow].index) return false;
+
+        const _ComponentColumn& source = IS_KEPT ? kept : added;
+        size_t& sourceRow = IS_KEPT ? keptRow : addedRow;
+
+        column.entities[row] = source.entities[sourceRow];
+        std::memcpy(column.values.data() + row * codec.size, source.values.data() + sourceRow * codec.size, codec.size);
+        sourceRow++;
+    }
+
+    return true;
+}
+
+void SnapshotReader::Restore(ecs::Registry& registry) const
+{
+    DULL_PROFILE_FUNCTION();
+
+    const std::vector<_ComponentCodec>& codecs = this->_schema.GetCodecs();
+    uint32_t maxIndex = 0;
+    bool     isEmpty  = true;
+
+    for (const _ComponentColumn& column : this->_columns)
+    {
+        if (column.entities.empty()) continue;
+
+        maxIndex = std::max(maxIndex, column.entities.back().index);
+        isEmpty  = false;
+    }
+
+    if (isEmpty) return;
+
+    std::vector<ecs::ComponentMask> masks(static_cast<size_t>(maxIndex) + 1, 0);
+
+    for (size_t codecIndex = 0; codecIndex < codecs.size(); codecIndex++)
+    {
+        const ecs::ComponentMask BIT = ecs::ComponentMask {1} << codecs[codecIndex].componentId;
+
+        for (const ecs::Entity& entity : this->_columns[codecIndex].entities) masks[entity.index] |= BIT;
+    }
+
+    // Each entity is created in its final archetype, no component is added one by one
+    std::vector<ecs::Entity> created(masks.size());
+
+    for (size_t index = 0; index < masks.size(); index++)
+        if (masks[index] != 0) created[index] = registry._Create(masks[index]);
+
+    for (size_t codecIndex = 0; codecIndex < codecs.size(); codecIndex++)
+    {
+        const _ComponentCodec& codec   = codecs[codecIndex];
+        const _ComponentColumn& column = this->_columns[codecIndex];
+
+        for (size_t row = 0; row < column.entities.size(); row++)
+        {
+            void* componentPtr = registry._Get(created[column.entities[row].index], codec.componentId);
+            std::memcpy(componentPtr, column.values.data() + row * codec.size, codec.size);
+        }
+    }
+}
+
+void SnapshotReader::Clear() noexcept
+{
+    for (_ComponentColumn& column : this->_columns) column.Clear();
+
+    this->_sequence = 0;
+    this->_hasState = false;
+}
+
+[[nodiscard]] size_t SnapshotReader::GetComponentCount() const noexcept
+{
+    size_t componentCount = 0;
+
+    for (const _ComponentColumn& column : this->_columns) componentCount += column.entities.size();
+
+    return componentCount;
+}
+
+} // namespace dull::serial
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "engine/ecs/registry.hpp"
+#include "engine/serial/binary_stream.hpp"
+#include "engine/serial/snapshot_format.hpp"
+#include "engine/serial/snapshot_schema.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace dull::serial {
+
+// ---
+// Rebuilds the state saved by a SnapshotWriter
+// Note: load a full snapshot, then the incremental ones that followed it in order, and restore into a registry
+// Note: a file that fails to load leaves the state as it was
+// ---
+struct SnapshotReader final {
+private:
+    SnapshotSchema _schema;
+    std::vector<_ComponentColumn> _columns;
+    std::vector<_ComponentColumn> _pendingColumns;
+    std::vector<bool>     _isPending;
+    _ComponentColumn      _keptColumn;
+    _ComponentColumn      _addedColumn;
+    std::vector<uint32_t> _removedIndices;
+    std::vector<std::byte> _zeroValue;
+    uint64_t _sequence = 0;
+    bool     _hasState = false;
+
+    [[nodiscard]] bool _ReadEntries(BinaryReader& reader, const _ComponentCodec& codec, _ComponentColumn& column);
+    [[nodiscard]] bool _ReadIncremental(BinaryReader& reader, const _ComponentCodec& codec, const _ComponentColumn& base, _ComponentColumn& column);
+
+public:
+    SnapshotReader(SnapshotReader&&)                 = delete;
+    SnapshotReader(const SnapshotReader&)            = delete;
+    SnapshotReader& operator=(SnapshotReader&&)      = delete;
+    SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+    explicit SnapshotReader(const SnapshotSchema& schema);
+
+    // False when the file is unreadable, of another format version, or an incremental one not following the loaded sequence
+    [[nodiscard]] bool Load(const std::string& path);
+    [[nodiscard]] bool Load(std::span<const std::byte> bytes);
+
+    // Creates one entity per saved entity, owning its saved components
+    // Note: entities get new handles, components holding handles have to be remapped by the caller
+    void Restore(ecs::Registry& registry) const;
+
+    void Clear() noexcept;
+
+    [[nodiscard]] bool HasState() const noexcept { return this->_hasState; }
+    [[nodiscard]] uint64_t GetSequence() const noexcept { return this->_sequence; }
+    [[nodiscard]] size_t GetComponentCount() const noexcept;
+};
+
+} // namespace dull::serial
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "engine/ecs/component.hpp"
+#include "engine/ecs/registry.hpp"
+#include "engine/serial/binary_stream.hpp"
+#include "engine/serial/serial_traits.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dull::serial {
+
+// ---
+// Component type a snapshot can hold
+// Note: incremental saves compare components byte for byte, padding included, so an unchanged value whose padding differs
+//       from the base is written again, it is never missed, keep snapshot components free of padding to avoid the waste
+// ---
+template <typename ComponentT>
+concept SnapshotComponent = ecs::Component<ComponentT> && Serializable<ComponentT> && requires {
+    { SerialTraits<ComponentT>::NAME } -> std::convertible_to<std::string_view>;
+};
+
+// Components of one type, entities[i] owns the value at values[i * size]
+struct _ComponentColumn {
+    std::vector<ecs::Entity> entities;
+    std::vector<std::byte>   values;
+
+    void Clear() noexcept
+    {
+        this->entities.clear();
+        this->values.clear();
+    }
+};
+
+// Type erased access to one snapshot component
+struct _ComponentCodec {
+    std::string      name;
+    uint64_t         version     = 0;
+    ecs::ComponentId componentId = 0;
+    size_t           size        = 0;
+
+    void (*capture)(ecs::Registry& registry, _ComponentColumn& column);
+    void (*encode)(BinaryWriter& writer, const std::byte* value, const std::byte* reference);
+    void (*decode)(BinaryReader& reader, std::byte* value, const std::byte* reference);
+};
+
+// ---
+// Component types a snapshot holds
+// Note: writer and reader must register the same names, the order doesn't matter
+// ---
+struct SnapshotSchema final {
+private:
+    std::vector<_ComponentCodec> _codecs;
+
+    template <SnapshotComponent ComponentT>
+    static void _Capture(ecs::Registry& registry, _ComponentColumn& column)
+    {
+        registry.ForEachChunk<ComponentT>([&column](uint32_t count, const ecs::Entity* entities, const ComponentT* components) {
+            const auto* VALUES = reinterpret_cast<const std::byte*>(components);
+
+            column.entities.insert(column.entities.end(), entities, entities + count);
+            column.values.insert(column.values.end(), VALUES, VALUES + count * sizeof(ComponentT));
+        });
+    }
+
+    // Values are copied out since column bytes carry no alignment
+    template <SnapshotComponent ComponentT>
+    static void _Encode(BinaryWriter& writer, const std::byte* value, const std::byte* reference)
+    {
+        ComponentT valueCopy;
+        ComponentT referenceCopy;
+
+        std::memcpy(&valueCopy, value, sizeof(ComponentT));
+        std::memcpy(&referenceCopy, reference, sizeof(ComponentT));
+
+        WriteDelta(writer, valueCopy, referenceCopy);
+    }
+
+    template <SnapshotComponent ComponentT>
+    static void _Decode(BinaryReader& reader, std::byte* value, const std::byte* reference)
+    {
+        ComponentT valueCopy;
+        ComponentT referenceCopy;
+
+        std::memcpy(&referenceCopy, reference, sizeof(ComponentT));
+        std::memcpy(&valueCopy, reference, sizeof(ComponentT));
+
+        ReadDelta(reader, valueCopy, referenceCopy);
+        std::memcpy(value, &valueCopy, sizeof(ComponentT));
+    }
+
+    template <typename ComponentT>
+    [[nodiscard]] static constexpr uint64_t _GetVersion() noexcept
+    {
+        if constexpr (requires { SerialTraits<ComponentT>::VERSION; }) return SerialTraits<ComponentT>::VERSION;
+        else return 0;
+    }
+
+public:
+    template <SnapshotComponent ComponentT>
+    void Register()
+    {
+        const std::string_view NAME = SerialTraits<ComponentT>::NAME;
+
+        zutil::Assert(
+            std::ranges::none_of(this->_codecs, [NAME](const _ComponentCodec& codec) { return codec.name == NAME; }),
+            "Snapshot component registered twice"
+        );
+
+        this->_codecs.push_back({
+            std::string {NAME},
+            _GetVersion<ComponentT>(),
+            ecs::GetComponentId<ComponentT>(),
+            sizeof(ComponentT),
+            &SnapshotSchema::_Capture<ComponentT>,
+            &SnapshotSchema::_Encode<ComponentT>,
+            &SnapshotSchema::_Decode<ComponentT>
+        });
+    }
+
+    [[nodiscard]] const std::vector<_ComponentCodec>& GetCodecs() const noexcept { return this->_codecs; }
+};
+
+} // namespace dull::serial
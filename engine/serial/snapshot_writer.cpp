@@ -0,0 +1,327 @@
+#include "engine/serial/snapshot_writer.hpp"
+#include "engine/profile/profiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <system_error>
+#include <utility>
+
+namespace dull::serial {
+
+static constexpr uint32_t NIL_ROW = std::numeric_limits<uint32_t>::max();
+
+SnapshotWriter::SnapshotWriter(const SnapshotSchema& schema)
+    : _schema {schema}
+{
+    const std::vector<_ComponentCodec>& codecs = this->_schema.GetCodecs();
+    size_t maxValueSize = 0;
+
+    for (const _ComponentCodec& codec : codecs) maxValueSize = std::max(maxValueSize, codec.size);
+
+    this->_captures.resize(codecs.size());
+    this->_bases.resize(codecs.size());
+    this->_zeroValue.assign(maxValueSize, std::byte {0});
+
+    this->_worker = std::thread {&SnapshotWriter::_WorkerLoop, this};
+}
+
+SnapshotWriter::~SnapshotWriter() noexcept
+{
+    {
+        std::lock_guard lock {this->_mutex};
+        this->_isStopping = true;
+    }
+
+    this->_jobCondition.notify_all();
+    this->_worker.join();
+}
+
+[[nodiscard]] bool SnapshotWriter::Save(ecs::Registry& registry, const std::string& path, SnapshotKind kind)
+{
+    DULL_PROFILE_FUNCTION();
+
+    {
+        std::lock_guard lock {this->_mutex};
+        if (this->_isSaving) return false;
+    }
+
+    // The worker is idle, the captures are ours until the job is handed over
+    const double START = this->_clock.INow();
+    const std::vector<_ComponentCodec>& codecs = this->_schema.GetCodecs();
+
+    for (size_t codecIndex = 0; codecIndex < codecs.size(); codecIndex++)
+    {
+        this->_captures[codecIndex].Clear();
+        codecs[codecIndex].capture(registry, this->_captures[codecIndex]);
+    }
+
+    const double CAPTURE_MS = (this->_clock.INow() - START) * 1000.0;
+
+    {
+        std::lock_guard lock {this->_mutex};
+        this->_job      = _Job {path, kind, CAPTURE_MS};
+        this->_isSaving = true;
+    }
+
+    this->_jobCondition.notify_one();
+    return true;
+}
+
+void SnapshotWriter::Wait()
+{
+    std::unique_lock lock {this->_mutex};
+    this->_idleCondition.wait(lock, [this] { return !this->_isSaving; });
+}
+
+[[nodiscard]] bool SnapshotWriter::IsSaving()
+{
+    std::lock_guard lock {this->_mutex};
+    return this->_isSaving;
+}
+
+[[nodiscard]] SnapshotStats SnapshotWriter::GetStats()
+{
+    std::lock_guard lock {this->_mutex};
+    return this->_stats;
+}
+
+void SnapshotWriter::_WorkerLoop()
+{
+    while (true)
+    {
+        _Job job;
+
+        {
+            std::unique_lock lock {this->_mutex};
+            this->_jobCondition.wait(lock, [this] { return this->_isStopping || this->_job.has_value(); });
+
+            // A save requested before shutdown still finishes
+            if (!this->_job.has_value()) return;
+
+            job = std::move(*this->_job);
+            this->_job.reset();
+        }
+
+        DULL_PROFILE_ZONE("SnapshotWriter::Save");
+
+        const double START = this->_clock.INow();
+        const std::vector<_ComponentCodec>& codecs = this->_schema.GetCodecs();
+        const SnapshotKind KIND = this->_hasBase ? job.kind : SnapshotKind::Full;
+
+        SnapshotStats stats;
+        stats.sequence  = this->_sequence + 1;
+        stats.kind      = KIND;
+        stats.captureMs = job.captureMs;
+
+        this->_output.Clear();
+        this->_output.WriteBytes(SNAPSHOT_MAGIC);
+        this->_output.WriteVarint(SNAPSHOT_VERSION);
+        this->_output.WriteByte(static_cast<uint8_t>(KIND));
+        this->_output.WriteVarint(stats.sequence);
+        this->_output.WriteVarint(KIND == SnapshotKind::Full ? 0 : this->_sequence);
+        this->_output.WriteVarint(codecs.size());
+
+        for (size_t codecIndex = 0; codecIndex < codecs.size(); codecIndex++)
+        {
+            const _ComponentCodec& codec = codecs[codecIndex];
+            _ComponentColumn& column     = this->_captures[codecIndex];
+
+            this->_SortByIndex(column, codec.size);
+            stats.capturedCount += column.entities.size();
+
+            this->_section.Clear();
+
+            if (KIND == SnapshotKind::Full) this->_WriteFull(codec, column, stats);
+            else this->_WriteIncremental(codec, column, this->_bases[codecIndex], stats);
+
+            this->_output.WriteString(codec.name);
+            this->_output.WriteVarint(codec.version);
+            this->_output.WriteVarint(this->_section.GetSize());
+            this->_output.WriteBytes(this->_section.GetBytes());
+        }
+
+        stats.byteSize  = this->_output.GetSize();
+        stats.hasFailed = !this->_WriteFile(job.path);
+
+        // A lost file breaks the chain, the next save starts a new one
+        if (stats.hasFailed)
+        {
+            this->_hasBase = false;
+        }
+        else
+        {
+            this->_captures.swap(this->_bases);
+            this->_sequence = stats.sequence;
+            this->_hasBase  = true;
+        }
+
+        stats.encodeMs = (this->_clock.INow() - START) * 1000.0;
+
+        {
+            std::lock_guard lock {this->_mutex};
+            this->_stats    = stats;
+            this->_isSaving = false;
+        }
+
+        this->_idleCondition.notify_all();
+    }
+}
+
+void SnapshotWriter::_SortByIndex(_ComponentColumn& column, size_t valueSize)
+{
+    // Captures come in archetype order, which usually is index order already
+    if (std::ranges::is_sorted(column.entities, {}, &ecs::Entity::index)) return;
+
+    uint32_t maxIndex = 0;
+
+    for (const ecs::Entity& entity : column.entities) maxIndex = std::max(maxIndex, entity.index);
+
+    // Entity indices are dense, so a scatter through an index table beats a comparison sort
+    this->_rowOfIndex.assign(static_cast<size_t>(maxIndex) + 1, NIL_ROW);
+
+    for (uint32_t row = 0; row < column.entities.size(); row++) this->_rowOfIndex[column.entities[row].index] = row;
+
+    _ComponentColumn& sorted = this->_sortScratch;
+    sorted.entities.resize(column.entities.size());
+    sorted.values.resize(column.values.size());
+
+    size_t target = 0;
+
+    for (const uint32_t ROW : this->_rowOfIndex)
+    {
+        if (ROW == NIL_ROW) continue;
+
+        sorted.entities[target] = column.entities[ROW];
+        std::memcpy(sorted.values.data() + target * valueSize, column.values.data() + ROW * valueSize, valueSize);
+        target++;
+    }
+
+    column.entities.swap(sorted.entities);
+    column.values.swap(sorted.values);
+}
+
+void SnapshotWriter::_WriteEntries(const _ComponentCodec& codec, const _ComponentColumn& column, std::span<const uint32_t> rows)
+{
+    const std::byte* referencePtr = this->_zeroValue.data();
+    uint32_t previousIndex = 0;
+
+    this->_section.WriteVarint(rows.size());
+
+    for (const uint32_t ROW : rows)
+    {
+        const ecs::Entity ENTITY = column.entities[ROW];
+        const std::byte* valuePtr = column.values.data() + static_cast<size_t>(ROW) * codec.size;
+
+        this->_section.WriteVarint(ENTITY.index - previousIndex);
+        this->_section.WriteVarint(ENTITY.generation);
+        codec.encode(this->_section, valuePtr, referencePtr);
+
+        previousIndex = ENTITY.index;
+        referencePtr  = valuePtr;
+    }
+}
+
+void SnapshotWriter::_WriteFull(const _ComponentCodec& codec, const _ComponentColumn& column, SnapshotStats& stats)
+{
+    this->_addedRows.resize(column.entities.size());
+    std::iota(this->_addedRows.begin(), this->_addedRows.end(), 0U);
+
+    this->_WriteEntries(codec, column, this->_addedRows);
+    stats.writtenCount += column.entities.size();
+}
+
+void SnapshotWriter::_WriteIncremental(
+    const _ComponentCodec& codec, const _ComponentColumn& column, const _ComponentColumn& base, SnapshotStats& stats
+)
+{
+    this->_removedRows.clear();
+    this->_addedRows.clear();
+    this->_changes.Clear();
+
+    size_t   changedCount  = 0;
+    uint32_t previousIndex = 0;
+    uint32_t baseRow       = 0;
+    const uint32_t BASE_COUNT = static_cast<uint32_t>(base.entities.size());
+
+    // Both columns are sorted by index, one merge pass classifies every entry
+    for (uint32_t row = 0; row < column.entities.size(); row++)
+    {
+        const ecs::Entity ENTITY = column.entities[row];
+
+        while (baseRow < BASE_COUNT && base.entities[baseRow].index < ENTITY.index) this->_removedRows.push_back(baseRow++);
+
+        if (baseRow == BASE_COUNT || base.entities[baseRow].index != ENTITY.index)
+        {
+            this->_addedRows.push_back(row);
+            continue;
+        }
+
+        // Compared as bytes, padding included, see SnapshotComponent
+        const std::byte* valuePtr     = column.values.data() + static_cast<size_t>(row) * codec.size;
+        const std::byte* baseValuePtr = base.values.data() + static_cast<size_t>(baseRow) * codec.size;
+
+        if (base.entities[baseRow].generation != ENTITY.generation)
+        {
+            // Slot reused by a new entity since the base
+            this->_removedRows.push_back(baseRow);
+            this->_addedRows.push_back(row);
+        }
+        else if (std::memcmp(valuePtr, baseValuePtr, codec.size) != 0)
+        {
+            this->_changes.WriteVarint(ENTITY.index - previousIndex);
+            codec.encode(this->_changes, valuePtr, baseValuePtr);
+
+            previousIndex = ENTITY.index;
+            changedCount++;
+        }
+
+        baseRow++;
+    }
+
+    while (baseRow < BASE_COUNT) this->_removedRows.push_back(baseRow++);
+
+    this->_section.WriteVarint(this->_removedRows.size());
+    previousIndex = 0;
+
+    for (const uint32_t BASE_ROW : this->_removedRows)
+    {
+        this->_section.WriteVarint(base.entities[BASE_ROW].index - previousIndex);
+        previousIndex = base.entities[BASE_ROW].index;
+    }
+
+    this->_section.WriteVarint(changedCount);
+    this->_section.WriteBytes(this->_changes.GetBytes());
+
+    this->_WriteEntries(codec, column, this->_addedRows);
+
+    stats.writtenCount += changedCount + this->_addedRows.size();
+    stats.removedCount += this->_removedRows.size();
+}
+
+[[nodiscard]] bool SnapshotWriter::_WriteFile(const std::string& path) const
+{
+    const std::string TEMPORARY_PATH = path + ".tmp";
+
+    {
+        std::ofstream file {TEMPORARY_PATH, std::ios::binary | std::ios::trunc};
+
+        if (!file.is_open()) return false;
+
+        const std::span<const uint8_t> BYTES = this->_output.GetBytes();
+        file.write(reinterpret_cast<const char*>(BYTES.data()), static_cast<std::streamsize>(BYTES.size()));
+        file.close();
+
+        if (file.fail()) return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(TEMPORARY_PATH, path, error);
+
+    return !error;
+}
+
+} // namespace dull::serial
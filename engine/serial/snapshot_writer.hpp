@@ -0,0 +1,105 @@
+#pragma once
+
+#include "engine/ecs/registry.hpp"
+#include "engine/platform/i_clock.hpp"
+#include "engine/serial/binary_stream.hpp"
+#include "engine/serial/snapshot_format.hpp"
+#include "engine/serial/snapshot_schema.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dull::serial {
+
+// ---
+// Outcome of the last finished save
+// ---
+struct SnapshotStats final {
+    uint64_t     sequence      = 0;
+    SnapshotKind kind          = SnapshotKind::Full;
+    size_t       capturedCount = 0; // components copied out of the registry
+    size_t       writtenCount  = 0; // components in the file, only changed and added ones for incremental saves
+    size_t       removedCount  = 0;
+    size_t       byteSize      = 0;
+    double       captureMs     = 0.0; // main thread
+    double       encodeMs      = 0.0; // background thread, file write included
+    bool         hasFailed     = false;
+};
+
+// ---
+// Saves registry snapshots on a background thread
+// Note: Save copies the schema columns chunk by chunk on the calling thread, sorting, diffing, encoding and the file write happen on the worker
+// Note: the worker keeps the last saved copy as the base incremental saves diff against, a changed component is one whose bytes differ
+// Note: files are written next to the target and renamed over it once complete
+// Note: main thread API
+// ---
+struct SnapshotWriter final {
+private:
+    struct _Job {
+        std::string  path;
+        SnapshotKind kind;
+        double       captureMs;
+    };
+
+    SnapshotSchema _schema;
+    platform::SteadyClock _clock;
+
+    // Filled by Save while the worker is idle, swapped with the base once written
+    std::vector<_ComponentColumn> _captures;
+
+    // Worker side
+    std::vector<_ComponentColumn> _bases;
+    _ComponentColumn _sortScratch;
+    std::vector<uint32_t> _rowOfIndex;
+    std::vector<uint32_t> _removedRows;
+    std::vector<uint32_t> _addedRows;
+    std::vector<std::byte> _zeroValue; // reference of the first entry in a run
+    BinaryWriter _output;
+    BinaryWriter _section;
+    BinaryWriter _changes;
+    uint64_t _sequence = 0;
+    bool     _hasBase  = false;
+
+    std::thread _worker;
+    std::mutex _mutex;
+    std::condition_variable _jobCondition;
+    std::condition_variable _idleCondition;
+    std::optional<_Job> _job;
+    SnapshotStats _stats;
+    bool _isSaving   = false;
+    bool _isStopping = false;
+
+    void _WorkerLoop();
+    void _SortByIndex(_ComponentColumn& column, size_t valueSize);
+    void _WriteEntries(const _ComponentCodec& codec, const _ComponentColumn& column, std::span<const uint32_t> rows);
+    void _WriteFull(const _ComponentCodec& codec, const _ComponentColumn& column, SnapshotStats& stats);
+    void _WriteIncremental(const _ComponentCodec& codec, const _ComponentColumn& column, const _ComponentColumn& base, SnapshotStats& stats);
+    [[nodiscard]] bool _WriteFile(const std::string& path) const;
+
+public:
+    SnapshotWriter(SnapshotWriter&&)                 = delete;
+    SnapshotWriter(const SnapshotWriter&)            = delete;
+    SnapshotWriter& operator=(SnapshotWriter&&)      = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+    explicit SnapshotWriter(const SnapshotSchema& schema);
+    ~SnapshotWriter() noexcept;
+
+    // Captures registry and saves it to path in the background, false while the previous save is still running
+    // Note: an incremental save without a successful save before it is written as a full one
+    [[nodiscard]] bool Save(ecs::Registry& registry, const std::string& path, SnapshotKind kind = SnapshotKind::Incremental);
+
+    // Blocks until the running save is done
+    void Wait();
+
+    [[nodiscard]] bool IsSaving();
+    [[nodiscard]] SnapshotStats GetStats();
+};
+
+} // namespace dull::serial
@@ -0,0 +1,116 @@
+#include "engine/system/input_system.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+namespace dull::system {
+
+void InputSystem::_BeginFrame(const platform::InputSnapshot& snapshot) noexcept
+{
+    _InputBits down;
+    down.keyWords     = snapshot.keyWords;
+    down.mouseButtons = snapshot.mouseButtons;
+
+    for (uint32_t action = 0; action < this->_bindings.size(); action++)
+    {
+        const _Binding& binding = this->_bindings[action];
+        uint64_t matches = binding.mouseButtons & snapshot.mouseButtons;
+
+        for (uint32_t word = 0; word < KEY_WORDS; word++) matches |= binding.keyWords[word] & snapshot.keyWords[word];
+
+        if (matches != 0) down.actionWords[action / 64] |= uint64_t {1} << (action % 64);
+    }
+
+    const _InputBits& previous = this->_down;
+    _Edges& edges   = this->_frameEdges;
+    _Edges& pending = this->_pendingEdges;
+
+    for (uint32_t word = 0; word < KEY_WORDS; word++)
+    {
+        edges.pressed.keyWords[word]  = down.keyWords[word] & ~previous.keyWords[word];
+        edges.released.keyWords[word] = previous.keyWords[word] & ~down.keyWords[word];
+
+        pending.pressed.keyWords[word]  |= edges.pressed.keyWords[word];
+        pending.released.keyWords[word] |= edges.released.keyWords[word];
+    }
+
+    for (uint32_t word = 0; word < ACTION_WORDS; word++)
+    {
+        edges.pressed.actionWords[word]  = down.actionWords[word] & ~previous.actionWords[word];
+        edges.released.actionWords[word] = previous.actionWords[word] & ~down.actionWords[word];
+
+        pending.pressed.actionWords[word]  |= edges.pressed.actionWords[word];
+        pending.released.actionWords[word] |= edges.released.actionWords[word];
+    }
+
+    edges.pressed.mouseButtons  = static_cast<uint8_t>(down.mouseButtons & ~previous.mouseButtons);
+    edges.released.mouseButtons = static_cast<uint8_t>(previous.mouseButtons & ~down.mouseButtons);
+    edges.mouseWheel            = snapshot.mouseWheel;
+
+    pending.pressed.mouseButtons  |= edges.pressed.mouseButtons;
+    pending.released.mouseButtons |= edges.released.mouseButtons;
+    pending.mouseWheel            += snapshot.mouseWheel;
+
+    this->_snapshot = snapshot;
+    this->_down     = down;
+}
+
+void InputSystem::_BeginFixedTick() noexcept
+{
+    this->_tickEdges     = this->_pendingEdges;
+    this->_pendingEdges  = {};
+    this->_isInFixedTick = true;
+}
+
+ActionId InputSystem::AddAction(std::string_view name)
+{
+    const ActionId FOUND = this->FindAction(name);
+
+    if (!FOUND.IsNull()) return FOUND;
+
+    zutil::Assert(this->_bindings.size() < config::MAX_INPUT_ACTIONS, "Too many input actions, raise config::MAX_INPUT_ACTIONS");
+
+    const auto INDEX = static_cast<uint16_t>(this->_bindings.size());
+
+    this->_bindings.emplace_back();
+    this->_actionNames.emplace_back(name);
+    this->_actionIndices.emplace(std::string {name}, INDEX);
+
+    return {INDEX};
+}
+
+[[nodiscard]] ActionId InputSystem::FindAction(std::string_view name) const
+{
+    const auto FOUND = this->_actionIndices.find(std::string {name});
+    return FOUND == this->_actionIndices.end() ? ActionId {} : ActionId {FOUND->second};
+}
+
+[[nodiscard]] const std::string& InputSystem::GetActionName(ActionId actionId) const noexcept
+{
+    static const std::string EMPTY_NAME;
+    return actionId.index < this->_actionNames.size() ? this->_actionNames[actionId.index] : EMPTY_NAME;
+}
+
+void InputSystem::BindKey(ActionId actionId, uint32_t key) noexcept
+{
+    zutil::Assert(actionId.index < this->_bindings.size(), "Binding an unknown input action");
+
+    if (actionId.index >= this->_bindings.size() || key >= platform::InputSnapshot::KEY_COUNT) return;
+
+    this->_bindings[actionId.index].keyWords[key / 64] |= uint64_t {1} << (key % 64);
+}
+
+void InputSystem::BindMouseButton(ActionId actionId, uint32_t button) noexcept
+{
+    zutil::Assert(actionId.index < this->_bindings.size(), "Binding an unknown input action");
+
+    if (actionId.index >= this->_bindings.size() || button >= platform::InputSnapshot::BUTTON_COUNT) return;
+
+    this->_bindings[actionId.index].mouseButtons |= static_cast<uint8_t>(1U << button);
+}
+
+void InputSystem::ClearBindings(ActionId actionId) noexcept
+{
+    if (actionId.index < this->_bindings.size()) this->_bindings[actionId.index] = {};
+}
+
+} // namespace dull::system
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "engine/config.hpp"
+#include "engine/platform/input_snapshot.hpp"
+#include "engine/util/vec2.hpp"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Forward Declaration
+namespace dull::core { struct App; }
+
+namespace dull::system {
+
+// ---
+// Handle to a named input action, resolve it once and keep it
+// ---
+struct ActionId final {
+    uint16_t index = std::numeric_limits<uint16_t>::max();
+
+    [[nodiscard]] constexpr bool IsNull() const noexcept { return this->index == std::numeric_limits<uint16_t>::max(); }
+
+    constexpr bool operator == (const ActionId& other) const noexcept = default;
+    constexpr bool operator != (const ActionId& other) const noexcept = default;
+};
+
+// Fills the snapshot of the frame instead of the backend
+using InputSource = std::move_only_function<void(platform::InputSnapshot& input)>;
+
+// ---
+// Device state, press and release edges and named actions
+// Note: devices are polled once per frame, queries only test bits of that snapshot and never reach the platform
+// Note: inside IFixedUpdate edges belong to the fixed tick, every edge since the previous tick goes to exactly one tick
+//       (the first of the next frame that runs any), everywhere else they are per frame
+// Note: action bindings are folded into bitmasks, all actions are evaluated once per frame into an action bitset
+// ---
+struct InputSystem final {
+    friend dull::core::App;
+
+private:
+    static constexpr uint32_t KEY_WORDS    = platform::InputSnapshot::KEY_WORDS;
+    static constexpr uint32_t ACTION_WORDS = config::MAX_INPUT_ACTIONS / 64 + (config::MAX_INPUT_ACTIONS % 64 != 0);
+
+    // One bit per key, mouse button and action
+    struct _InputBits {
+        std::array<uint64_t, KEY_WORDS>    keyWords {};
+        std::array<uint64_t, ACTION_WORDS> actionWords {};
+        uint8_t mouseButtons = 0;
+    };
+
+    struct _Edges {
+        _InputBits pressed;
+        _InputBits released;
+        float      mouseWheel = 0.0F;
+    };
+
+    // Keys and buttons bound to an action
+    struct _Binding {
+        std::array<uint64_t, KEY_WORDS> keyWords {};
+        uint8_t mouseButtons = 0;
+    };
+
+    platform::InputSnapshot _snapshot;
+    _InputBits _down;
+    _Edges _frameEdges;
+    _Edges _tickEdges;
+    _Edges _pendingEdges; // since the last fixed tick
+    bool   _isInFixedTick = false;
+
+    std::vector<_Binding> _bindings;
+    std::vector<std::string> _actionNames;
+    std::unordered_map<std::string, uint16_t> _actionIndices; // resolve time only
+
+    InputSource _source;
+
+    explicit InputSystem() = default;
+    ~InputSystem() = default;
+
+    [[nodiscard]] bool _HasSource() const noexcept { return static_cast<bool>(this->_source); }
+    void _PollSource(platform::InputSnapshot& input) { this->_source(input); }
+
+    // Takes the frame snapshot, derives the frame edges and adds them to the pending ones
+    void _BeginFrame(const platform::InputSnapshot& snapshot) noexcept;
+
+    // Hands the pending edges to the tick and points queries at them until _EndFixedUpdate
+    void _BeginFixedTick() noexcept;
+    void _EndFixedUpdate() noexcept { this->_isInFixedTick = false; }
+
+    [[nodiscard]] const _Edges& _GetEdges() const noexcept { return this->_isInFixedTick ? this->_tickEdges : this->_frameEdges; }
+
+    [[nodiscard]] static constexpr bool _TestBit(const uint64_t* words, uint32_t bit) noexcept
+    {
+        return ((words[bit / 64] >> (bit % 64)) & 1) != 0;
+    }
+
+public:
+    constexpr InputSystem(InputSystem&&)                 noexcept = delete;
+    constexpr InputSystem(const InputSystem&)            noexcept = delete;
+    constexpr InputSystem& operator=(InputSystem&&)      noexcept = delete;
+    constexpr InputSystem& operator=(const InputSystem&) noexcept = delete;
+
+    // Replaces device polling, for bots, tests and scripted headless runs, an empty source polls the backend again
+    // Note: replays still override it, recordings store what it produced
+    void SetSource(InputSource source) noexcept { this->_source = std::move(source); }
+
+// --- Actions ---
+
+    // Returns the existing action when the name is taken
+    ActionId AddAction(std::string_view name);
+
+    // Null when no action has that name
+    [[nodiscard]] ActionId FindAction(std::string_view name) const;
+
+    [[nodiscard]] const std::string& GetActionName(ActionId actionId) const noexcept;
+
+    // Note: bindings are OR-ed, changes show from the next frame on
+    void BindKey(ActionId actionId, uint32_t key) noexcept;
+    void BindMouseButton(ActionId actionId, uint32_t button) noexcept;
+    void ClearBindings(ActionId actionId) noexcept;
+
+    [[nodiscard]] bool IsActionDown(ActionId actionId) const noexcept
+    {
+        return actionId.index < this->_bindings.size() && _TestBit(this->_down.actionWords.data(), actionId.index);
+    }
+
+    [[nodiscard]] bool IsActionPressed(ActionId actionId) const noexcept
+    {
+        return actionId.index < this->_bindings.size() && _TestBit(this->_GetEdges().pressed.actionWords.data(), actionId.index);
+    }
+
+    [[nodiscard]] bool IsActionReleased(ActionId actionId) const noexcept
+    {
+        return actionId.index < this->_bindings.size() && _TestBit(this->_GetEdges().released.actionWords.data(), actionId.index);
+    }
+
+// --- Devices ---
+
+    [[nodiscard]] bool IsKeyDown(uint32_t key) const noexcept { return this->_snapshot.IsKeyDown(key); }
+
+    [[nodiscard]] bool IsKeyPressed(uint32_t key) const noexcept
+    {
+        return key < platform::InputSnapshot::KEY_COUNT && _TestBit(this->_GetEdges().pressed.keyWords.data(), key);
+    }
+
+    [[nodiscard]] bool IsKeyReleased(uint32_t key) const noexcept
+    {
+        return key < platform::InputSnapshot::KEY_COUNT && _TestBit(this->_GetEdges().released.keyWords.data(), key);
+    }
+
+    [[nodiscard]] bool IsMouseButtonDown(uint32_t button) const noexcept { return this->_snapshot.IsMouseButtonDown(button); }
+
+    [[nodiscard]] bool IsMouseButtonPressed(uint32_t button) const noexcept
+    {
+        return button < platform::InputSnapshot::BUTTON_COUNT && ((this->_GetEdges().pressed.mouseButtons >> button) & 1) != 0;
+    }
+
+    [[nodiscard]] bool IsMouseButtonReleased(uint32_t button) const noexcept
+    {
+        return button < platform::InputSnapshot::BUTTON_COUNT && ((this->_GetEdges().released.mouseButtons >> button) & 1) != 0;
+    }
+
+    [[nodiscard]] util::Vec2f GetMousePosition() const noexcept { return this->_snapshot.mousePosition; }
+
+    // Wheel movement of the frame, or of the fixed tick inside IFixedUpdate
+    [[nodiscard]] float GetMouseWheel() const noexcept { return this->_GetEdges().mouseWheel; }
+
+    [[nodiscard]] const platform::InputSnapshot& GetSnapshot() const noexcept { return this->_snapshot; }
+};
+
+} // namespace dull::system
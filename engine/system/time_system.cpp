@@ -1,25 +1,17 @@
 #include "engine/system/time_system.hpp"
 
-#include <vendor/raylib.h>
-
 namespace dull::system {
 
-double TimeSystem::_sDeltaTime = 0.0;
-
-bool TimeSystem::_IsFixedProcess() noexcept
+void TimeSystem::_SetClock(const platform::IClock& clock) noexcept
 {
-    static double sAccumulatedTime = 0;
-
-    TimeSystem::_sDeltaTime = rl::GetFrameTime();
-    sAccumulatedTime += TimeSystem::_sDeltaTime;
-
-    if (sAccumulatedTime > TimeSystem::FIXED_TICK_INTERVAL) [[unlikely]]
-    {
-        sAccumulatedTime -= TimeSystem::FIXED_TICK_INTERVAL;
-        return true;
-    }
+    this->_clock = &clock;
+    this->_ResetFrameTime();
+}
 
-    return false;
+void TimeSystem::_SetTickRate(uint32_t ticksPerSecond) noexcept
+{
+    zutil::Assert(ticksPerSecond > 0, "Tick rate must be positive");
+    this->_fixedTickInterval = 1.0 / ticksPerSecond;
 }
 
 } // namespace dull::system
@@ -1,6 +1,11 @@
 #pragma once
 
 #include "engine/config.hpp"
+#include "engine/platform/i_clock.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 
 // Forward Declaration
 namespace dull::core { struct App; }
@@ -9,27 +14,121 @@ namespace dull::system {
 
 // ---
 // Provides time related data
+// Note: fixed ticks are scheduled with an accumulator, a frame may run zero or several ticks
 // ---
 struct TimeSystem final {
     friend dull::core::App;
 
+public:
+    // Tick rate template argument scheduling with the rate set at runtime
+    static constexpr uint32_t RUNTIME_TICK_RATE = 0;
+
 private:
-    static double _sDeltaTime;
+    const platform::IClock* _clock = nullptr;
+
+    double   _lastTime          = 0.0;
+    double   _deltaTime         = 0.0;
+    double   _accumulatedTime   = 0.0;
+    double   _droppedTime       = 0.0;
+    uint64_t _frameCount        = 0;
+    uint64_t _fixedTickCount    = 0;
+    double   _fixedTickInterval = 1.0 / config::TICKS_PER_SECOND;
 
     explicit TimeSystem() = default;
     ~TimeSystem() = default;
 
-    [[nodiscard]] bool _IsFixedProcess() noexcept;
+    void _SetClock(const platform::IClock& clock) noexcept;
+    void _SetTickRate(uint32_t ticksPerSecond) noexcept;
 
-public:
-    static constexpr double FIXED_TICK_INTERVAL = 1.0 / config::TICKS_PER_SECOND;
+    // Restarts frame time measurement from the current clock time
+    void _ResetFrameTime() noexcept { this->_lastTime = this->GetTime(); }
+
+    // Seconds between two fixed ticks, a constant when the rate is known at compile time
+    template <uint32_t TICKS_PER_SECOND>
+    [[nodiscard]] double _GetFixedTickInterval() const noexcept
+    {
+        if constexpr (TICKS_PER_SECOND == RUNTIME_TICK_RATE) return this->_fixedTickInterval;
+        else                                                 return 1.0 / TICKS_PER_SECOND;
+    }
 
+    // Measures the frame time from the clock and advances the scheduler with it
+    template <uint32_t TICKS_PER_SECOND = RUNTIME_TICK_RATE>
+    [[nodiscard]] uint32_t _BeginFrame() noexcept;
+
+    // Feeds a frame time into the scheduler and returns the number of fixed ticks to process
+    // Note: TICKS_PER_SECOND must match the rate given to _SetTickRate, StaticApp sets both from its config
+    template <uint32_t TICKS_PER_SECOND = RUNTIME_TICK_RATE>
+    [[nodiscard]] uint32_t _AdvanceFrame(double frameTime) noexcept;
+
+public:
     constexpr TimeSystem(TimeSystem&&)                 noexcept = delete;
     constexpr TimeSystem(const TimeSystem&)            noexcept = delete;
     constexpr TimeSystem& operator=(TimeSystem&&)      noexcept = delete;
     constexpr TimeSystem& operator=(const TimeSystem&) noexcept = delete;
 
-    [[nodiscard]] double GetDeltaTime() const noexcept { return _sDeltaTime; }
+    // Current time (in seconds) of the application clock
+    [[nodiscard]] double GetTime() const noexcept { return this->_clock->INow(); }
+
+    [[nodiscard]] double GetDeltaTime() const noexcept { return this->_deltaTime; }
+
+    // Seconds between two fixed ticks, WindowContext::ticksPerSecond sets the rate
+    [[nodiscard]] double GetFixedTickInterval() const noexcept { return this->_fixedTickInterval; }
+
+    // Fraction of a fixed tick left in the accumulator, used to blend between fixed states
+    [[nodiscard]] double GetAlpha() const noexcept { return this->_accumulatedTime / this->_fixedTickInterval; }
+
+    // Simulation time (in seconds) discarded by the frame time and tick clamps
+    [[nodiscard]] double GetDroppedTime() const noexcept { return this->_droppedTime; }
+
+    [[nodiscard]] uint64_t GetFrameCount    () const noexcept { return this->_frameCount;     }
+    [[nodiscard]] uint64_t GetFixedTickCount() const noexcept { return this->_fixedTickCount; }
 };
 
+template <uint32_t TICKS_PER_SECOND>
+uint32_t TimeSystem::_BeginFrame() noexcept
+{
+    const double CURRENT_TIME = this->GetTime();
+    const double FRAME_TIME   = CURRENT_TIME - this->_lastTime;
+
+    this->_lastTime = CURRENT_TIME;
+    return this->_AdvanceFrame<TICKS_PER_SECOND>(FRAME_TIME);
+}
+
+template <uint32_t TICKS_PER_SECOND>
+uint32_t TimeSystem::_AdvanceFrame(double frameTime) noexcept
+{
+    const double FIXED_TICK_INTERVAL = this->_GetFixedTickInterval<TICKS_PER_SECOND>();
+
+    frameTime = std::max(frameTime, 0.0);
+
+    if (frameTime > config::MAX_FRAME_TIME) [[unlikely]]
+    {
+        this->_droppedTime += frameTime - config::MAX_FRAME_TIME;
+        frameTime = config::MAX_FRAME_TIME;
+    }
+
+    this->_deltaTime = frameTime;
+    this->_accumulatedTime += frameTime;
+    this->_frameCount++;
+
+    uint32_t tickCount = 0;
+
+    while (this->_accumulatedTime >= FIXED_TICK_INTERVAL && tickCount < config::MAX_FIXED_TICKS_PER_FRAME)
+    {
+        this->_accumulatedTime -= FIXED_TICK_INTERVAL;
+        tickCount++;
+    }
+
+    // Spiral of death: keep only the partial tick once the per frame budget is spent
+    if (this->_accumulatedTime >= FIXED_TICK_INTERVAL) [[unlikely]]
+    {
+        const double LEFTOVER_TIME = std::fmod(this->_accumulatedTime, FIXED_TICK_INTERVAL);
+        this->_droppedTime += this->_accumulatedTime - LEFTOVER_TIME;
+        this->_accumulatedTime = LEFTOVER_TIME;
+    }
+
+    this->_fixedTickCount += tickCount;
+    return tickCount;
+}
+
 } // namespace dull::system
@@ -0,0 +1,284 @@
+#include "engine/system/timer_system.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace dull::system {
+
+[[nodiscard]] static uint64_t sToTick(double time) noexcept
+{
+    return time <= 0.0 ? 0 : static_cast<uint64_t>(std::ceil(time / TimerSystem::RESOLUTION));
+}
+
+[[nodiscard]] TimerSystem::_Node* TimerSystem::_GetNode(TimerId timerId) noexcept
+{
+    if (timerId.index >= this->_nodes.size()) return nullptr;
+
+    _Node& node = this->_nodes[timerId.index];
+    return (node.isAllocated && node.generation == timerId.generation) ? &node : nullptr;
+}
+
+[[nodiscard]] const TimerSystem::_Node* TimerSystem::_GetNode(TimerId timerId) const noexcept
+{
+    return const_cast<TimerSystem*>(this)->_GetNode(timerId);
+}
+
+[[nodiscard]] TimerId TimerSystem::_Allocate(bool isPersistent)
+{
+    uint32_t nodeIndex = 0;
+
+    if (this->_freeNodes.empty())
+    {
+        nodeIndex = static_cast<uint32_t>(this->_nodes.size());
+        this->_nodes.emplace_back();
+    }
+    else
+    {
+        nodeIndex = this->_freeNodes.back();
+        this->_freeNodes.pop_back();
+    }
+
+    _Node& node = this->_nodes[nodeIndex];
+    node.isAllocated  = true;
+    node.isPersistent = isPersistent;
+    node.fireCount    = 0;
+
+    return {nodeIndex, node.generation};
+}
+
+void TimerSystem::_Free(uint32_t nodeIndex) noexcept
+{
+    _Node& node = this->_nodes[nodeIndex];
+
+    node.callback    = nullptr;
+    node.isAllocated = false;
+    node.generation++;
+
+    this->_freeNodes.push_back(nodeIndex);
+}
+
+void TimerSystem::_Link(uint32_t nodeIndex, uint64_t minTick) noexcept
+{
+    _Node& node = this->_nodes[nodeIndex];
+
+    uint64_t tick = std::max(sToTick(node.deadline), minTick);
+
+    // Far deadlines park in the top level and get relinked when they come due
+    tick = std::min(tick, this->_currentTick + MAX_TICK_SPAN);
+
+    const uint64_t TICK_DELTA = tick - this->_currentTick;
+    uint32_t slot = static_cast<uint32_t>(tick & (ROOT_SLOTS - 1));
+
+    for (uint32_t level = 1; level < LEVEL_COUNT && TICK_DELTA >= (uint64_t {1} << (ROOT_SLOT_BITS + (level - 1) * LEVEL_SLOT_BITS)); level++)
+    {
+        const uint32_t SHIFT = ROOT_SLOT_BITS + (level - 1) * LEVEL_SLOT_BITS;
+        slot = ROOT_SLOTS + (level - 1) * LEVEL_SLOTS + static_cast<uint32_t>((tick >> SHIFT) & (LEVEL_SLOTS - 1));
+    }
+
+    node.slot     = slot;
+    node.previous = NIL_NODE;
+    node.next     = this->_slotHeads[slot];
+
+    if (node.next != NIL_NODE) this->_nodes[node.next].previous = nodeIndex;
+
+    this->_slotHeads[slot] = nodeIndex;
+    this->_scheduledCount++;
+}
+
+void TimerSystem::_Unlink(uint32_t nodeIndex) noexcept
+{
+    _Node& node = this->_nodes[nodeIndex];
+    if (node.slot == NIL_NODE) return;
+
+    // Already off the wheel and counted out, only the firing is called off
+    if (node.slot == DUE_SLOT)
+    {
+        node.slot = NIL_NODE;
+        return;
+    }
+
+    if (node.previous != NIL_NODE) this->_nodes[node.previous].next = node.next;
+    else                           this->_slotHeads[node.slot]     = node.next;
+
+    if (node.next != NIL_NODE) this->_nodes[node.next].previous = node.previous;
+
+    node.slot     = NIL_NODE;
+    node.previous = NIL_NODE;
+    node.next     = NIL_NODE;
+
+    this->_scheduledCount--;
+}
+
+void TimerSystem::_Cascade(uint32_t level) noexcept
+{
+    const uint32_t SHIFT = ROOT_SLOT_BITS + (level - 1) * LEVEL_SLOT_BITS;
+    const uint32_t SLOT  = ROOT_SLOTS + (level - 1) * LEVEL_SLOTS + static_cast<uint32_t>((this->_currentTick >> SHIFT) & (LEVEL_SLOTS - 1));
+
+    uint32_t nodeIndex = this->_slotHeads[SLOT];
+
+    while (nodeIndex != NIL_NODE)
+    {
+        const uint32_t NEXT_INDEX = this->_nodes[nodeIndex].next;
+
+        this->_Unlink(nodeIndex);
+        this->_Link(nodeIndex, this->_currentTick);
+
+        nodeIndex = NEXT_INDEX;
+    }
+}
+
+void TimerSystem::_Fire(uint32_t nodeIndex)
+{
+    _Node& node = this->_nodes[nodeIndex];
+    const TimerId TIMER_ID = {nodeIndex, node.generation};
+
+    node.slot = NIL_NODE;
+    node.fireCount++;
+    this->_expired.push_back(TIMER_ID);
+
+    if (node.isLooping)
+    {
+        node.deadline += node.period;
+        this->_Link(nodeIndex, this->_currentTick + 1);
+    }
+
+    // The callback may cancel or schedule timers, so it runs detached from the node
+    TimerCallback callback = std::move(node.callback);
+    if (callback) callback(TIMER_ID);
+
+    _Node* firedNode = this->_GetNode(TIMER_ID);
+    if (firedNode == nullptr) return;
+
+    firedNode->callback = std::move(callback);
+
+    if (!firedNode->isLooping && !firedNode->isPersistent) this->_Free(nodeIndex);
+}
+
+void TimerSystem::_Reset(double time) noexcept
+{
+    this->_currentTime = time;
+    this->_currentTick = time <= 0.0 ? 0 : static_cast<uint64_t>(time / RESOLUTION);
+}
+
+void TimerSystem::_Advance(double time)
+{
+    this->_expired.clear();
+    this->_currentTime = std::max(this->_currentTime, time);
+
+    const uint64_t TARGET_TICK = static_cast<uint64_t>(this->_currentTime / RESOLUTION);
+
+    while (this->_currentTick < TARGET_TICK)
+    {
+        // Nothing to fire, skip the empty stretch of wheel
+        if (this->_scheduledCount == 0)
+        {
+            this->_currentTick = TARGET_TICK;
+            break;
+        }
+
+        this->_currentTick++;
+
+        for (uint32_t level = 1; level < LEVEL_COUNT; level++)
+        {
+            const uint32_t SHIFT = ROOT_SLOT_BITS + (level - 1) * LEVEL_SLOT_BITS;
+            if ((this->_currentTick & ((uint64_t {1} << SHIFT) - 1)) != 0) break;
+
+            this->_Cascade(level);
+        }
+
+        const uint32_t ROOT_SLOT = static_cast<uint32_t>(this->_currentTick & (ROOT_SLOTS - 1));
+
+        this->_dueNodes.clear();
+
+        for (uint32_t nodeIndex = this->_slotHeads[ROOT_SLOT]; nodeIndex != NIL_NODE; nodeIndex = this->_nodes[nodeIndex].next)
+            this->_dueNodes.push_back({nodeIndex, this->_nodes[nodeIndex].generation});
+
+        for (const TimerId TIMER_ID : this->_dueNodes)
+        {
+            this->_Unlink(TIMER_ID.index);
+            this->_nodes[TIMER_ID.index].slot = DUE_SLOT;
+        }
+
+        for (const TimerId TIMER_ID : this->_dueNodes)
+        {
+            // Cancelled, released or restarted by a callback fired earlier this tick
+            const _Node* node = this->_GetNode(TIMER_ID);
+            if (node == nullptr || node->slot != DUE_SLOT) continue;
+
+            // Parked far deadline, not due yet
+            if (sToTick(node->deadline) > this->_currentTick)
+            {
+                this->_Link(TIMER_ID.index, this->_currentTick + 1);
+                continue;
+            }
+
+            this->_Fire(TIMER_ID.index);
+        }
+    }
+}
+
+void TimerSystem::_Release(TimerId timerId) noexcept
+{
+    if (this->_GetNode(timerId) == nullptr) return;
+
+    this->_Unlink(timerId.index);
+    this->_Free(timerId.index);
+}
+
+void TimerSystem::_Start(TimerId timerId, double delay, bool isLooping, double elapsed) noexcept
+{
+    _Node* node = this->_GetNode(timerId);
+    if (node == nullptr) return;
+
+    this->_Unlink(timerId.index);
+
+    node->deadline  = this->_currentTime + std::max(delay - elapsed, 0.0);
+    node->period    = std::max(delay, RESOLUTION);
+    node->isLooping = isLooping;
+    node->fireCount = 0;
+
+    this->_Link(timerId.index, this->_currentTick + 1);
+}
+
+[[nodiscard]] bool TimerSystem::_ConsumeFire(TimerId timerId) noexcept
+{
+    _Node* node = this->_GetNode(timerId);
+    if (node == nullptr || node->fireCount == 0) return false;
+
+    node->fireCount = 0;
+    return true;
+}
+
+TimerId TimerSystem::Schedule(double delay, TimerCallback callback, bool isLooping)
+{
+    const TimerId TIMER_ID = this->_Allocate(false);
+
+    this->_nodes[TIMER_ID.index].callback = std::move(callback);
+    this->_Start(TIMER_ID, delay, isLooping);
+
+    return TIMER_ID;
+}
+
+void TimerSystem::Cancel(TimerId timerId) noexcept
+{
+    _Node* node = this->_GetNode(timerId);
+    if (node == nullptr) return;
+
+    this->_Unlink(timerId.index);
+    if (!node->isPersistent) this->_Free(timerId.index);
+}
+
+[[nodiscard]] bool TimerSystem::IsScheduled(TimerId timerId) const noexcept
+{
+    const _Node* node = this->_GetNode(timerId);
+    return node != nullptr && node->slot != NIL_NODE;
+}
+
+[[nodiscard]] double TimerSystem::GetRemaining(TimerId timerId) const noexcept
+{
+    if (!this->IsScheduled(timerId)) return 0.0;
+    return std::max(this->_GetNode(timerId)->deadline - this->_currentTime, 0.0);
+}
+
+} // namespace dull::system
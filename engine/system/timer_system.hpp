@@ -0,0 +1,132 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <vector>
+
+// Forward Declaration
+namespace dull::core { struct App; }
+namespace dull::component { struct Timer; }
+
+namespace dull::system {
+
+// ---
+// Handle to a timer scheduled in the TimerSystem
+// ---
+struct TimerId final {
+    uint32_t index      = std::numeric_limits<uint32_t>::max();
+    uint32_t generation = 0;
+
+    [[nodiscard]] constexpr bool IsNull() const noexcept { return this->index == std::numeric_limits<uint32_t>::max(); }
+
+    constexpr bool operator == (const TimerId& other) const noexcept = default;
+    constexpr bool operator != (const TimerId& other) const noexcept = default;
+};
+
+using TimerCallback = std::move_only_function<void(TimerId)>;
+
+// ---
+// Hierarchical timing wheel driving every timer of the application
+// Note: time is sampled once per frame by App, insert and cancel are O(1)
+// Note: looping timers advance their deadline by whole periods so they never drift
+// ---
+struct TimerSystem final {
+    friend dull::core::App;
+    friend dull::component::Timer;
+
+private:
+    static constexpr uint32_t NIL_NODE = std::numeric_limits<uint32_t>::max();
+
+    // Slot of nodes taken off the wheel to fire this tick, unlinking one drops it from the firing
+    static constexpr uint32_t DUE_SLOT = NIL_NODE - 1;
+
+    static constexpr uint32_t LEVEL_COUNT     = 4;
+    static constexpr uint32_t ROOT_SLOT_BITS  = 8;
+    static constexpr uint32_t LEVEL_SLOT_BITS = 6;
+    static constexpr uint32_t ROOT_SLOTS      = 1U << ROOT_SLOT_BITS;
+    static constexpr uint32_t LEVEL_SLOTS     = 1U << LEVEL_SLOT_BITS;
+    static constexpr uint32_t SLOT_COUNT      = ROOT_SLOTS + (LEVEL_COUNT - 1) * LEVEL_SLOTS;
+    static constexpr uint64_t MAX_TICK_SPAN   = (uint64_t {1} << (ROOT_SLOT_BITS + (LEVEL_COUNT - 1) * LEVEL_SLOT_BITS)) - 1;
+
+    struct _Node {
+        TimerCallback callback;
+        double   deadline     = 0.0;
+        double   period       = 0.0;
+        uint32_t previous     = NIL_NODE;
+        uint32_t next         = NIL_NODE;
+        uint32_t slot         = NIL_NODE;
+        uint32_t generation   = 0;
+        uint32_t fireCount    = 0;
+        bool     isLooping    = false;
+        bool     isPersistent = false; // owned by a handle, survives firing and cancelling
+        bool     isAllocated  = false;
+    };
+
+    std::vector<_Node> _nodes;
+    std::vector<uint32_t> _freeNodes;
+    std::array<uint32_t, SLOT_COUNT> _slotHeads;
+    std::vector<TimerId> _dueNodes;
+    std::vector<TimerId> _expired;
+
+    double   _currentTime    = 0.0;
+    uint64_t _currentTick    = 0;
+    size_t   _scheduledCount = 0;
+
+    explicit TimerSystem() noexcept { this->_slotHeads.fill(NIL_NODE); }
+    ~TimerSystem() = default;
+
+    [[nodiscard]] _Node* _GetNode(TimerId timerId) noexcept;
+    [[nodiscard]] const _Node* _GetNode(TimerId timerId) const noexcept;
+
+    [[nodiscard]] TimerId _Allocate(bool isPersistent);
+    void _Free(uint32_t nodeIndex) noexcept;
+
+    // Note: minTick is the earliest tick the node may land on
+    void _Link(uint32_t nodeIndex, uint64_t minTick) noexcept;
+    void _Unlink(uint32_t nodeIndex) noexcept;
+    void _Cascade(uint32_t level) noexcept;
+    void _Fire(uint32_t nodeIndex);
+
+    // Restarts the wheel at the given time, drops nothing
+    void _Reset(double time) noexcept;
+
+    // Moves the wheel up to the given time, firing every timer due
+    void _Advance(double time);
+
+    // Handle support for component::Timer
+    [[nodiscard]] TimerId _Acquire() { return this->_Allocate(true); }
+    void _Release(TimerId timerId) noexcept;
+    // Note: elapsed moves the first deadline closer, the period stays delay
+    void _Start(TimerId timerId, double delay, bool isLooping, double elapsed = 0.0) noexcept;
+    [[nodiscard]] bool _ConsumeFire(TimerId timerId) noexcept;
+
+public:
+    static constexpr double RESOLUTION = 0.001;
+
+    constexpr TimerSystem(TimerSystem&&)                 noexcept = delete;
+    constexpr TimerSystem(const TimerSystem&)            noexcept = delete;
+    constexpr TimerSystem& operator=(TimerSystem&&)      noexcept = delete;
+    constexpr TimerSystem& operator=(const TimerSystem&) noexcept = delete;
+
+    // Note: one shot timers release themselves after firing or cancelling
+    TimerId Schedule(double delay, TimerCallback callback, bool isLooping = false);
+    void Cancel(TimerId timerId) noexcept;
+
+    [[nodiscard]] bool IsScheduled(TimerId timerId) const noexcept;
+
+    // Time left until the next expiry, 0 when not scheduled
+    [[nodiscard]] double GetRemaining(TimerId timerId) const noexcept;
+
+    // Time of the last wheel advance, every deadline is relative to it
+    [[nodiscard]] double GetCurrentTime() const noexcept { return this->_currentTime; }
+
+    // Timers fired during the last frame, in firing order
+    [[nodiscard]] std::span<const TimerId> GetExpired() const noexcept { return this->_expired; }
+
+    [[nodiscard]] size_t GetScheduledCount() const noexcept { return this->_scheduledCount; }
+};
+
+} // namespace dull::system
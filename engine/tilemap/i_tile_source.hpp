@@ -0,0 +1,24 @@
+#pragma once
+
+#include "engine/tilemap/tile.hpp"
+
+#include <span>
+
+namespace dull::tilemap {
+
+// ---
+// Interface for whatever backs the tiles of a TileMap (map files, generators, save games)
+// Note: called on the thread streaming the map, tiles are row major with CHUNK_SIZE tiles per row
+// Note: tiles of a chunk hanging past the map edge are ignored
+// ---
+struct ITileSource {
+    virtual ~ITileSource() = default;
+
+    // Fills a chunk about to become resident
+    virtual void ILoadChunk(ChunkCoord coord, std::span<TileId> tiles) = 0;
+
+    // Receives a chunk edited since it was loaded, right before it's unloaded
+    virtual void ISaveChunk(ChunkCoord, std::span<const TileId>) {}
+};
+
+} // namespace dull::tilemap
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "engine/render/render_batch.hpp"
+#include "engine/util/rect.hpp"
+#include "engine/util/vec2.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace dull::tilemap {
+
+// Index into the tileset, 0 is empty and never drawn
+using TileId = uint16_t;
+
+inline constexpr TileId EMPTY_TILE   = 0;
+inline constexpr TileId INVALID_TILE = std::numeric_limits<TileId>::max(); // outside the map or not resident
+
+// Tiles per chunk side, a chunk of ids is 2 KiB
+inline constexpr int32_t CHUNK_SIZE       = 32;
+inline constexpr size_t  CHUNK_TILE_COUNT = CHUNK_SIZE * CHUNK_SIZE;
+
+struct ChunkCoord final {
+    int32_t x = 0;
+    int32_t y = 0;
+
+    constexpr bool operator == (const ChunkCoord& other) const noexcept = default;
+    constexpr bool operator != (const ChunkCoord& other) const noexcept = default;
+};
+
+// ---
+// Atlas tiles are cut from, laid out left to right and top to bottom starting with tile 1
+// ---
+struct Tileset final {
+    render::Texture texture;
+    util::Vec2f tileSize {16.0F, 16.0F}; // texels
+    uint32_t    columns = 1;
+
+    [[nodiscard]] constexpr util::Rect GetSource(TileId tileId) const noexcept
+    {
+        const uint32_t INDEX = tileId - 1U;
+
+        return {
+            static_cast<float>(INDEX % this->columns) * this->tileSize.x,
+            static_cast<float>(INDEX / this->columns) * this->tileSize.y,
+            this->tileSize.x,
+            this->tileSize.y
+        };
+    }
+};
+
+} // namespace dull::tilemap
@@ -0,0 +1,270 @@
+#include "engine/tilemap/tile_map.hpp"
+#include "engine/profile/profiler.hpp"
+#include "engine/render/render_queue.hpp"
+#include "engine/util/color_rgba.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace dull::tilemap {
+
+[[nodiscard]] static constexpr bool sContains(int32_t minX, int32_t minY, int32_t maxX, int32_t maxY, ChunkCoord coord) noexcept
+{
+    return coord.x >= minX && coord.x <= maxX && coord.y >= minY && coord.y <= maxY;
+}
+
+TileMap::TileMap(const TileMapConfig& config, ITileSource& source)
+    : _config {config}
+    , _source {source}
+    , _chunkCountX {(config.width + CHUNK_SIZE - 1) / CHUNK_SIZE}
+    , _chunkCountY {(config.height + CHUNK_SIZE - 1) / CHUNK_SIZE}
+{
+    zutil::Assert(config.width > 0 && config.height > 0, "Tile map needs a positive size");
+    zutil::Assert(config.tileSize > 0.0F, "Tile map needs a positive tile size");
+    zutil::Assert(config.tileset.columns > 0, "Tileset needs at least one column");
+
+    this->_directory.assign(static_cast<size_t>(this->_chunkCountX) * this->_chunkCountY, NIL_SLOT);
+}
+
+TileMap::~TileMap() noexcept { this->UnloadAll(); }
+
+[[nodiscard]] TileMap::_ChunkRange TileMap::_GetChunkRange(const util::Rect& rect, int32_t margin) const noexcept
+{
+    const float CHUNK_WORLD_SIZE = this->_config.tileSize * CHUNK_SIZE;
+
+    // Floats first, a far away rect would overflow the int conversion
+    const float MIN_X = std::floor(rect.x / CHUNK_WORLD_SIZE) - margin;
+    const float MIN_Y = std::floor(rect.y / CHUNK_WORLD_SIZE) - margin;
+    const float MAX_X = std::floor((rect.x + rect.w) / CHUNK_WORLD_SIZE) + margin;
+    const float MAX_Y = std::floor((rect.y + rect.h) / CHUNK_WORLD_SIZE) + margin;
+
+    return {
+        static_cast<int32_t>(std::clamp(MIN_X, 0.0F, static_cast<float>(this->_chunkCountX))),
+        static_cast<int32_t>(std::clamp(MIN_Y, 0.0F, static_cast<float>(this->_chunkCountY))),
+        static_cast<int32_t>(std::clamp(MAX_X, -1.0F, static_cast<float>(this->_chunkCountX - 1))),
+        static_cast<int32_t>(std::clamp(MAX_Y, -1.0F, static_cast<float>(this->_chunkCountY - 1)))
+    };
+}
+
+[[nodiscard]] uint32_t TileMap::_GetSlot(int32_t chunkX, int32_t chunkY) const noexcept
+{
+    return this->_directory[static_cast<size_t>(chunkY) * this->_chunkCountX + chunkX];
+}
+
+uint32_t TileMap::_Load(ChunkCoord coord)
+{
+    uint32_t slot = NIL_SLOT;
+
+    // Unloaded chunks keep their memory for the next load
+    if (!this->_freeSlots.empty())
+    {
+        slot = this->_freeSlots.back();
+        this->_freeSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(this->_slots.size());
+        this->_slots.push_back(std::make_unique<_Chunk>());
+    }
+
+    _Chunk& chunk = *this->_slots[slot];
+    chunk.coord      = coord;
+    chunk.isResident = true;
+    chunk.isDirty    = true;
+    chunk.isModified = false;
+
+    this->_source.ILoadChunk(coord, chunk.tiles);
+
+    this->_directory[static_cast<size_t>(coord.y) * this->_chunkCountX + coord.x] = slot;
+    this->_residentCount++;
+
+    return slot;
+}
+
+void TileMap::_Unload(uint32_t slot)
+{
+    _Chunk& chunk = *this->_slots[slot];
+
+    if (chunk.isModified) this->_source.ISaveChunk(chunk.coord, chunk.tiles);
+
+    this->_directory[static_cast<size_t>(chunk.coord.y) * this->_chunkCountX + chunk.coord.x] = NIL_SLOT;
+    chunk.isResident = false;
+
+    this->_freeSlots.push_back(slot);
+    this->_residentCount--;
+}
+
+void TileMap::UnloadAll()
+{
+    for (uint32_t slot = 0; slot < this->_slots.size(); slot++)
+        if (this->_slots[slot]->isResident) this->_Unload(slot);
+}
+
+void TileMap::_Rebuild(_Chunk& chunk)
+{
+    const Tileset& tileset = this->_config.tileset;
+    const float TILE_SIZE  = this->_config.tileSize;
+    const util::Color TINT = util::Color::White();
+
+    const int32_t BASE_X = chunk.coord.x * CHUNK_SIZE;
+    const int32_t BASE_Y = chunk.coord.y * CHUNK_SIZE;
+    const int32_t END_X  = std::min(BASE_X + CHUNK_SIZE, this->_config.width);
+    const int32_t END_Y  = std::min(BASE_Y + CHUNK_SIZE, this->_config.height);
+
+    chunk.vertices.clear();
+
+    for (int32_t y = BASE_Y; y < END_Y; y++)
+    {
+        for (int32_t x = BASE_X; x < END_X; x++)
+        {
+            const TileId TILE_ID = chunk.tiles[static_cast<size_t>(y - BASE_Y) * CHUNK_SIZE + (x - BASE_X)];
+
+            if (TILE_ID == EMPTY_TILE) continue;
+
+            const util::Rect SOURCE = tileset.GetSource(TILE_ID);
+            const float LEFT   = static_cast<float>(x) * TILE_SIZE;
+            const float TOP    = static_cast<float>(y) * TILE_SIZE;
+            const float RIGHT  = LEFT + TILE_SIZE;
+            const float BOTTOM = TOP + TILE_SIZE;
+
+            chunk.vertices.push_back({{LEFT , TOP   }, {SOURCE.x           , SOURCE.y           }, TINT});
+            chunk.vertices.push_back({{RIGHT, TOP   }, {SOURCE.x + SOURCE.w, SOURCE.y           }, TINT});
+            chunk.vertices.push_back({{RIGHT, BOTTOM}, {SOURCE.x + SOURCE.w, SOURCE.y + SOURCE.h}, TINT});
+            chunk.vertices.push_back({{LEFT , BOTTOM}, {SOURCE.x           , SOURCE.y + SOURCE.h}, TINT});
+        }
+    }
+
+    chunk.isDirty = false;
+}
+
+void TileMap::Stream(const util::Rect& camera)
+{
+    DULL_PROFILE_ZONE("TileMap::Stream");
+
+    // One chunk of slack past the load range, so a camera moving back and forth over a border doesn't thrash
+    const _ChunkRange KEEP = this->_GetChunkRange(camera, this->_config.streamMargin + 1);
+
+    for (uint32_t slot = 0; slot < this->_slots.size(); slot++)
+    {
+        const _Chunk& chunk = *this->_slots[slot];
+
+        if (chunk.isResident && !sContains(KEEP.minX, KEEP.minY, KEEP.maxX, KEEP.maxY, chunk.coord)) this->_Unload(slot);
+    }
+
+    const _ChunkRange VISIBLE = this->_GetChunkRange(camera, 0);
+
+    for (int32_t chunkY = VISIBLE.minY; chunkY <= VISIBLE.maxY; chunkY++)
+        for (int32_t chunkX = VISIBLE.minX; chunkX <= VISIBLE.maxX; chunkX++)
+            if (this->_GetSlot(chunkX, chunkY) == NIL_SLOT) this->_Load({chunkX, chunkY});
+
+    const _ChunkRange AHEAD = this->_GetChunkRange(camera, this->_config.streamMargin);
+    uint32_t loadBudget = this->_config.maxLoadsPerStream;
+
+    for (int32_t chunkY = AHEAD.minY; chunkY <= AHEAD.maxY && loadBudget > 0; chunkY++)
+    {
+        for (int32_t chunkX = AHEAD.minX; chunkX <= AHEAD.maxX && loadBudget > 0; chunkX++)
+        {
+            if (this->_GetSlot(chunkX, chunkY) != NIL_SLOT) continue;
+
+            this->_Load({chunkX, chunkY});
+            loadBudget--;
+        }
+    }
+}
+
+void TileMap::Submit(render::RenderQueue& renderQueue, const util::Rect& camera)
+{
+    DULL_PROFILE_ZONE("TileMap::Submit");
+
+    // The camera rect cut into the chunk grid, chunks outside it are never touched
+    const _ChunkRange VISIBLE = this->_GetChunkRange(camera, 0);
+
+    for (int32_t chunkY = VISIBLE.minY; chunkY <= VISIBLE.maxY; chunkY++)
+    {
+        for (int32_t chunkX = VISIBLE.minX; chunkX <= VISIBLE.maxX; chunkX++)
+        {
+            const uint32_t SLOT = this->_GetSlot(chunkX, chunkY);
+
+            if (SLOT == NIL_SLOT) continue;
+
+            _Chunk& chunk = *this->_slots[SLOT];
+
+            if (chunk.isDirty) this->_Rebuild(chunk);
+            if (chunk.vertices.empty()) continue;
+
+            renderQueue.SubmitQuads(this->_config.tileset.texture, chunk.vertices, this->_config.layer);
+        }
+    }
+}
+
+// --- Tiles ---
+
+[[nodiscard]] TileId TileMap::GetTile(int32_t x, int32_t y) const noexcept
+{
+    if (!this->IsInside(x, y)) return INVALID_TILE;
+
+    const uint32_t SLOT = this->_GetSlot(x / CHUNK_SIZE, y / CHUNK_SIZE);
+
+    if (SLOT == NIL_SLOT) return INVALID_TILE;
+
+    return this->_slots[SLOT]->tiles[static_cast<size_t>(y % CHUNK_SIZE) * CHUNK_SIZE + x % CHUNK_SIZE];
+}
+
+[[nodiscard]] TileId TileMap::GetTileAt(const util::Vec2f& position) const noexcept
+{
+    const util::Vec2i TILE = this->WorldToTile(position);
+    return this->GetTile(TILE.x, TILE.y);
+}
+
+bool TileMap::SetTile(int32_t x, int32_t y, TileId tileId)
+{
+    if (!this->IsInside(x, y)) return false;
+
+    uint32_t slot = this->_GetSlot(x / CHUNK_SIZE, y / CHUNK_SIZE);
+
+    if (slot == NIL_SLOT) slot = this->_Load({x / CHUNK_SIZE, y / CHUNK_SIZE});
+
+    _Chunk& chunk = *this->_slots[slot];
+    TileId& tile  = chunk.tiles[static_cast<size_t>(y % CHUNK_SIZE) * CHUNK_SIZE + x % CHUNK_SIZE];
+
+    if (tile == tileId) return true;
+
+    tile = tileId;
+    chunk.isDirty    = true;
+    chunk.isModified = true;
+
+    return true;
+}
+
+[[nodiscard]] util::Vec2i TileMap::WorldToTile(const util::Vec2f& position) const noexcept
+{
+    // Clamped to the int range, anything that far out is outside the map anyway
+    constexpr float LIMIT = 1.0e9F;
+
+    return {
+        static_cast<int32_t>(std::clamp(std::floor(position.x / this->_config.tileSize), -LIMIT, LIMIT)),
+        static_cast<int32_t>(std::clamp(std::floor(position.y / this->_config.tileSize), -LIMIT, LIMIT))
+    };
+}
+
+[[nodiscard]] util::Rect TileMap::GetTileRect(int32_t x, int32_t y) const noexcept
+{
+    const float TILE_SIZE = this->_config.tileSize;
+    return {static_cast<float>(x) * TILE_SIZE, static_cast<float>(y) * TILE_SIZE, TILE_SIZE, TILE_SIZE};
+}
+
+// --- Stats ---
+
+[[nodiscard]] size_t TileMap::GetChunkMemoryBytes() const noexcept
+{
+    size_t byteCount = this->_directory.size() * sizeof(uint32_t);
+
+    for (const std::unique_ptr<_Chunk>& chunkPtr : this->_slots)
+        byteCount += sizeof(_Chunk) + chunkPtr->vertices.capacity() * sizeof(render::Vertex);
+
+    return byteCount;
+}
+
+} // namespace dull::tilemap
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "engine/render/render_batch.hpp"
+#include "engine/tilemap/i_tile_source.hpp"
+#include "engine/tilemap/tile.hpp"
+#include "engine/util/rect.hpp"
+#include "engine/util/vec2.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+// Forward Declaration
+namespace dull::render { struct RenderQueue; }
+
+namespace dull::tilemap {
+
+// ---
+// Size, look and streaming behaviour of a TileMap
+// ---
+struct TileMapConfig final {
+    int32_t width    = 0;     // tiles
+    int32_t height   = 0;     // tiles
+    float   tileSize = 16.0F; // world units, the map starts at the origin
+
+    Tileset tileset;
+    int16_t layer = 0;
+
+    // Chunks around the camera loaded ahead of time, residents one chunk further out are unloaded
+    int32_t streamMargin = 2;
+
+    // Ahead of time loads per Stream call, visible chunks always load right away
+    uint32_t maxLoadsPerStream = 8;
+};
+
+// ---
+// Large tile grid streamed chunk by chunk around a camera
+// Note: only chunks near the camera are resident, a dense directory maps every chunk to its slot so lookups are O(1)
+// Note: every chunk caches its quads, edits only rebuild the chunk they touch
+// Note: frame cost follows the number of visible chunks, not the map size
+// Note: main thread only
+// ---
+struct TileMap final {
+private:
+    static constexpr uint32_t NIL_SLOT = std::numeric_limits<uint32_t>::max();
+
+    struct _ChunkRange {
+        int32_t minX = 0;
+        int32_t minY = 0;
+        int32_t maxX = -1;
+        int32_t maxY = -1;
+    };
+
+    struct _Chunk {
+        std::array<TileId, CHUNK_TILE_COUNT> tiles {};
+        std::vector<render::Vertex> vertices; // cached draw list
+        ChunkCoord coord;
+        bool isResident = false;
+        bool isDirty    = true;  // draw list out of date
+        bool isModified = false; // edited since loaded, handed back to the source on unload
+    };
+
+    TileMapConfig _config;
+    ITileSource& _source;
+    int32_t _chunkCountX = 0;
+    int32_t _chunkCountY = 0;
+
+    std::vector<uint32_t> _directory; // slot of every chunk, NIL_SLOT when not resident
+    std::vector<std::unique_ptr<_Chunk>> _slots;
+    std::vector<uint32_t> _freeSlots;
+    size_t _residentCount = 0;
+
+    [[nodiscard]] _ChunkRange _GetChunkRange(const util::Rect& rect, int32_t margin) const noexcept;
+    [[nodiscard]] uint32_t _GetSlot(int32_t chunkX, int32_t chunkY) const noexcept;
+
+    uint32_t _Load(ChunkCoord coord);
+    void _Unload(uint32_t slot);
+    void _Rebuild(_Chunk& chunk);
+
+public:
+    TileMap(TileMap&&)                 = delete;
+    TileMap(const TileMap&)            = delete;
+    TileMap& operator=(TileMap&&)      = delete;
+    TileMap& operator=(const TileMap&) = delete;
+
+    // Note: the source must outlive the map, edited chunks still resident are saved on destruction
+    TileMap(const TileMapConfig& config, ITileSource& source);
+    ~TileMap() noexcept;
+
+    // Loads chunks around camera and unloads the ones that fell out of range
+    void Stream(const util::Rect& camera);
+
+    // Queues the resident chunks overlapping camera, dirty ones are rebuilt first
+    void Submit(render::RenderQueue& renderQueue, const util::Rect& camera);
+
+    // Unloads every chunk, edited ones go back to the source
+    void UnloadAll();
+
+// --- Tiles ---
+
+    // INVALID_TILE outside the map or in a chunk that isn't resident
+    [[nodiscard]] TileId GetTile(int32_t x, int32_t y) const noexcept;
+    [[nodiscard]] TileId GetTileAt(const util::Vec2f& position) const noexcept;
+
+    // Loads the chunk first when needed, false outside the map
+    bool SetTile(int32_t x, int32_t y, TileId tileId);
+
+    [[nodiscard]] bool IsInside(int32_t x, int32_t y) const noexcept
+    {
+        return x >= 0 && y >= 0 && x < this->_config.width && y < this->_config.height;
+    }
+
+    [[nodiscard]] bool IsResident(int32_t x, int32_t y) const noexcept
+    {
+        return this->IsInside(x, y) && this->_GetSlot(x / CHUNK_SIZE, y / CHUNK_SIZE) != NIL_SLOT;
+    }
+
+    [[nodiscard]] util::Vec2i WorldToTile(const util::Vec2f& position) const noexcept;
+    [[nodiscard]] util::Rect GetTileRect(int32_t x, int32_t y) const noexcept;
+
+// --- Stats ---
+
+    [[nodiscard]] const TileMapConfig& GetConfig() const noexcept { return this->_config; }
+    [[nodiscard]] size_t GetResidentChunkCount() const noexcept { return this->_residentCount; }
+
+    // Tile and cached vertex memory of every chunk slot, resident or pooled
+    [[nodiscard]] size_t GetChunkMemoryBytes() const noexcept;
+};
+
+} // namespace dull::tilemap
@@ -0,0 +1,598 @@
+#include "engine/util/color_batch.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+// Note: define DULL_COLOR_SCALAR to force the scalar path
+#if defined(DULL_COLOR_SCALAR)
+#elif defined(__AVX2__)
+    #include <immintrin.h>
+    #define DULL_COLOR_AVX2
+    #define DULL_COLOR_LANES
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define DULL_COLOR_SSE2
+    #define DULL_COLOR_LANES
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+    #define DULL_COLOR_NEON
+    #define DULL_COLOR_LANES
+#endif
+
+namespace dull::util::batch {
+
+// --- Scalar lane ---
+// Note: the Color operators are the reference, every vector op below reproduces them exactly
+
+[[nodiscard]] static inline Color sAddSaturated(Color lhs, Color rhs) noexcept { return lhs + rhs; }
+[[nodiscard]] static inline Color sSubSaturated(Color lhs, Color rhs) noexcept { return lhs - rhs; }
+[[nodiscard]] static inline Color sMul         (Color lhs, Color rhs) noexcept { return lhs * rhs; }
+[[nodiscard]] static inline Color sGray        (Color color) noexcept { return color.Grayscaled(); }
+
+[[nodiscard]] static inline Color sSplatAlpha(Color color) noexcept { return {color.a, color.a, color.a, color.a}; }
+
+// 255 - channel on all four channels
+[[nodiscard]] static inline Color sInvert(Color color) noexcept
+{
+    return {
+        static_cast<uint8_t>(255 - color.r),
+        static_cast<uint8_t>(255 - color.g),
+        static_cast<uint8_t>(255 - color.b),
+        static_cast<uint8_t>(255 - color.a)
+    };
+}
+
+// rgb of value, alpha of source
+[[nodiscard]] static inline Color sKeepAlpha(Color value, Color source) noexcept { return {value.r, value.g, value.b, source.a}; }
+
+// --- Vector lane ---
+// Note: a lane holds whole pixels, 4 in a 128 bit register and 8 in a 256 bit one
+
+#if defined(DULL_COLOR_AVX2)
+
+using _Lane = __m256i;
+static constexpr size_t LANE_PIXELS = 8;
+static constexpr const char* INSTRUCTION_SET = "AVX2";
+
+[[nodiscard]] static inline _Lane sLoad(const void* source) noexcept { return _mm256_loadu_si256(static_cast<const __m256i*>(source)); }
+static inline void sStore(void* target, _Lane value) noexcept { _mm256_storeu_si256(static_cast<__m256i*>(target), value); }
+[[nodiscard]] static inline _Lane sSplat32(uint32_t value) noexcept { return _mm256_set1_epi32(static_cast<int>(value)); }
+
+[[nodiscard]] static inline _Lane sAnd(_Lane lhs, _Lane rhs) noexcept { return _mm256_and_si256(lhs, rhs); }
+[[nodiscard]] static inline _Lane sOr (_Lane lhs, _Lane rhs) noexcept { return _mm256_or_si256(lhs, rhs); }
+[[nodiscard]] static inline _Lane sXor(_Lane lhs, _Lane rhs) noexcept { return _mm256_xor_si256(lhs, rhs); }
+
+template <int BITS> [[nodiscard]] static inline _Lane sShiftLeft32 (_Lane value) noexcept { return _mm256_slli_epi32(value, BITS); }
+template <int BITS> [[nodiscard]] static inline _Lane sShiftRight32(_Lane value) noexcept { return _mm256_srli_epi32(value, BITS); }
+
+[[nodiscard]] static inline _Lane sAddSaturated(_Lane lhs, _Lane rhs) noexcept { return _mm256_adds_epu8(lhs, rhs); }
+[[nodiscard]] static inline _Lane sSubSaturated(_Lane lhs, _Lane rhs) noexcept { return _mm256_subs_epu8(lhs, rhs); }
+
+// Exact x / 255 for x <= 255 * 255
+[[nodiscard]] static inline __m256i sDiv255(__m256i value) noexcept
+{
+    const __m256i PLUS_ONE = _mm256_add_epi16(value, _mm256_set1_epi16(1));
+    return _mm256_srli_epi16(_mm256_add_epi16(PLUS_ONE, _mm256_srli_epi16(PLUS_ONE, 8)), 8);
+}
+
+[[nodiscard]] static inline _Lane sMul(_Lane lhs, _Lane rhs) noexcept
+{
+    const __m256i ZERO = _mm256_setzero_si256();
+
+    // Unpacks and packs are both per 128 bit half, so pixel order survives the round trip
+    const __m256i LOW  = sDiv255(_mm256_mullo_epi16(_mm256_unpacklo_epi8(lhs, ZERO), _mm256_unpacklo_epi8(rhs, ZERO)));
+    const __m256i HIGH = sDiv255(_mm256_mullo_epi16(_mm256_unpackhi_epi8(lhs, ZERO), _mm256_unpackhi_epi8(rhs, ZERO)));
+
+    return _mm256_packus_epi16(LOW, HIGH);
+}
+
+// Rounded x / 255 for x <= 255 * 255
+[[nodiscard]] static inline __m256i sDiv255Rounded(__m256i value) noexcept
+{
+    const __m256i PLUS_HALF = _mm256_add_epi16(value, _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(PLUS_HALF, _mm256_srli_epi16(PLUS_HALF, 8)), 8);
+}
+
+// Color::Lerp per channel, weights holds the weight of each pixel in all four of its bytes
+[[nodiscard]] static inline _Lane sLerp(_Lane from, _Lane to, _Lane weights) noexcept
+{
+    const __m256i ZERO     = _mm256_setzero_si256();
+    const __m256i INVERSES = _mm256_xor_si256(weights, _mm256_set1_epi32(-1));
+
+    const __m256i LOW = sDiv255Rounded(_mm256_add_epi16(
+        _mm256_mullo_epi16(_mm256_unpacklo_epi8(from, ZERO), _mm256_unpacklo_epi8(INVERSES, ZERO)),
+        _mm256_mullo_epi16(_mm256_unpacklo_epi8(to, ZERO),   _mm256_unpacklo_epi8(weights, ZERO))
+    ));
+
+    const __m256i HIGH = sDiv255Rounded(_mm256_add_epi16(
+        _mm256_mullo_epi16(_mm256_unpackhi_epi8(from, ZERO), _mm256_unpackhi_epi8(INVERSES, ZERO)),
+        _mm256_mullo_epi16(_mm256_unpackhi_epi8(to, ZERO),   _mm256_unpackhi_epi8(weights, ZERO))
+    ));
+
+    return _mm256_packus_epi16(LOW, HIGH);
+}
+
+// 16 bit products of the low byte of every 32 bit pixel word, products stay below 2^16
+[[nodiscard]] static inline _Lane sMulLow16(_Lane value, uint32_t factor) noexcept { return _mm256_mullo_epi16(value, sSplat32(factor)); }
+[[nodiscard]] static inline _Lane sAdd32(_Lane lhs, _Lane rhs) noexcept { return _mm256_add_epi32(lhs, rhs); }
+
+[[nodiscard]] static inline _Lane sSelect32(_Lane mask, _Lane onTrue, _Lane onFalse) noexcept { return _mm256_blendv_epi8(onFalse, onTrue, mask); }
+[[nodiscard]] static inline _Lane sIsZero32(_Lane value) noexcept { return _mm256_cmpeq_epi32(value, _mm256_setzero_si256()); }
+
+// One byte per pixel, zero extended into the low byte of each word
+[[nodiscard]] static inline _Lane sLoadBytes(const uint8_t* source) noexcept
+{
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source)));
+}
+
+#elif defined(DULL_COLOR_SSE2)
+
+using _Lane = __m128i;
+static constexpr size_t LANE_PIXELS = 4;
+static constexpr const char* INSTRUCTION_SET = "SSE2";
+
+[[nodiscard]] static inline _Lane sLoad(const void* source) noexcept { return _mm_loadu_si128(static_cast<const __m128i*>(source)); }
+static inline void sStore(void* target, _Lane value) noexcept { _mm_storeu_si128(static_cast<__m128i*>(target), value); }
+[[nodiscard]] static inline _Lane sSplat32(uint32_t value) noexcept { return _mm_set1_epi32(static_cast<int>(value)); }
+
+[[nodiscard]] static inline _Lane sAnd(_Lane lhs, _Lane rhs) noexcept { return _mm_and_si128(lhs, rhs); }
+[[nodiscard]] static inline _Lane sOr (_Lane lhs, _Lane rhs) noexcept { return _mm_or_si128(lhs, rhs); }
+[[nodiscard]] static inline _Lane sXor(_Lane lhs, _Lane rhs) noexcept { return _mm_xor_si128(lhs, rhs); }
+
+template <int BITS> [[nodiscard]] static inline _Lane sShiftLeft32 (_Lane value) noexcept { return _mm_slli_epi32(value, BITS); }
+template <int BITS> [[nodiscard]] static inline _Lane sShiftRight32(_Lane value) noexcept { return _mm_srli_epi32(value, BITS); }
+
+[[nodiscard]] static inline _Lane sAddSaturated(_Lane lhs, _Lane rhs) noexcept { return _mm_adds_epu8(lhs, rhs); }
+[[nodiscard]] static inline _Lane sSubSaturated(_Lane lhs, _Lane rhs) noexcept { return _mm_subs_epu8(lhs, rhs); }
+
+// Exact x / 255 for x <= 255 * 255
+[[nodiscard]] static inline __m128i sDiv255(__m128i value) noexcept
+{
+    const __m128i PLUS_ONE = _mm_add_epi16(value, _mm_set1_epi16(1));
+    return _mm_srli_epi16(_mm_add_epi16(PLUS_ONE, _mm_srli_epi16(PLUS_ONE, 8)), 8);
+}
+
+[[nodiscard]] static inline _Lane sMul(_Lane lhs, _Lane rhs) noexcept
+{
+    const __m128i ZERO = _mm_setzero_si128();
+
+    const __m128i LOW  = sDiv255(_mm_mullo_epi16(_mm_unpacklo_epi8(lhs, ZERO), _mm_unpacklo_epi8(rhs, ZERO)));
+    const __m128i HIGH = sDiv255(_mm_mullo_epi16(_mm_unpackhi_epi8(lhs, ZERO), _mm_unpackhi_epi8(rhs, ZERO)));
+
+    return _mm_packus_epi16(LOW, HIGH);
+}
+
+// Rounded x / 255 for x <= 255 * 255
+[[nodiscard]] static inline __m128i sDiv255Rounded(__m128i value) noexcept
+{
+    const __m128i PLUS_HALF = _mm_add_epi16(value, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(PLUS_HALF, _mm_srli_epi16(PLUS_HALF, 8)), 8);
+}
+
+// Color::Lerp per channel, weights holds the weight of each pixel in all four of its bytes
+[[nodiscard]] static inline _Lane sLerp(_Lane from, _Lane to, _Lane weights) noexcept
+{
+    const __m128i ZERO     = _mm_setzero_si128();
+    const __m128i INVERSES = _mm_xor_si128(weights, _mm_set1_epi32(-1));
+
+    const __m128i LOW = sDiv255Rounded(_mm_add_epi16(
+        _mm_mullo_epi16(_mm_unpacklo_epi8(from, ZERO), _mm_unpacklo_epi8(INVERSES, ZERO)),
+        _mm_mullo_epi16(_mm_unpacklo_epi8(to, ZERO),   _mm_unpacklo_epi8(weights, ZERO))
+    ));
+
+    const __m128i HIGH = sDiv255Rounded(_mm_add_epi16(
+        _mm_mullo_epi16(_mm_unpackhi_epi8(from, ZERO), _mm_unpackhi_epi8(INVERSES, ZERO)),
+        _mm_mullo_epi16(_mm_unpackhi_epi8(to, ZERO),   _mm_unpackhi_epi8(weights, ZERO))
+    ));
+
+    return _mm_packus_epi16(LOW, HIGH);
+}
+
+// 16 bit products of the low byte of every 32 bit pixel word, products stay below 2^16
+[[nodiscard]] static inline _Lane sMulLow16(_Lane value, uint32_t factor) noexcept { return _mm_mullo_epi16(value, sSplat32(factor)); }
+[[nodiscard]] static inline _Lane sAdd32(_Lane lhs, _Lane rhs) noexcept { return _mm_add_epi32(lhs, rhs); }
+
+[[nodiscard]] static inline _Lane sSelect32(_Lane mask, _Lane onTrue, _Lane onFalse) noexcept
+{
+    return _mm_or_si128(_mm_and_si128(mask, onTrue), _mm_andnot_si128(mask, onFalse));
+}
+
+[[nodiscard]] static inline _Lane sIsZero32(_Lane value) noexcept { return _mm_cmpeq_epi32(value, _mm_setzero_si128()); }
+
+// One byte per pixel, zero extended into the low byte of each word
+[[nodiscard]] static inline _Lane sLoadBytes(const uint8_t* source) noexcept
+{
+    int32_t bytes = 0;
+    std::memcpy(&bytes, source, sizeof(bytes));
+
+    const __m128i ZERO = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), ZERO), ZERO);
+}
+
+#elif defined(DULL_COLOR_NEON)
+
+using _Lane = uint32x4_t;
+static constexpr size_t LANE_PIXELS = 4;
+static constexpr const char* INSTRUCTION_SET = "NEON";
+
+[[nodiscard]] static inline _Lane sLoad(const void* source) noexcept { return vreinterpretq_u32_u8(vld1q_u8(static_cast<const uint8_t*>(source))); }
+static inline void sStore(void* target, _Lane value) noexcept { vst1q_u8(static_cast<uint8_t*>(target), vreinterpretq_u8_u32(value)); }
+[[nodiscard]] static inline _Lane sSplat32(uint32_t value) noexcept { return vdupq_n_u32(value); }
+
+[[nodiscard]] static inline _Lane sAnd(_Lane lhs, _Lane rhs) noexcept { return vandq_u32(lhs, rhs); }
+[[nodiscard]] static inline _Lane sOr (_Lane lhs, _Lane rhs) noexcept { return vorrq_u32(lhs, rhs); }
+[[nodiscard]] static inline _Lane sXor(_Lane lhs, _Lane rhs) noexcept { return veorq_u32(lhs, rhs); }
+
+template <int BITS> [[nodiscard]] static inline _Lane sShiftLeft32 (_Lane value) noexcept { return vshlq_n_u32(value, BITS); }
+template <int BITS> [[nodiscard]] static inline _Lane sShiftRight32(_Lane value) noexcept { return vshrq_n_u32(value, BITS); }
+
+[[nodiscard]] static inline _Lane sAddSaturated(_Lane lhs, _Lane rhs) noexcept
+{
+    return vreinterpretq_u32_u8(vqaddq_u8(vreinterpretq_u8_u32(lhs), vreinterpretq_u8_u32(rhs)));
+}
+
+[[nodiscard]] static inline _Lane sSubSaturated(_Lane lhs, _Lane rhs) noexcept
+{
+    return vreinterpretq_u32_u8(vqsubq_u8(vreinterpretq_u8_u32(lhs), vreinterpretq_u8_u32(rhs)));
+}
+
+// Exact x / 255 for x <= 255 * 255
+[[nodiscard]] static inline uint16x8_t sDiv255(uint16x8_t value) noexcept
+{
+    const uint16x8_t PLUS_ONE = vaddq_u16(value, vdupq_n_u16(1));
+    return vshrq_n_u16(vaddq_u16(PLUS_ONE, vshrq_n_u16(PLUS_ONE, 8)), 8);
+}
+
+[[nodiscard]] static inline _Lane sMul(_Lane lhs, _Lane rhs) noexcept
+{
+    const uint8x16_t LHS = vreinterpretq_u8_u32(lhs);
+    const uint8x16_t RHS = vreinterpretq_u8_u32(rhs);
+
+    const uint16x8_t LOW  = sDiv255(vmull_u8(vget_low_u8(LHS), vget_low_u8(RHS)));
+    const uint16x8_t HIGH = sDiv255(vmull_high_u8(LHS, RHS));
+
+    return vreinterpretq_u32_u8(vcombine_u8(vmovn_u16(LOW), vmovn_u16(HIGH)));
+}
+
+// Rounded x / 255 for x <= 255 * 255
+[[nodiscard]] static inline uint16x8_t sDiv255Rounded(uint16x8_t value) noexcept
+{
+    const uint16x8_t PLUS_HALF = vaddq_u16(value, vdupq_n_u16(128));
+    return vshrq_n_u16(vaddq_u16(PLUS_HALF, vshrq_n_u16(PLUS_HALF, 8)), 8);
+}
+
+// Color::Lerp per channel, weights holds the weight of each pixel in all four of its bytes
+[[nodiscard]] static inline _Lane sLerp(_Lane from, _Lane to, _Lane weights) noexcept
+{
+    const uint8x16_t FROM     = vreinterpretq_u8_u32(from);
+    const uint8x16_t TO       = vreinterpretq_u8_u32(to);
+    const uint8x16_t WEIGHTS  = vreinterpretq_u8_u32(weights);
+    const uint8x16_t INVERSES = vmvnq_u8(WEIGHTS);
+
+    const uint16x8_t LOW  = sDiv255Rounded(vmlal_u8(vmull_u8(vget_low_u8(FROM), vget_low_u8(INVERSES)), vget_low_u8(TO), vget_low_u8(WEIGHTS)));
+    const uint16x8_t HIGH = sDiv255Rounded(vmlal_high_u8(vmull_high_u8(FROM, INVERSES), TO, WEIGHTS));
+
+    return vreinterpretq_u32_u8(vcombine_u8(vmovn_u16(LOW), vmovn_u16(HIGH)));
+}
+
+[[nodiscard]] static inline _Lane sMulLow16(_Lane value, uint32_t factor) noexcept { return vmulq_n_u32(value, factor); }
+[[nodiscard]] static inline _Lane sAdd32(_Lane lhs, _Lane rhs) noexcept { return vaddq_u32(lhs, rhs); }
+
+[[nodiscard]] static inline _Lane sSelect32(_Lane mask, _Lane onTrue, _Lane onFalse) noexcept { return vbslq_u32(mask, onTrue, onFalse); }
+[[nodiscard]] static inline _Lane sIsZero32(_Lane value) noexcept { return vceqq_u32(value, vdupq_n_u32(0)); }
+
+// One byte per pixel, zero extended into the low byte of each word
+[[nodiscard]] static inline _Lane sLoadBytes(const uint8_t* source) noexcept
+{
+    uint32_t bytes = 0;
+    std::memcpy(&bytes, source, sizeof(bytes));
+
+    return vmovl_u16(vget_low_u16(vmovl_u8(vcreate_u8(bytes))));
+}
+
+#else
+
+static constexpr size_t LANE_PIXELS = 1;
+static constexpr const char* INSTRUCTION_SET = "Scalar";
+
+#endif
+
+[[nodiscard]] const char* GetColorInstructionSet() noexcept { return INSTRUCTION_SET; }
+
+#if defined(DULL_COLOR_LANES)
+
+// Pixels are little endian RGBA words, alpha sits in the top byte
+static constexpr uint32_t ALPHA_MASK = 0xFF000000;
+static constexpr uint32_t BYTE_MASK  = 0x000000FF;
+
+[[nodiscard]] static inline _Lane sSplatAlpha(_Lane pixels) noexcept
+{
+    const _Lane ALPHA  = sShiftRight32<24>(pixels);
+    const _Lane DOUBLE = sOr(ALPHA, sShiftLeft32<8>(ALPHA));
+
+    return sOr(DOUBLE, sShiftLeft32<16>(DOUBLE));
+}
+
+[[nodiscard]] static inline _Lane sInvert(_Lane pixels) noexcept { return sXor(pixels, sSplat32(0xFFFFFFFF)); }
+
+// Copies the low byte of every word into its other three bytes
+[[nodiscard]] static inline _Lane sSplatLow(_Lane words) noexcept
+{
+    const _Lane DOUBLE = sOr(words, sShiftLeft32<8>(words));
+    return sOr(DOUBLE, sShiftLeft32<16>(DOUBLE));
+}
+
+[[nodiscard]] static inline uint32_t sToWord(Color color) noexcept
+{
+    return static_cast<uint32_t>(color.r) | (static_cast<uint32_t>(color.g) << 8) | (static_cast<uint32_t>(color.b) << 16) | (static_cast<uint32_t>(color.a) << 24);
+}
+
+[[nodiscard]] static inline _Lane sKeepAlpha(_Lane value, _Lane source) noexcept
+{
+    return sOr(sAnd(value, sSplat32(~ALPHA_MASK)), sAnd(source, sSplat32(ALPHA_MASK)));
+}
+
+[[nodiscard]] static inline _Lane sGray(_Lane pixels) noexcept
+{
+    const _Lane REDS   = sAnd(pixels, sSplat32(BYTE_MASK));
+    const _Lane GREENS = sAnd(sShiftRight32<8>(pixels), sSplat32(BYTE_MASK));
+    const _Lane BLUES  = sAnd(sShiftRight32<16>(pixels), sSplat32(BYTE_MASK));
+
+    const _Lane LUMA = sShiftRight32<8>(sAdd32(sAdd32(sMulLow16(REDS, 77), sMulLow16(GREENS, 151)), sMulLow16(BLUES, 28)));
+    const _Lane WIDE = sOr(LUMA, sShiftLeft32<8>(LUMA));
+
+    return sKeepAlpha(sOr(WIDE, sShiftLeft32<16>(LUMA)), pixels);
+}
+
+// Swaps the red and blue bytes of every word
+[[nodiscard]] static inline _Lane sSwapRedBlue(_Lane words) noexcept
+{
+    return sOr(
+        sAnd(words, sSplat32(0xFF00FF00)),
+        sOr(sAnd(sShiftRight32<16>(words), sSplat32(0x000000FF)), sAnd(sShiftLeft32<16>(words), sSplat32(0x00FF0000)))
+    );
+}
+
+[[nodiscard]] static inline _Lane sByteSwap(_Lane words) noexcept
+{
+    return sOr(
+        sOr(sShiftLeft32<24>(words), sAnd(sShiftLeft32<8>(words), sSplat32(0x00FF0000))),
+        sOr(sAnd(sShiftRight32<8>(words), sSplat32(0x0000FF00)), sShiftRight32<24>(words))
+    );
+}
+
+#endif
+
+// --- Kernel drivers ---
+// Note: ops are generic lambdas, instantiated once for the vector lane and once for the scalar tail
+
+// Smallest element count of the spans, mismatched sizes are a caller bug but never read past a span
+template <typename... SpanTs>
+[[nodiscard]] static inline size_t sCount(const SpanTs&... spans) noexcept
+{
+    const size_t COUNT = std::min({spans.size()...});
+    zutil::Assert(((spans.size() == COUNT) && ...), "Batch spans must hold the same number of elements");
+    return COUNT;
+}
+
+template <typename OpT>
+static inline void sMapPixels(const Color* lhs, const Color* rhs, Color* out, size_t count, OpT op) noexcept
+{
+    size_t index = 0;
+
+#if defined(DULL_COLOR_LANES)
+    for (; index + LANE_PIXELS <= count; index += LANE_PIXELS)
+        sStore(out + index, op(sLoad(lhs + index), sLoad(rhs + index)));
+#endif
+
+    for (; index < count; index++) out[index] = op(lhs[index], rhs[index]);
+}
+
+// --- Operations ---
+
+static constexpr auto ADD_OP = [](auto lhs, auto rhs) noexcept { return sAddSaturated(lhs, rhs); };
+static constexpr auto SUB_OP = [](auto lhs, auto rhs) noexcept { return sSubSaturated(lhs, rhs); };
+static constexpr auto MUL_OP = [](auto lhs, auto rhs) noexcept { return sMul(lhs, rhs); };
+
+static constexpr auto OVER_OP = [](auto source, auto destination) noexcept
+{
+    return sAddSaturated(source, sMul(destination, sInvert(sSplatAlpha(source))));
+};
+
+static constexpr auto PREMULTIPLY_OP = [](auto color, auto) noexcept { return sKeepAlpha(sMul(color, sSplatAlpha(color)), color); };
+static constexpr auto GRAY_OP        = [](auto color, auto) noexcept { return sGray(color); };
+
+void Add(std::span<const Color> lhs, std::span<const Color> rhs, std::span<Color> out) noexcept
+{
+    sMapPixels(lhs.data(), rhs.data(), out.data(), sCount(lhs, rhs, out), ADD_OP);
+}
+
+void Subtract(std::span<const Color> lhs, std::span<const Color> rhs, std::span<Color> out) noexcept
+{
+    sMapPixels(lhs.data(), rhs.data(), out.data(), sCount(lhs, rhs, out), SUB_OP);
+}
+
+void Multiply(std::span<const Color> lhs, std::span<const Color> rhs, std::span<Color> out) noexcept
+{
+    sMapPixels(lhs.data(), rhs.data(), out.data(), sCount(lhs, rhs, out), MUL_OP);
+}
+
+void BlendOver(std::span<const Color> source, std::span<const Color> destination, std::span<Color> out) noexcept
+{
+    sMapPixels(source.data(), destination.data(), out.data(), sCount(source, destination, out), OVER_OP);
+}
+
+void Premultiply(std::span<const Color> colors, std::span<Color> out) noexcept
+{
+    sMapPixels(colors.data(), colors.data(), out.data(), sCount(colors, out), PREMULTIPLY_OP);
+}
+
+void Grayscale(std::span<const Color> colors, std::span<Color> out) noexcept
+{
+    sMapPixels(colors.data(), colors.data(), out.data(), sCount(colors, out), GRAY_OP);
+}
+
+// --- Interpolation ---
+
+void Lerp(Color from, Color to, std::span<const uint8_t> weights, std::span<Color> out) noexcept
+{
+    const size_t COUNT = sCount(weights, out);
+    size_t index = 0;
+
+#if defined(DULL_COLOR_LANES)
+    const _Lane FROM = sSplat32(sToWord(from));
+    const _Lane TO   = sSplat32(sToWord(to));
+
+    // The two products are summed in 16 bits and rounded once, like Color::Lerp
+    for (; index + LANE_PIXELS <= COUNT; index += LANE_PIXELS)
+        sStore(out.data() + index, sLerp(FROM, TO, sSplatLow(sLoadBytes(weights.data() + index))));
+#endif
+
+    for (; index < COUNT; index++) out[index] = Color::Lerp(from, to, weights[index]);
+}
+
+// --- Table driven ---
+// Note: per channel lookups, the tables stay in L1 and gathers wouldn't beat them
+
+static constexpr size_t LINEAR_TO_SRGB_SIZE = 4096;
+
+struct _ColorTables {
+    std::array<uint32_t, 256> unpremultiplyFactors;
+    std::array<float, 256> srgbToLinear;
+    std::array<uint8_t, LINEAR_TO_SRGB_SIZE> linearToSrgb;
+
+    _ColorTables() noexcept
+    {
+        // 16.16 reciprocals of alpha rounded up, exact against integer rounding for every channel and alpha
+        this->unpremultiplyFactors[0] = 0;
+
+        for (uint32_t alpha = 1; alpha < 256; alpha++)
+            this->unpremultiplyFactors[alpha] = ((255U << 16) + alpha - 1) / alpha;
+
+        for (uint32_t value = 0; value < 256; value++)
+        {
+            const double SRGB = value / 255.0;
+            this->srgbToLinear[value] = static_cast<float>(SRGB <= 0.04045 ? SRGB / 12.92 : std::pow((SRGB + 0.055) / 1.055, 2.4));
+        }
+
+        for (size_t index = 0; index < LINEAR_TO_SRGB_SIZE; index++)
+        {
+            const double LINEAR = static_cast<double>(index) / (LINEAR_TO_SRGB_SIZE - 1);
+            const double SRGB   = LINEAR <= 0.0031308 ? LINEAR * 12.92 : 1.055 * std::pow(LINEAR, 1.0 / 2.4) - 0.055;
+
+            this->linearToSrgb[index] = static_cast<uint8_t>(std::lround(std::clamp(SRGB, 0.0, 1.0) * 255.0));
+        }
+    }
+};
+
+[[nodiscard]] static const _ColorTables& sGetTables() noexcept
+{
+    static const _ColorTables TABLES;
+    return TABLES;
+}
+
+[[nodiscard]] static inline uint8_t sUnpremultiplyChannel(uint8_t channel, uint32_t factor) noexcept
+{
+    return static_cast<uint8_t>(std::min((channel * factor + 0x8000U) >> 16, 255U));
+}
+
+void Unpremultiply(std::span<const Color> colors, std::span<Color> out) noexcept
+{
+    const size_t COUNT = sCount(colors, out);
+    const _ColorTables& tables = sGetTables();
+
+    for (size_t index = 0; index < COUNT; index++)
+    {
+        const Color COLOR  = colors[index];
+        const uint32_t FACTOR = tables.unpremultiplyFactors[COLOR.a];
+
+        out[index] = {
+            sUnpremultiplyChannel(COLOR.r, FACTOR),
+            sUnpremultiplyChannel(COLOR.g, FACTOR),
+            sUnpremultiplyChannel(COLOR.b, FACTOR),
+            COLOR.a
+        };
+    }
+}
+
+void SrgbToLinear(std::span<const Color> colors, std::span<LinearColor> out) noexcept
+{
+    const size_t COUNT = sCount(colors, out);
+    const _ColorTables& tables = sGetTables();
+
+    for (size_t index = 0; index < COUNT; index++)
+    {
+        const Color COLOR = colors[index];
+
+        out[index] = {
+            tables.srgbToLinear[COLOR.r],
+            tables.srgbToLinear[COLOR.g],
+            tables.srgbToLinear[COLOR.b],
+            static_cast<float>(COLOR.a) / 255.0F
+        };
+    }
+}
+
+[[nodiscard]] static inline size_t sLinearIndex(float value) noexcept
+{
+    return static_cast<size_t>(std::clamp(value, 0.0F, 1.0F) * (LINEAR_TO_SRGB_SIZE - 1) + 0.5F);
+}
+
+void LinearToSrgb(std::span<const LinearColor> colors, std::span<Color> out) noexcept
+{
+    const size_t COUNT = sCount(colors, out);
+    const _ColorTables& tables = sGetTables();
+
+    for (size_t index = 0; index < COUNT; index++)
+    {
+        const LinearColor& color = colors[index];
+
+        out[index] = {
+            tables.linearToSrgb[sLinearIndex(color.r)],
+            tables.linearToSrgb[sLinearIndex(color.g)],
+            tables.linearToSrgb[sLinearIndex(color.b)],
+            static_cast<uint8_t>(std::clamp(color.a, 0.0F, 1.0F) * 255.0F + 0.5F)
+        };
+    }
+}
+
+// --- Hex ---
+
+void PackHex(std::span<const Color> colors, std::span<uint32_t> out) noexcept
+{
+    const size_t COUNT = sCount(colors, out);
+    size_t index = 0;
+
+#if defined(DULL_COLOR_LANES)
+    // Memory order RGBA reads as 0xAABBGGRR, ToHex wants 0xAARRGGBB
+    for (; index + LANE_PIXELS <= COUNT; index += LANE_PIXELS)
+        sStore(out.data() + index, sSwapRedBlue(sLoad(colors.data() + index)));
+#endif
+
+    for (; index < COUNT; index++) out[index] = colors[index].ToHex();
+}
+
+void UnpackHex(std::span<const uint32_t> hexValues, std::span<Color> out) noexcept
+{
+    const size_t COUNT = sCount(hexValues, out);
+    size_t index = 0;
+
+#if defined(DULL_COLOR_LANES)
+    // FromHex reads values up to 0xFFFFFF as opaque 0xRRGGBB and larger ones as 0xRRGGBBAA
+    for (; index + LANE_PIXELS <= COUNT; index += LANE_PIXELS)
+    {
+        const _Lane HEX    = sLoad(hexValues.data() + index);
+        const _Lane OPAQUE = sOr(sSwapRedBlue(HEX), sSplat32(ALPHA_MASK));
+
+        sStore(out.data() + index, sSelect32(sIsZero32(sShiftRight32<24>(HEX)), OPAQUE, sByteSwap(HEX)));
+    }
+#endif
+
+    for (; index < COUNT; index++) out[index] = Color::FromHex(hexValues[index]);
+}
+
+} // namespace dull::util::batch
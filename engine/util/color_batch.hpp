@@ -0,0 +1,75 @@
+#pragma once
+
+#include "engine/util/color_rgba.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace dull::util::batch {
+
+static_assert(sizeof(Color) == 4 && alignof(Color) == 1, "Color must stay a tightly packed RGBA8 pixel");
+
+// ---
+// Linear light color, channels in [0, 1], alpha carried over unchanged
+// ---
+struct LinearColor final {
+    float r = 0.0F;
+    float g = 0.0F;
+    float b = 0.0F;
+    float a = 1.0F;
+};
+
+// Views a raw RGBA8 buffer as pixels, size must be a multiple of 4
+[[nodiscard]] inline std::span<Color> AsColors(std::span<uint8_t> rgba) noexcept
+{
+    return {reinterpret_cast<Color*>(rgba.data()), rgba.size() / 4};
+}
+
+[[nodiscard]] inline std::span<const Color> AsColors(std::span<const uint8_t> rgba) noexcept
+{
+    return {reinterpret_cast<const Color*>(rgba.data()), rgba.size() / 4};
+}
+
+// Name of the instruction set the kernels were compiled for
+[[nodiscard]] const char* GetColorInstructionSet() noexcept;
+
+// --- Arithmetic ---
+// Note: results match the Color operators bit for bit, the vector paths only change how many pixels run at once
+// Note: output may alias an input exactly
+// Note: every span of a call must hold the same number of elements, mismatches assert and only the common part is processed
+
+void Add     (std::span<const Color> lhs, std::span<const Color> rhs, std::span<Color> out) noexcept; // saturating
+void Subtract(std::span<const Color> lhs, std::span<const Color> rhs, std::span<Color> out) noexcept; // saturating
+void Multiply(std::span<const Color> lhs, std::span<const Color> rhs, std::span<Color> out) noexcept;
+
+// --- Alpha ---
+
+// Premultiplied source over premultiplied destination: src + dst * (255 - src.a) / 255
+void BlendOver(std::span<const Color> source, std::span<const Color> destination, std::span<Color> out) noexcept;
+
+// rgb * a / 255, alpha unchanged
+void Premultiply(std::span<const Color> colors, std::span<Color> out) noexcept;
+
+// rgb * 255 / a rounded and clamped, fully transparent pixels become transparent black
+void Unpremultiply(std::span<const Color> colors, std::span<Color> out) noexcept;
+
+// --- Interpolation ---
+
+// Color::Lerp(from, to, weights[i]) for every pixel, the weights usually come from a normalized age or distance
+void Lerp(Color from, Color to, std::span<const uint8_t> weights, std::span<Color> out) noexcept;
+
+// --- Conversions ---
+
+// Same weights as Color::Grayscaled
+void Grayscale(std::span<const Color> colors, std::span<Color> out) noexcept;
+
+// Color::ToHex / Color::FromHex over whole buffers
+void PackHex  (std::span<const Color> colors, std::span<uint32_t> out) noexcept;
+void UnpackHex(std::span<const uint32_t> hexValues, std::span<Color> out) noexcept;
+
+// sRGB transfer curve through lookup tables, 256 entries in and 4096 out
+void SrgbToLinear(std::span<const Color> colors, std::span<LinearColor> out) noexcept;
+void LinearToSrgb(std::span<const LinearColor> colors, std::span<Color> out) noexcept;
+
+} // namespace dull::util::batch
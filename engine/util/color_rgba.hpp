@@ -2,6 +2,7 @@
 
 #include <vendor/raylib.h>
 
+#include <algorithm>
 #include <cstdint>
 
 namespace dull::util {
@@ -82,35 +83,54 @@ struct Color {
         };
     }
 
+    // 0.3 / 0.59 / 0.11 luminosity in 8 bit fixed point, white stays white
     [[nodiscard]] constexpr Color Grayscaled() const noexcept
     {
-        constexpr float R_LUMINOSITY = 0.3F;
-        constexpr float G_LUMINOSITY = 0.59F;
-        constexpr float B_LUMINOSITY = 0.11F;
+        constexpr uint32_t R_LUMINOSITY = 77;
+        constexpr uint32_t G_LUMINOSITY = 151;
+        constexpr uint32_t B_LUMINOSITY = 28;
 
-        return Color::Gray(static_cast<uint8_t>(r * R_LUMINOSITY + g * G_LUMINOSITY + b * B_LUMINOSITY), a);
+        return Color::Gray(static_cast<uint8_t>((r * R_LUMINOSITY + g * G_LUMINOSITY + b * B_LUMINOSITY) >> 8), a);
+    }
+
+    // (from * (255 - weight) + to * weight) / 255 per channel, rounded once so Lerp(c, c, weight) == c, weight 255 gives to
+    [[nodiscard]] static constexpr Color Lerp(const Color& from, const Color& to, uint8_t weight) noexcept
+    {
+        const uint32_t INVERSE = 255U - weight;
+
+        const auto LERP_CHANNEL = [INVERSE, weight](uint8_t fromChannel, uint8_t toChannel) constexpr noexcept {
+            return static_cast<uint8_t>((fromChannel * INVERSE + toChannel * weight + 127U) / 255U);
+        };
+
+        return {
+            LERP_CHANNEL(from.r, to.r),
+            LERP_CHANNEL(from.g, to.g),
+            LERP_CHANNEL(from.b, to.b),
+            LERP_CHANNEL(from.a, to.a)
+        };
     }
 
 // --- Operators
 // -> Color (op) Color
+// Note: + and - saturate at 0 and 255, * scales by the other channel (x * y / 255, truncated)
 
     constexpr Color operator + (const Color& other) const noexcept
     {
         return {
-            static_cast<uint8_t>(this->r + other.r),
-            static_cast<uint8_t>(this->g + other.g),
-            static_cast<uint8_t>(this->b + other.b),
-            static_cast<uint8_t>(this->a + other.a)
+            static_cast<uint8_t>(std::min(this->r + other.r, 255)),
+            static_cast<uint8_t>(std::min(this->g + other.g, 255)),
+            static_cast<uint8_t>(std::min(this->b + other.b, 255)),
+            static_cast<uint8_t>(std::min(this->a + other.a, 255))
         };
     }
 
     constexpr Color operator - (const Color& other) const noexcept
     {
         return {
-            static_cast<uint8_t>(this->r - other.r),
-            static_cast<uint8_t>(this->g - other.g),
-            static_cast<uint8_t>(this->b - other.b),
-            static_cast<uint8_t>(this->a - other.a)
+            static_cast<uint8_t>(std::max(this->r - other.r, 0)),
+            static_cast<uint8_t>(std::max(this->g - other.g, 0)),
+            static_cast<uint8_t>(std::max(this->b - other.b, 0)),
+            static_cast<uint8_t>(std::max(this->a - other.a, 0))
         };
     }
 
@@ -52,15 +52,20 @@ struct Rect {
     }
 
 // --- Collision ---
+// Note: same rules as rl::CheckCollisionPointRec / rl::CheckCollisionRecs, without the raylib dependency
 
-    [[nodiscard]] bool CollidesWith(const Vec2f& point) const noexcept
+    [[nodiscard]] constexpr bool CollidesWith(const Vec2f& point) const noexcept
     {
-        return rl::CheckCollisionPointRec(point, *this);
+        return point.x >= this->x && point.x < this->x + this->w
+            && point.y >= this->y && point.y < this->y + this->h
+        ;
     }
 
-    [[nodiscard]] bool CollidesWith(const Rect& other) const noexcept
+    [[nodiscard]] constexpr bool CollidesWith(const Rect& other) const noexcept
     {
-        return rl::CheckCollisionRecs(*this, other);
+        return this->x < other.x + other.w && this->x + this->w > other.x
+            && this->y < other.y + other.h && this->y + this->h > other.y
+        ;
     }
 
 // --- Conversion ---
@@ -0,0 +1,467 @@
+#include "engine/util/vec2_batch.hpp"
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+// Note: define DULL_VEC2_SCALAR to force the scalar path
+#if defined(DULL_VEC2_SCALAR)
+#elif defined(__AVX2__)
+    #include <immintrin.h>
+    #define DULL_VEC2_AVX2
+    #define DULL_VEC2_LANES
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define DULL_VEC2_SSE2
+    #define DULL_VEC2_LANES
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+    #define DULL_VEC2_NEON
+    #define DULL_VEC2_LANES
+#endif
+
+namespace dull::util::batch {
+
+// --- Scalar lane ---
+
+[[nodiscard]] static inline float sAdd (float lhs, float rhs) noexcept { return lhs + rhs; }
+[[nodiscard]] static inline float sSub (float lhs, float rhs) noexcept { return lhs - rhs; }
+[[nodiscard]] static inline float sMul (float lhs, float rhs) noexcept { return lhs * rhs; }
+[[nodiscard]] static inline float sDiv (float lhs, float rhs) noexcept { return lhs / rhs; }
+[[nodiscard]] static inline float sSqrt(float value) noexcept { return std::sqrt(value); }
+
+// Value where the length is positive, zero elsewhere
+[[nodiscard]] static inline float sIfPositive(float length, float value) noexcept { return length > 0.0F ? value : 0.0F; }
+
+// --- Vector lane ---
+
+#if defined(DULL_VEC2_AVX2)
+
+using _Lane = __m256;
+static constexpr size_t LANE_WIDTH = 8;
+static constexpr const char* INSTRUCTION_SET = "AVX2";
+
+[[nodiscard]] static inline _Lane sLoad (const float* source) noexcept { return _mm256_loadu_ps(source); }
+[[nodiscard]] static inline _Lane sSplat(float value) noexcept { return _mm256_set1_ps(value); }
+static inline void sStore(float* target, _Lane value) noexcept { _mm256_storeu_ps(target, value); }
+
+[[nodiscard]] static inline _Lane sAdd (_Lane lhs, _Lane rhs) noexcept { return _mm256_add_ps(lhs, rhs); }
+[[nodiscard]] static inline _Lane sSub (_Lane lhs, _Lane rhs) noexcept { return _mm256_sub_ps(lhs, rhs); }
+[[nodiscard]] static inline _Lane sMul (_Lane lhs, _Lane rhs) noexcept { return _mm256_mul_ps(lhs, rhs); }
+[[nodiscard]] static inline _Lane sDiv (_Lane lhs, _Lane rhs) noexcept { return _mm256_div_ps(lhs, rhs); }
+[[nodiscard]] static inline _Lane sSqrt(_Lane value) noexcept { return _mm256_sqrt_ps(value); }
+
+[[nodiscard]] static inline _Lane sIfPositive(_Lane length, _Lane value) noexcept
+{
+    return _mm256_and_ps(_mm256_cmp_ps(length, _mm256_setzero_ps(), _CMP_GT_OQ), value);
+}
+
+static inline void sLoadXY(const float* source, _Lane& x, _Lane& y) noexcept
+{
+    const _Lane LOW  = _mm256_loadu_ps(source);
+    const _Lane HIGH = _mm256_loadu_ps(source + 8);
+
+    // In-lane shuffles leave 64 bit pairs out of order, fix with a cross-lane permute
+    x = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_shuffle_ps(LOW, HIGH, _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0)));
+    y = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_shuffle_ps(LOW, HIGH, _MM_SHUFFLE(3, 1, 3, 1))), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+static inline void sStoreXY(float* target, _Lane x, _Lane y) noexcept
+{
+    const _Lane LOW  = _mm256_unpacklo_ps(x, y);
+    const _Lane HIGH = _mm256_unpackhi_ps(x, y);
+
+    _mm256_storeu_ps(target    , _mm256_permute2f128_ps(LOW, HIGH, 0x20));
+    _mm256_storeu_ps(target + 8, _mm256_permute2f128_ps(LOW, HIGH, 0x31));
+}
+
+#elif defined(DULL_VEC2_SSE2)
+
+using _Lane = __m128;
+static constexpr size_t LANE_WIDTH = 4;
+static constexpr const char* INSTRUCTION_SET = "SSE2";
+
+[[nodiscard]] static inline _Lane sLoad (const float* source) noexcept { return _mm_loadu_ps(source); }
+[[nodiscard]] static inline _Lane sSplat(float value) noexcept { return _mm_set1_ps(value); }
+static inline void sStore(float* target, _Lane value) noexcept { _mm_storeu_ps(target, value); }
+
+[[nodiscard]] static inline _Lane sAdd (_Lane lhs, _Lane rhs) noexcept { return _mm_add_ps(lhs, rhs); }
+[[nodiscard]] static inline _Lane sSub (_Lane lhs, _Lane rhs) noexcept { return _mm_sub_ps(lhs, rhs); }
+[[nodiscard]] static inline _Lane sMul (_Lane lhs, _Lane rhs) noexcept { return _mm_mul_ps(lhs, rhs); }
+[[nodiscard]] static inline _Lane sDiv (_Lane lhs, _Lane rhs) noexcept { return _mm_div_ps(lhs, rhs); }
+[[nodiscard]] static inline _Lane sSqrt(_Lane value) noexcept { return _mm_sqrt_ps(value); }
+
+[[nodiscard]] static inline _Lane sIfPositive(_Lane length, _Lane value) noexcept
+{
+    return _mm_and_ps(_mm_cmpgt_ps(length, _mm_setzero_ps()), value);
+}
+
+static inline void sLoadXY(const float* source, _Lane& x, _Lane& y) noexcept
+{
+    const _Lane LOW  = _mm_loadu_ps(source);
+    const _Lane HIGH = _mm_loadu_ps(source + 4);
+
+    x = _mm_shuffle_ps(LOW, HIGH, _MM_SHUFFLE(2, 0, 2, 0));
+    y = _mm_shuffle_ps(LOW, HIGH, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+static inline void sStoreXY(float* target, _Lane x, _Lane y) noexcept
+{
+    _mm_storeu_ps(target    , _mm_unpacklo_ps(x, y));
+    _mm_storeu_ps(target + 4, _mm_unpackhi_ps(x, y));
+}
+
+#elif defined(DULL_VEC2_NEON)
+
+using _Lane = float32x4_t;
+static constexpr size_t LANE_WIDTH = 4;
+static constexpr const char* INSTRUCTION_SET = "NEON";
+
+[[nodiscard]] static inline _Lane sLoad (const float* source) noexcept { return vld1q_f32(source); }
+[[nodiscard]] static inline _Lane sSplat(float value) noexcept { return vdupq_n_f32(value); }
+static inline void sStore(float* target, _Lane value) noexcept { vst1q_f32(target, value); }
+
+[[nodiscard]] static inline _Lane sAdd (_Lane lhs, _Lane rhs) noexcept { return vaddq_f32(lhs, rhs); }
+[[nodiscard]] static inline _Lane sSub (_Lane lhs, _Lane rhs) noexcept { return vsubq_f32(lhs, rhs); }
+[[nodiscard]] static inline _Lane sMul (_Lane lhs, _Lane rhs) noexcept { return vmulq_f32(lhs, rhs); }
+[[nodiscard]] static inline _Lane sDiv (_Lane lhs, _Lane rhs) noexcept { return vdivq_f32(lhs, rhs); }
+[[nodiscard]] static inline _Lane sSqrt(_Lane value) noexcept { return vsqrtq_f32(value); }
+
+[[nodiscard]] static inline _Lane sIfPositive(_Lane length, _Lane value) noexcept
+{
+    return vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(length, vdupq_n_f32(0.0F)), vreinterpretq_u32_f32(value)));
+}
+
+static inline void sLoadXY(const float* source, _Lane& x, _Lane& y) noexcept
+{
+    const float32x4x2_t PAIRS = vld2q_f32(source);
+    x = PAIRS.val[0];
+    y = PAIRS.val[1];
+}
+
+static inline void sStoreXY(float* target, _Lane x, _Lane y) noexcept { vst2q_f32(target, float32x4x2_t {{x, y}}); }
+
+#else
+
+static constexpr size_t LANE_WIDTH = 1;
+static constexpr const char* INSTRUCTION_SET = "Scalar";
+
+#endif
+
+[[nodiscard]] const char* GetVec2InstructionSet() noexcept { return INSTRUCTION_SET; }
+
+// --- Layout adaptors ---
+
+struct _AosReader {
+    const float* data;
+
+    void Load(size_t index, float& x, float& y) const noexcept { x = this->data[index * 2]; y = this->data[index * 2 + 1]; }
+#if defined(DULL_VEC2_LANES)
+    void Load(size_t index, _Lane& x, _Lane& y) const noexcept { sLoadXY(this->data + index * 2, x, y); }
+#endif
+};
+
+struct _SoaReader {
+    const float* x;
+    const float* y;
+
+    void Load(size_t index, float& x, float& y) const noexcept { x = this->x[index]; y = this->y[index]; }
+#if defined(DULL_VEC2_LANES)
+    void Load(size_t index, _Lane& x, _Lane& y) const noexcept { x = sLoad(this->x + index); y = sLoad(this->y + index); }
+#endif
+};
+
+struct _AosWriter {
+    float* data;
+
+    void Store(size_t index, float x, float y) const noexcept { this->data[index * 2] = x; this->data[index * 2 + 1] = y; }
+#if defined(DULL_VEC2_LANES)
+    void Store(size_t index, _Lane x, _Lane y) const noexcept { sStoreXY(this->data + index * 2, x, y); }
+#endif
+};
+
+struct _SoaWriter {
+    float* x;
+    float* y;
+
+    void Store(size_t index, float x, float y) const noexcept { this->x[index] = x; this->y[index] = y; }
+#if defined(DULL_VEC2_LANES)
+    void Store(size_t index, _Lane x, _Lane y) const noexcept { sStore(this->x + index, x); sStore(this->y + index, y); }
+#endif
+};
+
+struct _FloatWriter {
+    float* data;
+
+    void Store(size_t index, float value) const noexcept { this->data[index] = value; }
+#if defined(DULL_VEC2_LANES)
+    void Store(size_t index, _Lane value) const noexcept { sStore(this->data + index, value); }
+#endif
+};
+
+// --- Kernel drivers ---
+// Note: ops are generic lambdas, instantiated once for the vector lane and once for the scalar tail
+
+// Element wise over flat float arrays, works for both layouts
+template <typename OpT>
+static inline void sMapFlat(const float* lhs, const float* rhs, float* out, size_t count, OpT op) noexcept
+{
+    size_t index = 0;
+
+#if defined(DULL_VEC2_LANES)
+    for (; index + LANE_WIDTH <= count; index += LANE_WIDTH)
+        sStore(out + index, op(sLoad(lhs + index), sLoad(rhs + index)));
+#endif
+
+    for (; index < count; index++) out[index] = op(lhs[index], rhs[index]);
+}
+
+// Vector to vector, e.g. normalize
+template <typename ReaderT, typename WriterT, typename OpT>
+static inline void sMapVectors(ReaderT source, WriterT target, size_t count, OpT op) noexcept
+{
+    size_t index = 0;
+
+#if defined(DULL_VEC2_LANES)
+    for (; index + LANE_WIDTH <= count; index += LANE_WIDTH)
+    {
+        _Lane x, y;
+        source.Load(index, x, y);
+        op(x, y);
+        target.Store(index, x, y);
+    }
+#endif
+
+    for (; index < count; index++)
+    {
+        float x, y;
+        source.Load(index, x, y);
+        op(x, y);
+        target.Store(index, x, y);
+    }
+}
+
+// Two vectors to scalar, e.g. dot
+template <typename ReaderT, typename OpT>
+static inline void sReducePairs(ReaderT lhs, ReaderT rhs, _FloatWriter target, size_t count, OpT op) noexcept
+{
+    size_t index = 0;
+
+#if defined(DULL_VEC2_LANES)
+    for (; index + LANE_WIDTH <= count; index += LANE_WIDTH)
+    {
+        _Lane lhsX, lhsY, rhsX, rhsY;
+        lhs.Load(index, lhsX, lhsY);
+        rhs.Load(index, rhsX, rhsY);
+        target.Store(index, op(lhsX, lhsY, rhsX, rhsY));
+    }
+#endif
+
+    for (; index < count; index++)
+    {
+        float lhsX, lhsY, rhsX, rhsY;
+        lhs.Load(index, lhsX, lhsY);
+        rhs.Load(index, rhsX, rhsY);
+        target.Store(index, op(lhsX, lhsY, rhsX, rhsY));
+    }
+}
+
+// --- Operations ---
+
+static constexpr auto ADD_OP = [](auto lhs, auto rhs) noexcept { return sAdd(lhs, rhs); };
+static constexpr auto SUB_OP = [](auto lhs, auto rhs) noexcept { return sSub(lhs, rhs); };
+
+static constexpr auto NORMALIZE_OP = [](auto& x, auto& y) noexcept
+{
+    const auto LENGTH = sSqrt(sAdd(sMul(x, x), sMul(y, y)));
+
+    x = sIfPositive(LENGTH, sDiv(x, LENGTH));
+    y = sIfPositive(LENGTH, sDiv(y, LENGTH));
+};
+
+static constexpr auto DOT_OP = [](auto lhsX, auto lhsY, auto rhsX, auto rhsY) noexcept
+{
+    return sAdd(sMul(lhsX, rhsX), sMul(lhsY, rhsY));
+};
+
+static constexpr auto DISTANCE_OP = [](auto lhsX, auto lhsY, auto rhsX, auto rhsY) noexcept
+{
+    const auto DELTA_X = sSub(lhsX, rhsX);
+    const auto DELTA_Y = sSub(lhsY, rhsY);
+
+    return sSqrt(sAdd(sMul(DELTA_X, DELTA_X), sMul(DELTA_Y, DELTA_Y)));
+};
+
+[[nodiscard]] static inline const float* sFloats(std::span<const Vec2f> vectors) noexcept { return reinterpret_cast<const float*>(vectors.data()); }
+[[nodiscard]] static inline float* sFloats(std::span<Vec2f> vectors) noexcept { return reinterpret_cast<float*>(vectors.data()); }
+
+// Splats a scalar into whichever lane type the op is instantiated for
+template <typename LaneT>
+[[nodiscard]] static inline LaneT sBroadcast(float value) noexcept
+{
+#if defined(DULL_VEC2_LANES)
+    if constexpr (!std::is_same_v<LaneT, float>) return sSplat(value);
+    else
+#endif
+    return value;
+}
+
+template <typename OpT>
+static inline void sMapScalar(const float* lhs, const float* rhs, float scalar, float* out, size_t count, OpT op) noexcept
+{
+    sMapFlat(lhs, rhs, out, count, [scalar, op](auto lhsValue, auto rhsValue) noexcept {
+        return op(lhsValue, rhsValue, sBroadcast<decltype(lhsValue)>(scalar));
+    });
+}
+
+static constexpr auto ADD_SCALED_OP = [](auto lhs, auto rhs, auto scalar) noexcept { return sAdd(lhs, sMul(rhs, scalar)); };
+static constexpr auto LERP_OP       = [](auto from, auto to, auto alpha) noexcept { return sAdd(from, sMul(sSub(to, from), alpha)); };
+static constexpr auto SCALE_OP      = [](auto value, auto, auto scalar) noexcept { return sMul(value, scalar); };
+static constexpr auto OFFSET_OP     = [](auto value, auto, auto scalar) noexcept { return sAdd(value, scalar); };
+
+// --- Element counts ---
+
+// Smallest element count of the spans, mismatched sizes are a caller bug but never read past a span
+template <typename... SpanTs>
+[[nodiscard]] static inline size_t sCount(const SpanTs&... spans) noexcept
+{
+    const size_t COUNT = std::min({spans.size()...});
+    zutil::Assert(((spans.size() == COUNT) && ...), "Batch spans must hold the same number of elements");
+    return COUNT;
+}
+
+// --- Array of structures ---
+
+void Add(std::span<const Vec2f> lhs, std::span<const Vec2f> rhs, std::span<Vec2f> out) noexcept
+{
+    sMapFlat(sFloats(lhs), sFloats(rhs), sFloats(out), sCount(lhs, rhs, out) * 2, ADD_OP);
+}
+
+void Subtract(std::span<const Vec2f> lhs, std::span<const Vec2f> rhs, std::span<Vec2f> out) noexcept
+{
+    sMapFlat(sFloats(lhs), sFloats(rhs), sFloats(out), sCount(lhs, rhs, out) * 2, SUB_OP);
+}
+
+void Scale(std::span<const Vec2f> vectors, float scalar, std::span<Vec2f> out) noexcept
+{
+    sMapScalar(sFloats(vectors), sFloats(vectors), scalar, sFloats(out), sCount(vectors, out) * 2, SCALE_OP);
+}
+
+void Translate(std::span<const Vec2f> vectors, const Vec2f& offset, std::span<Vec2f> out) noexcept
+{
+    sMapVectors(_AosReader {sFloats(vectors)}, _AosWriter {sFloats(out)}, sCount(vectors, out), [&offset](auto& x, auto& y) noexcept {
+        x = sAdd(x, sBroadcast<std::remove_reference_t<decltype(x)>>(offset.x));
+        y = sAdd(y, sBroadcast<std::remove_reference_t<decltype(y)>>(offset.y));
+    });
+}
+
+void AddScaled(std::span<const Vec2f> lhs, std::span<const Vec2f> rhs, float scalar, std::span<Vec2f> out) noexcept
+{
+    sMapScalar(sFloats(lhs), sFloats(rhs), scalar, sFloats(out), sCount(lhs, rhs, out) * 2, ADD_SCALED_OP);
+}
+
+void Lerp(std::span<const Vec2f> from, std::span<const Vec2f> to, float alpha, std::span<Vec2f> out) noexcept
+{
+    sMapScalar(sFloats(from), sFloats(to), alpha, sFloats(out), sCount(from, to, out) * 2, LERP_OP);
+}
+
+void Normalize(std::span<const Vec2f> vectors, std::span<Vec2f> out) noexcept
+{
+    sMapVectors(_AosReader {sFloats(vectors)}, _AosWriter {sFloats(out)}, sCount(vectors, out), NORMALIZE_OP);
+}
+
+void Dot(std::span<const Vec2f> lhs, std::span<const Vec2f> rhs, std::span<float> out) noexcept
+{
+    sReducePairs(_AosReader {sFloats(lhs)}, _AosReader {sFloats(rhs)}, _FloatWriter {out.data()}, sCount(lhs, rhs, out), DOT_OP);
+}
+
+void Length(std::span<const Vec2f> vectors, std::span<float> out) noexcept
+{
+    const size_t COUNT = sCount(vectors, out);
+
+    Dot(vectors.first(COUNT), vectors.first(COUNT), out.first(COUNT));
+    sMapFlat(out.data(), out.data(), out.data(), COUNT, [](auto value, auto) noexcept { return sSqrt(value); });
+}
+
+void Distance(std::span<const Vec2f> lhs, std::span<const Vec2f> rhs, std::span<float> out) noexcept
+{
+    sReducePairs(_AosReader {sFloats(lhs)}, _AosReader {sFloats(rhs)}, _FloatWriter {out.data()}, sCount(lhs, rhs, out), DISTANCE_OP);
+}
+
+// --- Structure of arrays ---
+
+void Add(ConstVec2Soa lhs, ConstVec2Soa rhs, Vec2Soa out) noexcept
+{
+    const size_t COUNT = sCount(lhs.x, lhs.y, rhs.x, rhs.y, out.x, out.y);
+
+    sMapFlat(lhs.x.data(), rhs.x.data(), out.x.data(), COUNT, ADD_OP);
+    sMapFlat(lhs.y.data(), rhs.y.data(), out.y.data(), COUNT, ADD_OP);
+}
+
+void Subtract(ConstVec2Soa lhs, ConstVec2Soa rhs, Vec2Soa out) noexcept
+{
+    const size_t COUNT = sCount(lhs.x, lhs.y, rhs.x, rhs.y, out.x, out.y);
+
+    sMapFlat(lhs.x.data(), rhs.x.data(), out.x.data(), COUNT, SUB_OP);
+    sMapFlat(lhs.y.data(), rhs.y.data(), out.y.data(), COUNT, SUB_OP);
+}
+
+void Scale(ConstVec2Soa vectors, float scalar, Vec2Soa out) noexcept
+{
+    const size_t COUNT = sCount(vectors.x, vectors.y, out.x, out.y);
+
+    sMapScalar(vectors.x.data(), vectors.x.data(), scalar, out.x.data(), COUNT, SCALE_OP);
+    sMapScalar(vectors.y.data(), vectors.y.data(), scalar, out.y.data(), COUNT, SCALE_OP);
+}
+
+void Translate(ConstVec2Soa vectors, const Vec2f& offset, Vec2Soa out) noexcept
+{
+    const size_t COUNT = sCount(vectors.x, vectors.y, out.x, out.y);
+
+    sMapScalar(vectors.x.data(), vectors.x.data(), offset.x, out.x.data(), COUNT, OFFSET_OP);
+    sMapScalar(vectors.y.data(), vectors.y.data(), offset.y, out.y.data(), COUNT, OFFSET_OP);
+}
+
+void AddScaled(ConstVec2Soa lhs, ConstVec2Soa rhs, float scalar, Vec2Soa out) noexcept
+{
+    const size_t COUNT = sCount(lhs.x, lhs.y, rhs.x, rhs.y, out.x, out.y);
+
+    sMapScalar(lhs.x.data(), rhs.x.data(), scalar, out.x.data(), COUNT, ADD_SCALED_OP);
+    sMapScalar(lhs.y.data(), rhs.y.data(), scalar, out.y.data(), COUNT, ADD_SCALED_OP);
+}
+
+void Lerp(ConstVec2Soa from, ConstVec2Soa to, float alpha, Vec2Soa out) noexcept
+{
+    const size_t COUNT = sCount(from.x, from.y, to.x, to.y, out.x, out.y);
+
+    sMapScalar(from.x.data(), to.x.data(), alpha, out.x.data(), COUNT, LERP_OP);
+    sMapScalar(from.y.data(), to.y.data(), alpha, out.y.data(), COUNT, LERP_OP);
+}
+
+void Normalize(ConstVec2Soa vectors, Vec2Soa out) noexcept
+{
+    sMapVectors(_SoaReader {vectors.x.data(), vectors.y.data()}, _SoaWriter {out.x.data(), out.y.data()}, sCount(vectors.x, vectors.y, out.x, out.y), NORMALIZE_OP);
+}
+
+void Dot(ConstVec2Soa lhs, ConstVec2Soa rhs, std::span<float> out) noexcept
+{
+    sReducePairs(_SoaReader {lhs.x.data(), lhs.y.data()}, _SoaReader {rhs.x.data(), rhs.y.data()}, _FloatWriter {out.data()}, sCount(lhs.x, lhs.y, rhs.x, rhs.y, out), DOT_OP);
+}
+
+void Length(ConstVec2Soa vectors, std::span<float> out) noexcept
+{
+    const size_t COUNT = sCount(vectors.x, vectors.y, out);
+    const ConstVec2Soa VECTORS {vectors.x.first(COUNT), vectors.y.first(COUNT)};
+
+    Dot(VECTORS, VECTORS, out.first(COUNT));
+    sMapFlat(out.data(), out.data(), out.data(), COUNT, [](auto value, auto) noexcept { return sSqrt(value); });
+}
+
+void Distance(ConstVec2Soa lhs, ConstVec2Soa rhs, std::span<float> out) noexcept
+{
+    sReducePairs(_SoaReader {lhs.x.data(), lhs.y.data()}, _SoaReader {rhs.x.data(), rhs.y.data()}, _FloatWriter {out.data()}, sCount(lhs.x, lhs.y, rhs.x, rhs.y, out), DISTANCE_OP);
+}
+
+} // namespace dull::util::batch
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "engine/util/vec2.hpp"
+
+#include <cstddef>
+#include <span>
+
+namespace dull::util::batch {
+
+// ---
+// Structure of arrays view over 2D vectors
+// Note: x and y must hold the same number of elements, size is the number in x
+// ---
+struct Vec2Soa final {
+    std::span<float> x;
+    std::span<float> y;
+
+    [[nodiscard]] size_t size() const noexcept { return this->x.size(); }
+};
+
+struct ConstVec2Soa final {
+    std::span<const float> x;
+    std::span<const float> y;
+
+    constexpr ConstVec2Soa(std::span<const float> x, std::span<const float> y) noexcept : x {x}, y {y} {}
+    constexpr ConstVec2Soa(const Vec2Soa& soa) noexcept : x {soa.x}, y {soa.y} {}
+
+    [[nodiscard]] size_t size() const noexcept { return this->x.size(); }
+};
+
+// Name of the instruction set the kernels were compiled for
+[[nodiscard]] const char* GetVec2InstructionSet() noexcept;
+
+// --- Array of structures ---
+// Note: output may alias an input exactly
+// Note: every span of a call must hold the same number of elements, mismatches assert and only the common part is processed
+
+void Add      (std::span<const Vec2f> lhs, std::span<const Vec2f> rhs, std::span<Vec2f> out) noexcept;
+void Subtract (std::span<const Vec2f> lhs, std::span<const Vec2f> rhs, std::span<Vec2f> out) noexcept;
+void Scale    (std::span<const Vec2f> vectors, float scalar, std::span<Vec2f> out) noexcept;
+void Translate(std::span<const Vec2f> vectors, const Vec2f& offset, std::span<Vec2f> out) noexcept;
+void AddScaled(std::span<const Vec2f> lhs, std::span<const Vec2f> rhs, float scalar, std::span<Vec2f> out) noexcept;
+void Lerp     (std::span<const Vec2f> from, std::span<const Vec2f> to, float alpha, std::span<Vec2f> out) noexcept;
+void Normalize(std::span<const Vec2f> vectors, std::span<Vec2f> out) noexcept;
+
+void Dot     (std::span<const Vec2f> lhs, std::span<const Vec2f> rhs, std::span<float> out) noexcept;
+void Length  (std::span<const Vec2f> vectors, std::span<float> out) noexcept;
+void Distance(std::span<const Vec2f> lhs, std::span<const Vec2f> rhs, std::span<float> out) noexcept;
+
+// --- Structure of arrays ---
+
+void Add      (ConstVec2Soa lhs, ConstVec2Soa rhs, Vec2Soa out) noexcept;
+void Subtract (ConstVec2Soa lhs, ConstVec2Soa rhs, Vec2Soa out) noexcept;
+void Scale    (ConstVec2Soa vectors, float scalar, Vec2Soa out) noexcept;
+void Translate(ConstVec2Soa vectors, const Vec2f& offset, Vec2Soa out) noexcept;
+void AddScaled(ConstVec2Soa lhs, ConstVec2Soa rhs, float scalar, Vec2Soa out) noexcept;
+void Lerp     (ConstVec2Soa from, ConstVec2Soa to, float alpha, Vec2Soa out) noexcept;
+void Normalize(ConstVec2Soa vectors, Vec2Soa out) noexcept;
+
+void Dot     (ConstVec2Soa lhs, ConstVec2Soa rhs, std::span<float> out) noexcept;
+void Length  (ConstVec2Soa vectors, std::span<float> out) noexcept;
+void Distance(ConstVec2Soa lhs, ConstVec2Soa rhs, std::span<float> out) noexcept;
+
+} // namespace dull::util::batch
@@ -0,0 +1,71 @@
+#include "tests/test.hpp"
+
+#include <engine/config.hpp>
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <string_view>
+#include <vector>
+
+using namespace dull;
+
+// CTest reports a run whose cases were all skipped as skipped (SKIP_RETURN_CODE)
+static constexpr int SKIPPED_EXIT_CODE = 77;
+
+// ---
+// dull_tests [--filter <text>] [--list]
+// Runs every case (or the cases whose name contains the filter) in name order
+// Note: exits with 1 when a case failed, with SKIPPED_EXIT_CODE when every case that ran was skipped
+// ---
+int main(int argc, char** argv)
+{
+    zutil::Logger logger {{config::DULL_TAG, {"[TEST]", zutil::ANSI::EX_Black}}};
+
+    const std::vector<std::string_view> ARGUMENTS {argv + 1, argv + argc};
+    std::string_view filter;
+    bool isListing = false;
+
+    for (size_t index = 0; index < ARGUMENTS.size(); index++)
+    {
+        if      (ARGUMENTS[index] == "--list") isListing = true;
+        else if (ARGUMENTS[index] == "--filter" && index + 1 < ARGUMENTS.size()) filter = ARGUMENTS[++index];
+        else
+        {
+            logger.Log(zutil::INFO, "Usage: dull_tests [--filter <text>] [--list]");
+            return 2;
+        }
+    }
+
+    std::vector<test::_Case> cases = test::_GetCases();
+    std::ranges::sort(cases, {}, &test::_Case::name);
+    std::erase_if(cases, [filter](const test::_Case& testCase) { return testCase.name.find(filter) == std::string_view::npos; });
+
+    if (isListing)
+    {
+        for (const test::_Case& testCase : cases) logger.Log(zutil::INFO, {"{}", testCase.name});
+        return 0;
+    }
+
+    test::Test test;
+    uint32_t failedCount  = 0;
+    uint32_t skippedCount = 0;
+
+    for (const test::_Case& testCase : cases)
+    {
+        test._Begin(testCase.name);
+        testCase.fn(test);
+
+        if      (test.GetFailureCount() != 0) failedCount++;
+        else if (test.IsSkipped())            skippedCount++;
+
+        logger.Log(zutil::INFO, {"{} {}", test.GetFailureCount() != 0 ? "FAIL" : test.IsSkipped() ? "SKIP" : "PASS", testCase.name});
+    }
+
+    logger.Log(zutil::INFO, {"{} cases, {} failed, {} skipped", cases.size(), failedCount, skippedCount});
+
+    if (failedCount != 0) return 1;
+    return !cases.empty() && skippedCount == cases.size() ? SKIPPED_EXIT_CODE : 0;
+}
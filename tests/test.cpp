@@ -0,0 +1,46 @@
+#include "tests/test.hpp"
+
+#include <engine/config.hpp>
+
+#include <format>
+
+namespace dull::test {
+
+Test::Test()
+: zutil::Logger {
+    {
+        config::DULL_TAG,
+        {"[TEST]", zutil::ANSI::EX_Black}
+    }
+}
+{}
+
+void Test::_Begin(std::string_view caseName) noexcept
+{
+    this->_caseName     = caseName;
+    this->_failureCount = 0;
+    this->_isSkipped    = false;
+}
+
+bool Test::Check(bool isPassed, std::string_view expression, std::source_location location)
+{
+    if (isPassed) return true;
+
+    this->_failureCount++;
+    this->Log(zutil::INFO, {"{}: {}:{} failed '{}'", this->_caseName, location.file_name(), location.line(), expression});
+    return false;
+}
+
+void Test::Skip(std::string_view reason)
+{
+    this->_isSkipped = true;
+    this->Log(zutil::INFO, {"{}: skipped, {}", this->_caseName, reason});
+}
+
+[[nodiscard]] std::vector<_Case>& _GetCases()
+{
+    static std::vector<_Case> sCases;
+    return sCases;
+}
+
+} // namespace dull::test
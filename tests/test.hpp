@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <source_location>
+#include <string_view>
+#include <vector>
+
+namespace dull::test {
+
+// ---
+// State of the running test case, checks report their failures through it
+// Note: a failed DULL_CHECK keeps the case running, a failed DULL_REQUIRE returns from it
+// ---
+struct Test final : public zutil::Logger {
+private:
+    std::string_view _caseName;
+    uint32_t _failureCount = 0;
+    bool     _isSkipped    = false;
+
+public:
+    Test(Test&&)                 = delete;
+    Test(const Test&)            = delete;
+    Test& operator=(Test&&)      = delete;
+    Test& operator=(const Test&) = delete;
+
+    Test();
+
+    // Starts a case, failures and skipping are per case
+    void _Begin(std::string_view caseName) noexcept;
+
+    // Logs the expression when it failed, returns isPassed
+    bool Check(bool isPassed, std::string_view expression, std::source_location location = std::source_location::current());
+
+    // Marks the case as not runnable in this build (a feature compiled out), its checks still count
+    void Skip(std::string_view reason);
+
+    [[nodiscard]] uint32_t GetFailureCount() const noexcept { return this->_failureCount; }
+    [[nodiscard]] bool IsSkipped() const noexcept { return this->_isSkipped; }
+};
+
+[[nodiscard]] inline bool IsNear(double lhs, double rhs, double tolerance = 1e-9) noexcept
+{
+    return std::abs(lhs - rhs) <= tolerance;
+}
+
+// --- Cases ---
+
+using CaseFn = void (*)(Test& test);
+
+struct _Case {
+    std::string_view name;
+    CaseFn fn;
+};
+
+[[nodiscard]] std::vector<_Case>& _GetCases();
+
+struct _CaseRegistrar {
+    _CaseRegistrar(std::string_view name, CaseFn fn) { _GetCases().push_back({name, fn}); }
+};
+
+} // namespace dull::test
+
+/// MACROS:
+
+// Defines a case named suite/name taking Test& test, CTest runs every suite of tests/test_<suite>.cpp as one test
+#define DULL_TEST_CASE(suite, name)                                                                                  \
+    static void sTestCase_##suite##_##name(::dull::test::Test& test);                                                \
+    static const ::dull::test::_CaseRegistrar sTestRegistrar_##suite##_##name {#suite "/" #name, &sTestCase_##suite##_##name}; \
+    static void sTestCase_##suite##_##name(::dull::test::Test& test)
+
+#define DULL_CHECK(expression) (void)test.Check(static_cast<bool>(expression), #expression)
+
+#define DULL_REQUIRE(expression) if (!test.Check(static_cast<bool>(expression), #expression)) return
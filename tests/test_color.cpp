@@ -0,0 +1,196 @@
+#include "tests/test.hpp"
+
+#include <engine/util/color_batch.hpp>
+#include <engine/util/color_rgba.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace dull;
+
+// Odd and longer than any vector lane, so every kernel runs both its lanes and its scalar tail
+static constexpr size_t PIXEL_COUNT = 259;
+
+// Random pixels with the extremes mixed in, seeded so a failure reproduces
+[[nodiscard]] static std::vector<util::Color> sMakePixels(uint32_t seed)
+{
+    std::mt19937 random {seed};
+    std::uniform_int_distribution<uint32_t> channel {0, 255};
+
+    std::vector<util::Color> pixels;
+
+    for (size_t index = 0; index < PIXEL_COUNT; index++)
+    {
+        pixels.push_back({
+            static_cast<uint8_t>(channel(random)), static_cast<uint8_t>(channel(random)),
+            static_cast<uint8_t>(channel(random)), static_cast<uint8_t>(channel(random))
+        });
+    }
+
+    pixels[0] = {0, 0, 0, 0};
+    pixels[1] = util::Color::White();
+    pixels[2] = {255, 0, 255, 0};
+    pixels[3] = {1, 254, 128, 1};
+
+    return pixels;
+}
+
+// Runs a kernel over two pixel buffers and checks every output against the scalar reference
+template <typename KernelT, typename ReferenceT>
+static void sCheckBinary(test::Test& test, KernelT kernel, ReferenceT reference)
+{
+    const std::vector<util::Color> LHS = sMakePixels(1);
+    const std::vector<util::Color> RHS = sMakePixels(2);
+    std::vector<util::Color> out(PIXEL_COUNT);
+
+    kernel(LHS, RHS, out);
+
+    for (size_t index = 0; index < PIXEL_COUNT; index++) DULL_REQUIRE(out[index] == reference(LHS[index], RHS[index]));
+}
+
+template <typename KernelT, typename ReferenceT>
+static void sCheckUnary(test::Test& test, KernelT kernel, ReferenceT reference)
+{
+    const std::vector<util::Color> COLORS = sMakePixels(3);
+    std::vector<util::Color> out(PIXEL_COUNT);
+
+    kernel(COLORS, out);
+
+    for (size_t index = 0; index < PIXEL_COUNT; index++) DULL_REQUIRE(out[index] == reference(COLORS[index]));
+}
+
+DULL_TEST_CASE(color, lerp_keeps_equal_endpoints)
+{
+    for (uint32_t value = 0; value < 256; value++)
+    {
+        const uint8_t CHANNEL = static_cast<uint8_t>(value);
+        const util::Color COLOR {CHANNEL, CHANNEL, CHANNEL, CHANNEL};
+
+        for (uint32_t weight = 0; weight < 256; weight++)
+        {
+            const util::Color LERPED = util::Color::Lerp(COLOR, COLOR, static_cast<uint8_t>(weight));
+            DULL_REQUIRE(LERPED.r == CHANNEL && LERPED.g == CHANNEL && LERPED.b == CHANNEL && LERPED.a == CHANNEL);
+        }
+    }
+
+    const util::Color FROM {10, 20, 30, 40};
+    const util::Color TO   {200, 100, 50, 250};
+
+    DULL_CHECK(util::Color::Lerp(FROM, TO, 0)   == FROM);
+    DULL_CHECK(util::Color::Lerp(FROM, TO, 255) == TO);
+}
+
+DULL_TEST_CASE(color, batch_lerp_matches_scalar)
+{
+    // Every weight, with an odd count so the vector lanes and the scalar tail both run
+    constexpr size_t COUNT = 256 + 3;
+
+    std::array<uint8_t, COUNT> weights {};
+    for (size_t index = 0; index < COUNT; index++) weights[index] = static_cast<uint8_t>(index);
+
+    std::array<util::Color, COUNT> colors {};
+
+    for (uint32_t from = 0; from < 256; from += 5)
+    {
+        for (uint32_t to = 0; to < 256; to += 3)
+        {
+            const util::Color FROM {static_cast<uint8_t>(from), static_cast<uint8_t>(to), static_cast<uint8_t>(255 - from), static_cast<uint8_t>(from ^ to)};
+            const util::Color TO   {static_cast<uint8_t>(to), static_cast<uint8_t>(from), static_cast<uint8_t>(255 - to), static_cast<uint8_t>(from)};
+
+            util::batch::Lerp(FROM, TO, weights, colors);
+
+            for (size_t index = 0; index < COUNT; index++) DULL_REQUIRE(colors[index] == util::Color::Lerp(FROM, TO, weights[index]));
+        }
+    }
+}
+
+DULL_TEST_CASE(color, batch_arithmetic_matches_scalar)
+{
+    sCheckBinary(test, util::batch::Add,      [](util::Color lhs, util::Color rhs) { return lhs + rhs; });
+    sCheckBinary(test, util::batch::Subtract, [](util::Color lhs, util::Color rhs) { return lhs - rhs; });
+    sCheckBinary(test, util::batch::Multiply, [](util::Color lhs, util::Color rhs) { return lhs * rhs; });
+
+    sCheckBinary(test, util::batch::BlendOver, [](util::Color source, util::Color destination) {
+        const uint8_t INVERSE = 255 - source.a;
+        return source + destination * util::Color {INVERSE, INVERSE, INVERSE, INVERSE};
+    });
+}
+
+DULL_TEST_CASE(color, batch_alpha_matches_scalar)
+{
+    sCheckUnary(test, util::batch::Premultiply, [](util::Color color) {
+        const util::Color SCALED = color * util::Color {color.a, color.a, color.a, color.a};
+        return util::Color {SCALED.r, SCALED.g, SCALED.b, color.a};
+    });
+
+    sCheckUnary(test, util::batch::Grayscale, [](util::Color color) { return color.Grayscaled(); });
+
+    // Every channel against every alpha
+    std::vector<util::Color> colors;
+    for (uint32_t alpha = 0; alpha < 256; alpha++)
+        for (uint32_t value = 0; value < 256; value++) colors.push_back({static_cast<uint8_t>(value), 0, 255, static_cast<uint8_t>(alpha)});
+
+    std::vector<util::Color> out(colors.size());
+    util::batch::Unpremultiply(colors, out);
+
+    for (size_t index = 0; index < colors.size(); index++)
+    {
+        const util::Color COLOR = colors[index];
+        const auto CHANNEL = [&COLOR](uint8_t value) {
+            if (COLOR.a == 0) return uint8_t {0};
+            return static_cast<uint8_t>(std::min(std::floor(value * 255.0 / COLOR.a + 0.5), 255.0));
+        };
+
+        DULL_REQUIRE(out[index] == util::Color(CHANNEL(COLOR.r), CHANNEL(COLOR.g), CHANNEL(COLOR.b), COLOR.a));
+    }
+}
+
+DULL_TEST_CASE(color, batch_hex_matches_scalar)
+{
+    const std::vector<util::Color> COLORS = sMakePixels(4);
+    std::vector<uint32_t> hexValues(PIXEL_COUNT);
+
+    util::batch::PackHex(COLORS, hexValues);
+    for (size_t index = 0; index < PIXEL_COUNT; index++) DULL_REQUIRE(hexValues[index] == COLORS[index].ToHex());
+
+    // FromHex reads small values as opaque 0xRRGGBB, so half the inputs stay below 0x1000000
+    for (size_t index = 0; index < PIXEL_COUNT; index += 2) hexValues[index] &= 0xFFFFFF;
+
+    std::vector<util::Color> out(PIXEL_COUNT);
+    util::batch::UnpackHex(hexValues, out);
+
+    for (size_t index = 0; index < PIXEL_COUNT; index++) DULL_REQUIRE(out[index] == util::Color::FromHex(hexValues[index]));
+}
+
+DULL_TEST_CASE(color, batch_srgb_matches_curve)
+{
+    std::vector<util::Color> colors;
+    for (uint32_t value = 0; value < 256; value++)
+        colors.push_back({static_cast<uint8_t>(value), static_cast<uint8_t>(255 - value), static_cast<uint8_t>(value / 2), static_cast<uint8_t>(value)});
+
+    std::vector<util::batch::LinearColor> linear(colors.size());
+    util::batch::SrgbToLinear(colors, linear);
+
+    const auto TO_LINEAR = [](uint8_t value) {
+        const double SRGB = value / 255.0;
+        return static_cast<float>(SRGB <= 0.04045 ? SRGB / 12.92 : std::pow((SRGB + 0.055) / 1.055, 2.4));
+    };
+
+    for (size_t index = 0; index < colors.size(); index++)
+    {
+        DULL_REQUIRE(linear[index].r == TO_LINEAR(colors[index].r));
+        DULL_REQUIRE(linear[index].g == TO_LINEAR(colors[index].g));
+        DULL_REQUIRE(linear[index].b == TO_LINEAR(colors[index].b));
+        DULL_REQUIRE(linear[index].a == colors[index].a / 255.0F);
+    }
+
+    // The 4096 entry table is finer than any 8 bit sRGB step, so the round trip is exact
+    std::vector<util::Color> roundTrip(colors.size());
+    util::batch::LinearToSrgb(linear, roundTrip);
+
+    for (size_t index = 0; index < colors.size(); index++) DULL_REQUIRE(roundTrip[index] == colors[index]);
+}
@@ -0,0 +1,57 @@
+#include "tests/test.hpp"
+
+#include <engine/job/parallel_for.hpp>
+#include <engine/job/thread_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+using namespace dull;
+
+static constexpr uint32_t WARM_UP_COUNT = 64;
+static constexpr uint32_t SAMPLE_COUNT  = 1'001;
+
+// ---
+// A ParallelFor with one item per chunk and an empty body measures only the fork and the join
+// Note: the median keeps a preempted sample on a loaded machine from failing the run
+// Note: the limit is generous against the few microseconds a fork-join takes, it catches a sleep or lock creeping in
+// ---
+static constexpr std::chrono::microseconds MAX_MEDIAN_FORK_JOIN {50};
+
+DULL_TEST_CASE(job, fork_join_overhead)
+{
+    const uint32_t WORKER_COUNT = std::clamp(std::thread::hardware_concurrency(), 2U, 8U) - 1;
+
+    job::ThreadPool threadPool {WORKER_COUNT};
+    const size_t ITEM_COUNT = job::GetParallelChunkCount(SIZE_MAX, threadPool);
+
+    std::atomic<uint64_t> itemCount {0};
+    std::array<std::chrono::nanoseconds, SAMPLE_COUNT> samples {};
+
+    const auto FORK_JOIN = [&] {
+        job::ParallelFor(threadPool, ITEM_COUNT, [&itemCount](size_t begin, size_t end) {
+            itemCount.fetch_add(end - begin, std::memory_order_relaxed);
+        });
+    };
+
+    for (uint32_t run = 0; run < WARM_UP_COUNT; run++) FORK_JOIN();
+
+    for (std::chrono::nanoseconds& sample : samples)
+    {
+        const auto START_TIME = std::chrono::steady_clock::now();
+        FORK_JOIN();
+        sample = std::chrono::steady_clock::now() - START_TIME;
+    }
+
+    DULL_REQUIRE(itemCount.load() == ITEM_COUNT * (WARM_UP_COUNT + SAMPLE_COUNT));
+
+    std::ranges::nth_element(samples, samples.begin() + SAMPLE_COUNT / 2);
+    const std::chrono::nanoseconds MEDIAN = samples[SAMPLE_COUNT / 2];
+
+    test.Log(zutil::INFO, {"median fork-join of {} chunks on {} workers: {} ns", ITEM_COUNT, WORKER_COUNT, MEDIAN.count()});
+    DULL_CHECK(MEDIAN <= MAX_MEDIAN_FORK_JOIN);
+}
@@ -0,0 +1,78 @@
+#include "tests/test.hpp"
+
+#include <engine/core/app.hpp>
+#include <engine/memory/heap_tracker.hpp>
+#include <engine/platform/i_clock.hpp>
+#include <engine/process/i_processor.hpp>
+#include <engine/render/render_queue.hpp>
+#include <engine/util/color_rgba.hpp>
+#include <engine/util/rect.hpp>
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+using namespace dull;
+
+static constexpr uint32_t WARM_UP_FRAME_COUNT = 16;
+static constexpr uint32_t FRAME_COUNT         = 256;
+static constexpr uint32_t RECT_COUNT          = 64;
+static constexpr double   FRAME_TIME          = 1.0 / 60.0;
+
+// ---
+// Does a frame's usual work and records the heap allocations of every frame after warm-up
+// Note: FrameMemoryStats describes the last completed frame, so each sample covers the whole previous frame
+// ---
+struct _SteadyFrame final : public process::IProcessor {
+    platform::ManualClock clock;
+    std::vector<uint64_t> heapAllocationCounts;
+    uint32_t frameCount = 0;
+    uint32_t tickCount  = 0;
+
+protected:
+    void IInit() final { this->heapAllocationCounts.reserve(FRAME_COUNT); }
+
+    void IFixedUpdate() final { this->tickCount++; }
+
+    void IUpdate() final
+    {
+        core::App& app = core::App::GetInstance();
+
+        if (this->frameCount > WARM_UP_FRAME_COUNT) this->heapAllocationCounts.push_back(app.GetFrameMemoryStats().heapAllocationCount);
+
+        std::pmr::vector<util::Rect> rects {&app.GetFrameArena().GetResource()};
+        rects.reserve(RECT_COUNT);
+
+        for (uint32_t index = 0; index < RECT_COUNT; index++) rects.push_back({static_cast<float>(index), 0.0F, 8.0F, 8.0F});
+        for (const util::Rect& RECT : rects) app.GetRenderQueue().SubmitRect(RECT, util::Color::White());
+
+        if (++this->frameCount == FRAME_COUNT) app.Quit();
+        else this->clock.Advance(FRAME_TIME);
+    }
+};
+
+DULL_TEST_CASE(memory, steady_frames_do_not_allocate)
+{
+    if (!memory::IS_HEAP_TRACKING_ENABLED)
+    {
+        test.Skip("needs DULL_TRACK_HEAP_ALLOCATIONS");
+        return;
+    }
+
+    _SteadyFrame processor;
+
+    core::WindowContext windowContext;
+    windowContext.title    = "dull_tests";
+    windowContext.backend  = platform::BackendType::Headless;
+    windowContext.clockPtr = &processor.clock;
+
+    {
+        core::App app {windowContext, &processor};
+        app.Run();
+    }
+
+    DULL_REQUIRE(processor.heapAllocationCounts.size() == FRAME_COUNT - WARM_UP_FRAME_COUNT - 1);
+    DULL_CHECK(processor.tickCount > 0);
+
+    for (const uint64_t COUNT : processor.heapAllocationCounts) DULL_CHECK(COUNT == 0);
+}
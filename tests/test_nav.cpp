@@ -0,0 +1,266 @@
+#include "tests/test.hpp"
+
+#include <engine/job/thread_pool.hpp>
+#include <engine/nav/nav_grid.hpp>
+#include <engine/nav/path_service.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace dull;
+
+// Small enough for a full Dijkstra per query, large enough for 8x6 clusters and routes across several of them
+static constexpr int32_t GRID_WIDTH   = 64;
+static constexpr int32_t GRID_HEIGHT  = 48;
+static constexpr int32_t CLUSTER_SIZE = 8;
+static constexpr int32_t WALL_X       = 30;
+
+// Cells the test expects to be walkable, mirrored into the grid under test
+using _OpenCells = std::vector<uint8_t>;
+
+[[nodiscard]] static bool sIsOpen(const _OpenCells& open, int32_t x, int32_t y) noexcept
+{
+    return x >= 0 && y >= 0 && x < GRID_WIDTH && y < GRID_HEIGHT && open[y * GRID_WIDTH + x] != 0;
+}
+
+// Random rubble and a wall down the middle with two gaps, so some pockets are sealed off
+[[nodiscard]] static _OpenCells sMakeOpenCells()
+{
+    std::mt19937 random {17};
+    std::bernoulli_distribution isBlocked {0.25};
+
+    _OpenCells open(GRID_WIDTH * GRID_HEIGHT);
+
+    for (int32_t y = 0; y < GRID_HEIGHT; y++)
+        for (int32_t x = 0; x < GRID_WIDTH; x++) open[y * GRID_WIDTH + x] = (x == WALL_X || isBlocked(random)) ? 0 : 1;
+
+    open[5 * GRID_WIDTH + WALL_X]  = 1;
+    open[40 * GRID_WIDTH + WALL_X] = 1;
+
+    return open;
+}
+
+// Step cost between two cells, NIL_COST when it isn't an 8-way move between open cells or cuts a corner
+[[nodiscard]] static uint32_t sStepCost(const _OpenCells& open, util::Vec2i from, util::Vec2i to) noexcept
+{
+    const int32_t DX = to.x - from.x;
+    const int32_t DY = to.y - from.y;
+
+    if ((DX == 0 && DY == 0) || std::abs(DX) > 1 || std::abs(DY) > 1) return nav::NIL_COST;
+    if (!sIsOpen(open, from.x, from.y) || !sIsOpen(open, to.x, to.y)) return nav::NIL_COST;
+    if (DX == 0 || DY == 0) return nav::STRAIGHT_COST;
+
+    return sIsOpen(open, from.x + DX, from.y) && sIsOpen(open, from.x, from.y + DY) ? nav::DIAGONAL_COST : nav::NIL_COST;
+}
+
+// Cost of a path from start to goal, NIL_COST when any step is invalid
+[[nodiscard]] static uint32_t sPathCost(const _OpenCells& open, util::Vec2i start, util::Vec2i goal, std::span<const util::Vec2i> cells) noexcept
+{
+    if (cells.empty() || cells.front() != start || cells.back() != goal) return nav::NIL_COST;
+
+    uint32_t cost = 0;
+
+    for (size_t index = 1; index < cells.size(); index++)
+    {
+        const uint32_t STEP_COST = sStepCost(open, cells[index - 1], cells[index]);
+        if (STEP_COST == nav::NIL_COST) return nav::NIL_COST;
+
+        cost += STEP_COST;
+    }
+
+    return cost;
+}
+
+// Shortest cost from start to every cell over the whole grid, NIL_COST where it can't reach
+[[nodiscard]] static std::vector<uint32_t> sDijkstra(const _OpenCells& open, util::Vec2i start)
+{
+    std::vector<uint32_t> costs(GRID_WIDTH * GRID_HEIGHT, nav::NIL_COST);
+    if (!sIsOpen(open, start.x, start.y)) return costs;
+
+    using _QueueEntry = std::pair<uint32_t, uint32_t>; // cost, cell
+    std::priority_queue<_QueueEntry, std::vector<_QueueEntry>, std::greater<>> queue;
+
+    costs[start.y * GRID_WIDTH + start.x] = 0;
+    queue.push({0, static_cast<uint32_t>(start.y * GRID_WIDTH + start.x)});
+
+    while (!queue.empty())
+    {
+        const auto [COST, CELL] = queue.top();
+        queue.pop();
+
+        if (COST != costs[CELL]) continue;
+
+        const util::Vec2i FROM {static_cast<int32_t>(CELL % GRID_WIDTH), static_cast<int32_t>(CELL / GRID_WIDTH)};
+
+        for (int32_t dy = -1; dy <= 1; dy++)
+        {
+            for (int32_t dx = -1; dx <= 1; dx++)
+            {
+                const util::Vec2i TO {FROM.x + dx, FROM.y + dy};
+                const uint32_t STEP_COST = sStepCost(open, FROM, TO);
+
+                if (STEP_COST == nav::NIL_COST) continue;
+
+                const uint32_t TO_CELL = static_cast<uint32_t>(TO.y * GRID_WIDTH + TO.x);
+
+                if (COST + STEP_COST < costs[TO_CELL])
+                {
+                    costs[TO_CELL] = COST + STEP_COST;
+                    queue.push({costs[TO_CELL], TO_CELL});
+                }
+            }
+        }
+    }
+
+    return costs;
+}
+
+DULL_TEST_CASE(nav, reachability_matches_dijkstra)
+{
+    const _OpenCells OPEN = sMakeOpenCells();
+
+    nav::NavGrid grid {{GRID_WIDTH, GRID_HEIGHT, CLUSTER_SIZE}};
+
+    for (int32_t y = 0; y < GRID_HEIGHT; y++)
+        for (int32_t x = 0; x < GRID_WIDTH; x++) (void)grid.SetWalkable(x, y, sIsOpen(OPEN, x, y));
+
+    grid.Rebuild();
+
+    nav::NavScratch scratch;
+    std::vector<util::Vec2i> cells;
+    uint64_t foundCount = 0;
+    uint64_t extraCost  = 0;
+    uint64_t bestCost   = 0;
+
+    // Starts on both sides of the wall, every open cell as a goal
+    for (const int32_t SEED_CELL : {2 * GRID_WIDTH + 2, 30 * GRID_WIDTH + 17, 9 * GRID_WIDTH + 45, 44 * GRID_WIDTH + 50})
+    {
+        int32_t startCell = SEED_CELL;
+        while (OPEN[startCell] == 0) startCell++;
+
+        const util::Vec2i START {startCell % GRID_WIDTH, startCell / GRID_WIDTH};
+        const std::vector<uint32_t> COSTS = sDijkstra(OPEN, START);
+
+        for (int32_t y = 0; y < GRID_HEIGHT; y++)
+        {
+            for (int32_t x = 0; x < GRID_WIDTH; x++)
+            {
+                if (!sIsOpen(OPEN, x, y)) continue;
+
+                const util::Vec2i GOAL {x, y};
+                const uint32_t BEST_COST = COSTS[y * GRID_WIDTH + x];
+
+                // Searches append, PathService packs a whole wave into one buffer
+                cells.clear();
+
+                uint32_t cost = 0;
+                const bool IS_FOUND = grid.FindPath(scratch, START, GOAL, cells, cost);
+
+                DULL_REQUIRE(IS_FOUND == (BEST_COST != nav::NIL_COST));
+                if (!IS_FOUND) continue;
+
+                // HPA* paths are near optimal, never shorter than the true shortest path
+                DULL_REQUIRE(sPathCost(OPEN, START, GOAL, cells) == cost);
+                DULL_REQUIRE(cost >= BEST_COST);
+
+                foundCount++;
+                extraCost += cost - BEST_COST;
+                bestCost  += BEST_COST;
+            }
+        }
+    }
+
+    DULL_CHECK(foundCount > 0);
+    test.Log(zutil::INFO, {"{} paths, {}% longer than the shortest ones", foundCount, 100.0 * static_cast<double>(extraCost) / static_cast<double>(bestCost)});
+}
+
+struct _QueryOutcome {
+    std::vector<util::Vec2i> cells;
+    uint32_t cost     = 0;
+    bool     isFound  = false;
+    bool     isCached = false;
+};
+
+// Runs the queries as one batch and checks every result against the expected cells
+static void sCheckQueries(test::Test& test, nav::PathService& service, const _OpenCells& open, std::span<const nav::PathQuery> queries)
+{
+    std::vector<_QueryOutcome> outcomes;
+
+    service.Submit(queries, [&outcomes](std::span<const nav::PathResult> results) {
+        for (const nav::PathResult& RESULT : results)
+            outcomes.push_back({{RESULT.cells.begin(), RESULT.cells.end()}, RESULT.cost, RESULT.isFound, RESULT.isCached});
+    });
+
+    service.WaitAll();
+    DULL_REQUIRE(outcomes.size() == queries.size());
+
+    for (size_t index = 0; index < queries.size(); index++)
+    {
+        const nav::PathQuery& QUERY = queries[index];
+        const _QueryOutcome& OUTCOME = outcomes[index];
+        const uint32_t BEST_COST = sDijkstra(open, QUERY.start)[QUERY.goal.y * GRID_WIDTH + QUERY.goal.x];
+
+        DULL_REQUIRE(OUTCOME.isFound == (BEST_COST != nav::NIL_COST));
+        if (!OUTCOME.isFound) continue;
+
+        // Cached routes may run a few cells longer, but must still walk the current grid and add up to their cost
+        DULL_REQUIRE(sPathCost(open, QUERY.start, QUERY.goal, OUTCOME.cells) == OUTCOME.cost);
+        DULL_REQUIRE(OUTCOME.cost >= BEST_COST);
+    }
+}
+
+DULL_TEST_CASE(nav, cached_costs_follow_edits)
+{
+    _OpenCells open = sMakeOpenCells();
+
+    job::ThreadPool threadPool {2};
+    nav::PathService service {{{GRID_WIDTH, GRID_HEIGHT, CLUSTER_SIZE}, 256}, &threadPool};
+
+    for (int32_t y = 0; y < GRID_HEIGHT; y++)
+        for (int32_t x = 0; x < GRID_WIDTH; x++) (void)service.SetWalkable(x, y, sIsOpen(open, x, y));
+
+    // Far apart open cells, most pairs cross the wall and use cached entrance routes
+    std::mt19937 random {29};
+    std::uniform_int_distribution<int32_t> columnX {0, WALL_X / 2};
+    std::uniform_int_distribution<int32_t> row {0, GRID_HEIGHT - 1};
+
+    std::vector<nav::PathQuery> queries;
+
+    while (queries.size() < 256)
+    {
+        const util::Vec2i START {columnX(random), row(random)};
+        const util::Vec2i GOAL  {GRID_WIDTH - 1 - columnX(random), row(random)};
+
+        if (sIsOpen(open, START.x, START.y) && sIsOpen(open, GOAL.x, GOAL.y)) queries.push_back({START, GOAL});
+    }
+
+    // The second pass serves repeated cluster pairs from the cache
+    sCheckQueries(test, service, open, queries);
+    sCheckQueries(test, service, open, queries);
+
+    DULL_REQUIRE(service.GetStats().cacheHitCount > 0);
+    const uint64_t HIT_COUNT = service.GetStats().cacheHitCount;
+
+    // Seal the gap most cached routes pass, open a new one and scatter rubble over cached paths
+    const auto EDIT = [&](int32_t x, int32_t y, bool isWalkable) {
+        open[y * GRID_WIDTH + x] = isWalkable ? 1 : 0;
+        (void)service.SetWalkable(x, y, isWalkable);
+    };
+
+    EDIT(WALL_X, 5, false);
+    EDIT(WALL_X, 24, true);
+
+    for (int32_t x = WALL_X - 6; x <= WALL_X + 6; x += 3) EDIT(x, 39, false);
+
+    sCheckQueries(test, service, open, queries);
+    sCheckQueries(test, service, open, queries);
+
+    DULL_CHECK(service.GetStats().rebuiltClusterCount > 0);
+    DULL_CHECK(service.GetStats().cacheHitCount > HIT_COUNT);
+}
@@ -0,0 +1,140 @@
+#include "tests/test.hpp"
+
+#include <engine/job/thread_pool.hpp>
+#include <engine/particle/particle_system.hpp>
+#include <engine/util/color_rgba.hpp>
+#include <engine/util/rect.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+
+using namespace dull;
+
+// A power of two tick, ages add up exactly
+static constexpr float TICK = 1.0F / 64.0F;
+
+// More than two chunks of the system, so compaction crosses chunk boundaries
+static constexpr size_t BURST_COUNT = 40'000;
+
+[[nodiscard]] static particle::EmitterConfig sMakeSprayConfig()
+{
+    particle::EmitterConfig config {};
+    config.capacity     = 2 * BURST_COUNT;
+    config.position     = {500.0F, 500.0F};
+    config.spawnExtent  = {20.0F, 20.0F};
+    config.velocityMin  = {-300.0F, -300.0F};
+    config.velocityMax  = {300.0F, 100.0F};
+    config.acceleration = {0.0F, 98.0F};
+    config.lifetimeMin  = 0.25F;
+    config.lifetimeMax  = 1.0F;
+    config.spawnRate    = 4'000.0F;
+    config.bounds       = util::Rect {0.0F, 0.0F, 1000.0F, 1000.0F};
+    config.startColor   = {255, 200, 50, 255};
+    config.endColor     = {40, 0, 90, 0};
+
+    return config;
+}
+
+DULL_TEST_CASE(particle, pooled_matches_serial)
+{
+    const uint32_t WORKER_COUNT = std::clamp(std::thread::hardware_concurrency(), 2U, 8U) - 1;
+    job::ThreadPool threadPool {WORKER_COUNT};
+
+    particle::ParticleSystem serialSystem;
+    particle::ParticleSystem pooledSystem {&threadPool};
+
+    particle::ParticleEmitter& serial = serialSystem.AddEmitter(sMakeSprayConfig(), 7);
+    particle::ParticleEmitter& pooled = pooledSystem.AddEmitter(sMakeSprayConfig(), 7);
+
+    DULL_REQUIRE(serial.Emit(BURST_COUNT) == BURST_COUNT);
+    DULL_REQUIRE(pooled.Emit(BURST_COUNT) == BURST_COUNT);
+
+    for (uint32_t tick = 0; tick < 48; tick++)
+    {
+        serialSystem.Simulate(TICK);
+        pooledSystem.Simulate(TICK);
+
+        DULL_REQUIRE(serial.GetCount() == pooled.GetCount());
+    }
+
+    // Spawns, deaths and culls all happened, and the arrays still line up element for element
+    DULL_CHECK(serial.GetCount() > 0 && serial.GetCount() != BURST_COUNT);
+    DULL_REQUIRE(std::ranges::equal(serial.GetColors(), pooled.GetColors()));
+
+    for (size_t index = 0; index < serial.GetCount(); index++) DULL_REQUIRE(serial.GetPosition(index) == pooled.GetPosition(index));
+}
+
+DULL_TEST_CASE(particle, count_is_spawns_minus_deaths)
+{
+    job::ThreadPool threadPool {2};
+    particle::ParticleSystem system {&threadPool};
+
+    particle::EmitterConfig config {};
+    config.capacity   = 2 * BURST_COUNT;
+    config.position   = {-1.0F, -1.0F};
+    config.startColor = util::Color::White();
+    config.endColor   = {0, 0, 0, 0};
+
+    particle::ParticleEmitter& emitter = system.AddEmitter(config);
+
+    // Two bursts half a lifetime apart, the first one dies while the second one lives on
+    const size_t FIRST_COUNT  = emitter.Emit(BURST_COUNT);
+    for (uint32_t tick = 0; tick < 32; tick++) system.Simulate(TICK);
+
+    emitter.SetPosition({1.0F, 1.0F});
+    const size_t SECOND_COUNT = emitter.Emit(BURST_COUNT / 2);
+
+    DULL_REQUIRE(FIRST_COUNT == BURST_COUNT && SECOND_COUNT == BURST_COUNT / 2);
+    DULL_REQUIRE(emitter.GetCount() == FIRST_COUNT + SECOND_COUNT);
+
+    for (uint32_t tick = 0; tick < 32; tick++) system.Simulate(TICK);
+
+    DULL_REQUIRE(emitter.GetCount() == SECOND_COUNT);
+
+    // Compaction moved whole particles, only the second burst's position and half lifetime color remain
+    const util::Color HALF_LIFE_COLOR = util::Color::Lerp(config.startColor, config.endColor, 127);
+
+    for (size_t index = 0; index < emitter.GetCount(); index++)
+    {
+        DULL_REQUIRE(emitter.GetPosition(index) == util::Vec2f(1.0F, 1.0F));
+        DULL_REQUIRE(emitter.GetColors()[index] == HALF_LIFE_COLOR);
+    }
+
+    for (uint32_t tick = 0; tick < 32; tick++) system.Simulate(TICK);
+
+    DULL_CHECK(emitter.GetCount() == 0);
+}
+
+DULL_TEST_CASE(particle, bounds_cull_leaving_particles)
+{
+    particle::EmitterConfig config {};
+    config.capacity    = BURST_COUNT;
+    config.position    = {50.0F, 50.0F};
+    config.velocityMin = {-40.0F, 0.0F};
+    config.velocityMax = {40.0F, 0.0F};
+    config.lifetimeMin = 10.0F;
+    config.lifetimeMax = 10.0F;
+    config.bounds      = util::Rect {0.0F, 0.0F, 100.0F, 100.0F};
+
+    particle::ParticleSystem system;
+    particle::ParticleEmitter& emitter = system.AddEmitter(config);
+    (void)emitter.Emit(BURST_COUNT);
+
+    // Two seconds in, only particles slower than 25 units per second are left, far short of their lifetime
+    for (uint32_t tick = 0; tick < 128; tick++)
+    {
+        system.Simulate(TICK);
+
+        for (size_t index = 0; index < emitter.GetCount(); index++)
+        {
+            const util::Vec2f POSITION = emitter.GetPosition(index);
+            DULL_REQUIRE(POSITION.x >= 0.0F && POSITION.x <= 100.0F);
+        }
+    }
+
+    const double KEPT_SHARE = static_cast<double>(emitter.GetCount()) / BURST_COUNT;
+
+    test.Log(zutil::INFO, {"{} of {} particles left the bounds", BURST_COUNT - emitter.GetCount(), BURST_COUNT});
+    DULL_CHECK(test::IsNear(KEPT_SHARE, 25.0 / 40.0, 0.02));
+}
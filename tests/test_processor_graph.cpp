@@ -0,0 +1,102 @@
+#include "tests/test.hpp"
+
+#include <engine/core/app.hpp>
+#include <engine/process/i_processor.hpp>
+#include <engine/process/processor_graph.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace dull;
+
+static constexpr uint32_t FRAME_COUNT = 2;
+
+// Shared by the stages of one run, records who ran in which order and how many ran at once
+struct _StageLog {
+    std::mutex orderMutex;
+    std::vector<uint32_t> order;
+    std::atomic<uint32_t> activeCount  {0};
+    std::atomic<uint32_t> overlapCount {0};
+};
+
+// ---
+// Stage waiting a while for another stage to run beside it
+// Note: it yields while waiting, so a parallel stage gets to run even on a single core
+// ---
+struct _LoggingStage final : public process::IProcessor {
+    _StageLog* logPtr = nullptr;
+    uint32_t index = 0;
+
+protected:
+    void IUpdate() final
+    {
+        this->logPtr->activeCount++;
+
+        const auto END_TIME = std::chrono::steady_clock::now() + std::chrono::milliseconds {10};
+
+        while (std::chrono::steady_clock::now() < END_TIME)
+        {
+            if (this->logPtr->activeCount.load() > 1)
+            {
+                this->logPtr->overlapCount++;
+                break;
+            }
+
+            std::this_thread::yield();
+        }
+
+        {
+            std::lock_guard lock {this->logPtr->orderMutex};
+            this->logPtr->order.push_back(this->index);
+        }
+
+        this->logPtr->activeCount--;
+    }
+};
+
+// Quits after FRAME_COUNT frames
+struct _FrameLimit final : public process::IProcessor {
+    uint32_t frameCount = 0;
+
+protected:
+    void IUpdate() final { if (++this->frameCount == FRAME_COUNT) core::App::GetInstance().Quit(); }
+};
+
+DULL_TEST_CASE(processor_graph, undeclared_runs_serially)
+{
+    constexpr uint32_t STAGE_COUNT = 4;
+
+    _StageLog log;
+    _LoggingStage stages[STAGE_COUNT];
+    _FrameLimit frameLimit;
+    process::ProcessorGraph graph;
+
+    for (uint32_t index = 0; index < STAGE_COUNT; index++)
+    {
+        stages[index].logPtr = &log;
+        stages[index].index  = index;
+        graph.Add(stages[index], {}, "LoggingStage");
+    }
+
+    process::ResourceAccess stateless;
+    stateless.isStateless = true;
+    graph.Add(frameLimit, stateless);
+
+    core::WindowContext windowContext;
+    windowContext.title   = "dull_tests";
+    windowContext.backend = platform::BackendType::Headless;
+
+    {
+        core::App app {windowContext, &graph};
+        app.Run();
+    }
+
+    DULL_CHECK(log.overlapCount == 0);
+    DULL_REQUIRE(log.order.size() == STAGE_COUNT * FRAME_COUNT);
+
+    for (size_t run = 0; run < log.order.size(); run++) DULL_CHECK(log.order[run] == run % STAGE_COUNT);
+}
@@ -0,0 +1,41 @@
+#include "tests/test.hpp"
+
+#include <engine/profile/profiler.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+using namespace dull;
+
+DULL_TEST_CASE(profiler, full_ring_drops_new_events)
+{
+    // More than one thread ring holds, recorded without a drain in between
+    constexpr uint32_t EVENT_COUNT = 100'000;
+    constexpr std::string_view ZONE_NAME = "test::FullRing";
+
+    profile::Profiler::EndFrame();
+    const uint64_t DROPPED_BEFORE = profile::Profiler::GetDroppedEventCount();
+
+    for (uint32_t index = 0; index < EVENT_COUNT; index++)
+        profile::Profiler::_Record(ZONE_NAME.data(), index, index + 1);
+
+    profile::Profiler::EndFrame();
+
+    const uint64_t DROPPED_COUNT = profile::Profiler::GetDroppedEventCount() - DROPPED_BEFORE;
+    const std::vector<profile::ZoneSummary> SUMMARIES = profile::Profiler::GetSummary();
+    const auto SUMMARY = std::ranges::find(SUMMARIES, ZONE_NAME, &profile::ZoneSummary::name);
+
+    DULL_REQUIRE(SUMMARY != SUMMARIES.end());
+    DULL_CHECK(DROPPED_COUNT > 0);
+
+    // Every event is either drained or counted, the kept ones are the oldest
+    DULL_CHECK(SUMMARY->callsPerFrame + DROPPED_COUNT == EVENT_COUNT);
+
+    // The drained slots are free again
+    profile::Profiler::_Record(ZONE_NAME.data(), 0, 1);
+    profile::Profiler::EndFrame();
+
+    DULL_CHECK(profile::Profiler::GetDroppedEventCount() - DROPPED_BEFORE == DROPPED_COUNT);
+}
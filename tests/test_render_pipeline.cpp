@@ -0,0 +1,84 @@
+#include "tests/test.hpp"
+
+#include <engine/core/app.hpp>
+#include <engine/platform/i_clock.hpp>
+#include <engine/process/i_processor.hpp>
+#include <engine/render/render_queue.hpp>
+#include <engine/util/color_rgba.hpp>
+#include <engine/util/rect.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+using namespace dull;
+
+static constexpr uint32_t FRAME_COUNT = 64;
+static constexpr double   FRAME_TIME  = 1.0 / 60.0;
+
+// Long enough that the main thread regularly catches up with the render thread and has to wait
+static constexpr double RENDER_COST = 0.0002;
+
+// The render thread presents the last frame on its own, this only bounds a hang
+static constexpr std::chrono::seconds MAX_PRESENT_WAIT {5};
+
+// ---
+// Submits a quad every frame and samples the presented count the main thread sees
+// Note: presenting never runs ahead of submitting, a frame in flight may still be on the render thread
+// ---
+struct _FrameSubmitter final : public process::IProcessor {
+    platform::ManualClock clock;
+    uint32_t frameCount       = 0;
+    uint64_t presentedCount   = 0;
+    bool     isPresentedAhead = false;
+    bool     isCountDecreased = false;
+
+protected:
+    void IUpdate() final
+    {
+        core::App& app = core::App::GetInstance();
+        const uint64_t PRESENTED_COUNT = app.GetRenderPipeline().GetPresentedCount();
+
+        this->isPresentedAhead |= PRESENTED_COUNT > this->frameCount;
+        this->isCountDecreased |= PRESENTED_COUNT < this->presentedCount;
+        this->presentedCount = PRESENTED_COUNT;
+
+        app.GetRenderQueue().SubmitRect({static_cast<float>(this->frameCount), 0.0F, 8.0F, 8.0F}, util::Color::White());
+
+        if (++this->frameCount == FRAME_COUNT) app.Quit();
+        else this->clock.Advance(FRAME_TIME);
+    }
+};
+
+DULL_TEST_CASE(render_pipeline, presents_every_frame_and_joins)
+{
+    _FrameSubmitter processor;
+
+    core::WindowContext windowContext;
+    windowContext.title               = "dull_tests";
+    windowContext.backend             = platform::BackendType::Headless;
+    windowContext.isPipelined         = true;
+    windowContext.simulatedRenderCost = RENDER_COST;
+    windowContext.clockPtr            = &processor.clock;
+
+    {
+        core::App app {windowContext, &processor};
+        DULL_REQUIRE(app.IsPipelined());
+
+        app.Run();
+
+        const render::RenderPipeline& PIPELINE = app.GetRenderPipeline();
+        const auto DEADLINE = std::chrono::steady_clock::now() + MAX_PRESENT_WAIT;
+
+        while (PIPELINE.GetPresentedCount() < FRAME_COUNT && std::chrono::steady_clock::now() < DEADLINE) std::this_thread::yield();
+
+        DULL_CHECK(processor.frameCount == FRAME_COUNT);
+        DULL_CHECK(PIPELINE.GetPresentedCount() == FRAME_COUNT);
+        DULL_CHECK(PIPELINE.IsActive());
+    }
+
+    // Closing the App joined the render thread, an unjoined std::thread would have terminated the run
+    DULL_CHECK(!core::App::HasInstance());
+    DULL_CHECK(!processor.isPresentedAhead);
+    DULL_CHECK(!processor.isCountDecreased);
+}
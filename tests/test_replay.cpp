@@ -0,0 +1,149 @@
+#include "tests/test.hpp"
+
+#include <engine/core/app.hpp>
+#include <engine/platform/i_clock.hpp>
+#include <engine/process/i_processor.hpp>
+#include <engine/replay/state_hash.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace dull;
+
+// Powers of two keep the frame times exact, every frame after the first runs one fixed tick
+static constexpr uint32_t TICKS_PER_SECOND = 64;
+static constexpr uint32_t FRAME_COUNT      = 32;
+static constexpr uint32_t PERTURBED_FRAME  = 10;
+
+struct _SimulationState {
+    float target   = 0.0F;
+    float position = 0.0F;
+};
+
+// ---
+// Chases the mouse every fixed tick and hashes its state into the log
+// Note: the input source moves the mouse every frame, replays override it with the recorded input
+// ---
+struct _MouseChaser final : public process::IProcessor {
+    platform::ManualClock clock;
+    _SimulationState state;
+    uint32_t frameCount = 0;
+
+protected:
+    void IInit() final
+    {
+        core::App& app = core::App::GetInstance();
+
+        app.GetInputSystem().SetSource([this](platform::InputSnapshot& input) {
+            input.mousePosition = {1.0F + static_cast<float>(this->frameCount) * 0.75F, 7.0F};
+        });
+
+        app.GetReplaySystem().SetStateHasher([this] { return replay::HashValue(this->state); });
+    }
+
+    void IFixedUpdate() final
+    {
+        this->state.target    = core::App::GetInstance().GetInputSystem().GetMousePosition().x;
+        this->state.position += (this->state.target - this->state.position) * 0.5F;
+    }
+
+    void IUpdate() final
+    {
+        if (++this->frameCount == FRAME_COUNT) core::App::GetInstance().Quit();
+        else this->clock.Advance(1.0 / TICKS_PER_SECOND);
+    }
+};
+
+struct _RunResult {
+    _SimulationState state;
+    uint64_t replayFrameCount = 0;
+    bool     hasDesynced      = false;
+    uint64_t desyncFrame      = 0;
+};
+
+[[nodiscard]] static _RunResult sRun(const std::string& recordPath, const std::string& replayPath)
+{
+    _MouseChaser processor;
+
+    core::WindowContext windowContext;
+    windowContext.title          = "dull_tests";
+    windowContext.backend        = platform::BackendType::Headless;
+    windowContext.ticksPerSecond = TICKS_PER_SECOND;
+    windowContext.clockPtr       = &processor.clock;
+    windowContext.recordPath     = recordPath;
+    windowContext.replayPath     = replayPath;
+
+    core::App app {windowContext, &processor};
+    app.Run();
+
+    const replay::ReplaySystem& REPLAY = app.GetReplaySystem();
+    return {processor.state, REPLAY.GetFrameCount(), REPLAY.HasDesynced(), REPLAY.GetDesyncFrame()};
+}
+
+[[nodiscard]] static size_t sSkipVarint(const std::vector<char>& bytes, size_t offset) noexcept
+{
+    while (static_cast<uint8_t>(bytes[offset]) & 0x80) offset++;
+    return offset + 1;
+}
+
+// ---
+// Flips the lowest bit of the mouse x a frame recorded, the simulation reads it from that frame on
+// Note: walks the log layout of ReplaySystem, frames here only ever carry a mouse position and state hashes
+// ---
+static void sPerturbMouseX(const std::string& path, uint32_t frame)
+{
+    std::vector<char> bytes;
+
+    {
+        std::ifstream file {path, std::ios::binary};
+        bytes.assign(std::istreambuf_iterator<char> {file}, {});
+    }
+
+    // Magic, version, tick rate, then the clock samples of App construction and of Run
+    size_t offset = sSkipVarint(bytes, sSkipVarint(bytes, 8)) + 2 * 8;
+
+    for (uint32_t index = 0; index <= frame; index++)
+    {
+        offset = sSkipVarint(bytes, offset);
+
+        const size_t TICK_COUNT_OFFSET = offset;
+        offset = sSkipVarint(bytes, offset) + 1;
+
+        if (index == frame)
+        {
+            bytes[offset] ^= 1;
+            break;
+        }
+
+        // Position x and y, then one hash per tick, tick counts stay below 128 and fit a single varint byte
+        offset = sSkipVarint(bytes, sSkipVarint(bytes, offset)) + 8 * static_cast<size_t>(bytes[TICK_COUNT_OFFSET]);
+    }
+
+    std::ofstream {path, std::ios::binary | std::ios::trunc}.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+DULL_TEST_CASE(replay, replays_recording_and_detects_desync)
+{
+    const std::string PATH = (std::filesystem::temp_directory_path() / "dull_test_replay.rpl").string();
+
+    const _RunResult RECORDED = sRun(PATH, "");
+    const _RunResult REPLAYED = sRun("", PATH);
+
+    DULL_REQUIRE(RECORDED.replayFrameCount == FRAME_COUNT);
+    DULL_CHECK(REPLAYED.replayFrameCount == FRAME_COUNT);
+    DULL_CHECK(!REPLAYED.hasDesynced);
+    DULL_CHECK(REPLAYED.state.target == RECORDED.state.target && REPLAYED.state.position == RECORDED.state.position);
+
+    sPerturbMouseX(PATH, PERTURBED_FRAME);
+    const _RunResult PERTURBED = sRun("", PATH);
+
+    DULL_CHECK(PERTURBED.hasDesynced);
+    DULL_CHECK(PERTURBED.desyncFrame == PERTURBED_FRAME);
+
+    std::error_code error;
+    std::filesystem::remove(PATH, error);
+}
@@ -0,0 +1,176 @@
+#include "tests/test.hpp"
+
+#include <engine/ecs/registry.hpp>
+#include <engine/serial/snapshot_reader.hpp>
+#include <engine/serial/snapshot_writer.hpp>
+#include <engine/util/vec2.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <map>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+using namespace dull;
+
+// Every entity carries a tag, restored entities get new handles so the tag is what matches them up
+struct _SnapshotTag {
+    uint32_t id;
+};
+
+struct _SnapshotPosition {
+    util::Vec2f value;
+};
+
+struct _SnapshotHealth {
+    int32_t value;
+};
+
+template <>
+struct serial::SerialTraits<_SnapshotTag> {
+    static constexpr std::string_view NAME = "test.tag";
+    static constexpr auto FIELDS = std::tuple {&_SnapshotTag::id};
+};
+
+template <>
+struct serial::SerialTraits<_SnapshotPosition> {
+    static constexpr std::string_view NAME = "test.position";
+    static constexpr auto FIELDS = std::tuple {&_SnapshotPosition::value};
+};
+
+template <>
+struct serial::SerialTraits<_SnapshotHealth> {
+    static constexpr std::string_view NAME = "test.health";
+    static constexpr auto FIELDS = std::tuple {&_SnapshotHealth::value};
+};
+
+static constexpr uint32_t ENTITY_COUNT      = 300;
+static constexpr uint32_t INCREMENTAL_COUNT = 6;
+
+struct _EntityState {
+    std::optional<util::Vec2f> position;
+    std::optional<int32_t>     health;
+
+    bool operator == (const _EntityState& other) const noexcept = default;
+};
+
+// Components of every tagged entity, keyed by tag
+[[nodiscard]] static std::map<uint32_t, _EntityState> sCollect(ecs::Registry& registry)
+{
+    std::map<uint32_t, _EntityState> states;
+
+    registry.ForEach<_SnapshotTag>([&](ecs::Entity entity, const _SnapshotTag& tag) {
+        _EntityState& state = states[tag.id];
+
+        if (registry.Has<_SnapshotPosition>(entity)) state.position = registry.Get<_SnapshotPosition>(entity).value;
+        if (registry.Has<_SnapshotHealth>(entity))   state.health   = registry.Get<_SnapshotHealth>(entity).value;
+    });
+
+    return states;
+}
+
+// ---
+// One full save followed by a chain of incremental ones, each restored and compared with the registry it was saved from
+// Note: every step moves, destroys, creates into freed slots and adds or removes components
+// ---
+DULL_TEST_CASE(snapshot, incremental_chain_round_trips)
+{
+    const std::filesystem::path ROOT = std::filesystem::temp_directory_path() / "dull_test_snapshots";
+
+    std::error_code error;
+    std::filesystem::create_directories(ROOT, error);
+
+    serial::SnapshotSchema schema;
+    schema.Register<_SnapshotTag>();
+    schema.Register<_SnapshotPosition>();
+    schema.Register<_SnapshotHealth>();
+
+    ecs::Registry registry;
+    std::vector<ecs::Entity> entities;
+    uint32_t nextId = 0;
+
+    for (; nextId < ENTITY_COUNT; nextId++)
+    {
+        const float X = static_cast<float>(nextId);
+
+        if (nextId % 3 == 0) entities.push_back(registry.Create(_SnapshotTag {nextId}, _SnapshotPosition {{X, -X}}));
+        else entities.push_back(registry.Create(_SnapshotTag {nextId}, _SnapshotPosition {{X, 0.5F}}, _SnapshotHealth {100}));
+    }
+
+    serial::SnapshotWriter writer {schema};
+    serial::SnapshotReader reader {schema};
+    std::vector<std::string> paths;
+
+    std::mt19937 random {5};
+    std::uniform_int_distribution<uint32_t> operation {0, 9};
+
+    for (uint32_t save = 0; save <= INCREMENTAL_COUNT; save++)
+    {
+        if (save > 0)
+        {
+            for (size_t index = 0; index < entities.size(); index++)
+            {
+                const ecs::Entity ENTITY = entities[index];
+
+                switch (operation(random))
+                {
+                case 0:
+                    registry.Destroy(ENTITY);
+
+                    // The freed slot is handed to the new entity with a newer generation
+                    entities[index] = registry.Create(_SnapshotTag {nextId++}, _SnapshotHealth {static_cast<int32_t>(save)});
+                    break;
+
+                case 1: registry.Remove<_SnapshotPosition>(ENTITY); break;
+                case 2: registry.Remove<_SnapshotHealth>(ENTITY); break;
+                case 3: (void)registry.Add(ENTITY, _SnapshotHealth {-static_cast<int32_t>(save)}); break;
+                case 4: (void)registry.Add(ENTITY, _SnapshotPosition {{static_cast<float>(save), 1.0F}}); break;
+
+                case 5:
+                case 6:
+                    if (registry.Has<_SnapshotPosition>(ENTITY)) registry.Get<_SnapshotPosition>(ENTITY).value.x += 0.25F;
+                    break;
+
+                default: break;
+                }
+            }
+        }
+
+        const serial::SnapshotKind KIND = save == 0 ? serial::SnapshotKind::Full : serial::SnapshotKind::Incremental;
+        paths.push_back((ROOT / std::format("save_{}.snap", save)).string());
+
+        DULL_REQUIRE(writer.Save(registry, paths.back(), KIND));
+        writer.Wait();
+
+        const serial::SnapshotStats STATS = writer.GetStats();
+        DULL_REQUIRE(!STATS.hasFailed && STATS.kind == KIND);
+
+        // Incremental saves only carry what changed
+        if (save > 0) DULL_CHECK(STATS.removedCount > 0 && STATS.writtenCount < STATS.capturedCount);
+
+        DULL_REQUIRE(reader.Load(paths.back()));
+        DULL_CHECK(reader.GetSequence() == STATS.sequence);
+
+        ecs::Registry restored;
+        reader.Restore(restored);
+
+        DULL_REQUIRE(reader.GetComponentCount() == STATS.capturedCount);
+        DULL_REQUIRE(sCollect(restored) == sCollect(registry));
+    }
+
+    // A chain applies in order only, a link that skips one is refused and leaves the state untouched
+    serial::SnapshotReader skipping {schema};
+
+    DULL_REQUIRE(skipping.Load(paths[0]));
+    DULL_CHECK(!skipping.Load(paths[2]));
+    DULL_CHECK(skipping.Load(paths[1]));
+    DULL_CHECK(!skipping.Load(paths[1]));
+
+    std::filesystem::remove_all(ROOT, error);
+}
@@ -0,0 +1,56 @@
+#include "tests/test.hpp"
+
+#include <engine/core/static_app.hpp>
+#include <engine/platform/i_clock.hpp>
+#include <engine/process/static_processor.hpp>
+
+#include <cstdint>
+
+using namespace dull;
+
+static constexpr uint32_t TICKS_PER_SECOND = 32;
+static constexpr uint32_t TICKS_PER_FRAME  = 2;
+static constexpr uint32_t FRAME_COUNT      = 8;
+
+// Processors are default constructed by the StaticApp, they share the clock through the file
+static platform::ManualClock sClock;
+
+struct _TickCounter {
+    uint32_t tickCount = 0;
+
+    void FixedUpdate() noexcept { this->tickCount++; }
+};
+
+struct _ClockFeeder {
+    uint32_t frameCount = 0;
+
+    void Update()
+    {
+        if (++this->frameCount == FRAME_COUNT) core::App::GetInstance().Quit();
+        else sClock.Advance(static_cast<double>(TICKS_PER_FRAME) / TICKS_PER_SECOND);
+    }
+};
+
+struct _TestConfig : public core::DefaultAppConfig {
+    static constexpr uint32_t TICKS_PER_SECOND = ::TICKS_PER_SECOND;
+    static constexpr platform::BackendType BACKEND = platform::BackendType::Headless;
+
+    using Processors = process::StaticProcessor<_TickCounter, _ClockFeeder>;
+};
+
+DULL_TEST_CASE(static_app, runs_configured_tick_rate)
+{
+    core::WindowContext windowContext;
+    windowContext.title          = "dull_tests";
+    windowContext.ticksPerSecond = 100;
+    windowContext.clockPtr       = &sClock;
+
+    core::StaticApp<_TestConfig> app {windowContext};
+    app.Run();
+
+    // The first frame measures no time, every later one carries TICKS_PER_FRAME ticks
+    DULL_CHECK(app.GetProcessors().Get<_ClockFeeder>().frameCount == FRAME_COUNT);
+    DULL_CHECK(app.GetProcessors().Get<_TickCounter>().tickCount == (FRAME_COUNT - 1) * TICKS_PER_FRAME);
+    DULL_CHECK(app.GetApp().GetTimeSystem().GetFixedTickInterval() == 1.0 / TICKS_PER_SECOND);
+    DULL_CHECK(app.GetBackend().GetDrawnBatchCount() == 0);
+}
@@ -0,0 +1,155 @@
+#include "tests/test.hpp"
+
+#include <engine/config.hpp>
+#include <engine/core/app.hpp>
+#include <engine/platform/i_clock.hpp>
+#include <engine/process/i_processor.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace dull;
+using test::IsNear;
+
+// Powers of two keep the tick interval and the frame times below exact in binary
+static constexpr uint32_t TICKS_PER_SECOND = 64;
+static constexpr double   TICK_INTERVAL    = 1.0 / TICKS_PER_SECOND;
+
+// What the TimeSystem reported after one fed frame
+struct _FrameSample {
+    uint32_t tickCount      = 0;
+    uint64_t fixedTickCount = 0;
+    double   deltaTime      = 0.0;
+    double   alpha          = 0.0;
+    double   droppedTime    = 0.0;
+};
+
+// ---
+// Moves a manual clock by one synthetic frame time per frame and samples the TimeSystem after each
+// Note: the first frame measures no time, so sample N belongs to frame time N
+// ---
+struct _FrameFeeder final : public process::IProcessor {
+    platform::ManualClock clock;
+    std::vector<double> frameTimes;
+    std::vector<_FrameSample> samples;
+    uint32_t tickCount = 0;
+    bool     isFirstFrame = true;
+
+protected:
+    void IFixedUpdate() final { this->tickCount++; }
+
+    void IUpdate() final
+    {
+        const system::TimeSystem& TIME = core::App::GetInstance().GetTimeSystem();
+
+        if (!this->isFirstFrame)
+        {
+            this->samples.push_back({
+                std::exchange(this->tickCount, 0), TIME.GetFixedTickCount(), TIME.GetDeltaTime(), TIME.GetAlpha(), TIME.GetDroppedTime()
+            });
+        }
+
+        this->isFirstFrame = false;
+
+        if (this->samples.size() == this->frameTimes.size()) core::App::GetInstance().Quit();
+        else this->clock.Advance(this->frameTimes[this->samples.size()]);
+    }
+};
+
+static void sFeedFrames(_FrameFeeder& feeder, uint32_t ticksPerSecond = TICKS_PER_SECOND)
+{
+    core::WindowContext windowContext;
+    windowContext.title          = "dull_tests";
+    windowContext.backend        = platform::BackendType::Headless;
+    windowContext.ticksPerSecond = ticksPerSecond;
+    windowContext.clockPtr       = &feeder.clock;
+
+    core::App app {windowContext, &feeder};
+    app.Run();
+}
+
+DULL_TEST_CASE(time_system, catch_up_ticks)
+{
+    _FrameFeeder feeder;
+    feeder.frameTimes = {3.5 * TICK_INTERVAL, 0.5 * TICK_INTERVAL, 0.25 * TICK_INTERVAL, 0.0};
+    sFeedFrames(feeder);
+
+    DULL_REQUIRE(feeder.samples.size() == 4);
+
+    DULL_CHECK(feeder.samples[0].tickCount == 3);
+    DULL_CHECK(IsNear(feeder.samples[0].alpha, 0.5));
+
+    // The half tick left over completes with the next half
+    DULL_CHECK(feeder.samples[1].tickCount == 1);
+    DULL_CHECK(IsNear(feeder.samples[1].alpha, 0.0));
+
+    DULL_CHECK(feeder.samples[2].tickCount == 0);
+    DULL_CHECK(IsNear(feeder.samples[2].alpha, 0.25));
+
+    DULL_CHECK(feeder.samples[3].tickCount == 0);
+    DULL_CHECK(feeder.samples[3].fixedTickCount == 4);
+    DULL_CHECK(feeder.samples[3].droppedTime == 0.0);
+}
+
+DULL_TEST_CASE(time_system, no_drift)
+{
+    // Frames at 144 Hz against 60 ticks per second never line up, the accumulator has to carry the rest
+    constexpr uint32_t FRAME_COUNT = 10'000;
+    constexpr double   FRAME_TIME  = 1.0 / 144.0;
+
+    _FrameFeeder feeder;
+    feeder.frameTimes.assign(FRAME_COUNT, FRAME_TIME);
+    sFeedFrames(feeder, 60);
+
+    DULL_REQUIRE(feeder.samples.size() == FRAME_COUNT);
+
+    const _FrameSample& LAST = feeder.samples.back();
+    const double SIMULATED_TIME = (static_cast<double>(LAST.fixedTickCount) + LAST.alpha) / 60.0;
+
+    DULL_CHECK(LAST.fixedTickCount == static_cast<uint64_t>(FRAME_COUNT * FRAME_TIME * 60.0));
+    DULL_CHECK(IsNear(SIMULATED_TIME, FRAME_COUNT * FRAME_TIME, 1e-6));
+    DULL_CHECK(LAST.droppedTime == 0.0);
+
+    for (const _FrameSample& SAMPLE : feeder.samples) DULL_CHECK(SAMPLE.tickCount <= 1);
+}
+
+DULL_TEST_CASE(time_system, tick_cap)
+{
+    constexpr double FRAME_TIME = (config::MAX_FIXED_TICKS_PER_FRAME + 4.5) * TICK_INTERVAL;
+
+    _FrameFeeder feeder;
+    feeder.frameTimes = {FRAME_TIME, 0.0};
+    sFeedFrames(feeder);
+
+    DULL_REQUIRE(FRAME_TIME <= config::MAX_FRAME_TIME);
+    DULL_REQUIRE(feeder.samples.size() == 2);
+
+    // Whole ticks past the cap are dropped, the partial one is kept
+    DULL_CHECK(feeder.samples[0].tickCount == config::MAX_FIXED_TICKS_PER_FRAME);
+    DULL_CHECK(IsNear(feeder.samples[0].droppedTime, 4.0 * TICK_INTERVAL));
+    DULL_CHECK(IsNear(feeder.samples[0].alpha, 0.5));
+
+    // Nothing dropped is caught up later
+    DULL_CHECK(feeder.samples[1].tickCount == 0);
+    DULL_CHECK(IsNear(feeder.samples[1].droppedTime, 4.0 * TICK_INTERVAL));
+}
+
+DULL_TEST_CASE(time_system, frame_time_clamp)
+{
+    // At 32 ticks per second the clamped frame time is exactly the tick cap, so only the clamp drops time
+    constexpr uint32_t TICK_RATE  = 32;
+    constexpr double   FRAME_TIME = 1.0;
+
+    _FrameFeeder feeder;
+    feeder.frameTimes = {FRAME_TIME};
+    sFeedFrames(feeder, TICK_RATE);
+
+    DULL_REQUIRE(config::MAX_FRAME_TIME * TICK_RATE <= config::MAX_FIXED_TICKS_PER_FRAME);
+    DULL_REQUIRE(feeder.samples.size() == 1);
+
+    DULL_CHECK(IsNear(feeder.samples[0].deltaTime, config::MAX_FRAME_TIME));
+    DULL_CHECK(feeder.samples[0].tickCount == static_cast<uint32_t>(config::MAX_FRAME_TIME * TICK_RATE));
+    DULL_CHECK(IsNear(feeder.samples[0].droppedTime, FRAME_TIME - config::MAX_FRAME_TIME));
+    DULL_CHECK(IsNear(feeder.samples[0].alpha, 0.0));
+}
@@ -0,0 +1,82 @@
+#include "tests/test.hpp"
+
+#include <engine/core/app.hpp>
+#include <engine/platform/i_clock.hpp>
+#include <engine/process/i_processor.hpp>
+#include <engine/system/timer_system.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace dull;
+
+static constexpr uint32_t FRAME_COUNT = 10;
+static constexpr double   FRAME_TIME  = 0.005;
+
+// ---
+// Schedules three timers due on the same tick, the one firing first cancels the other two
+// Note: the wheel fires a slot newest first, so the canceller is scheduled last
+// ---
+struct _SameTickCancel final : public process::IProcessor {
+    platform::ManualClock clock;
+    std::vector<size_t> expiredCounts;
+    std::vector<size_t> scheduledCounts;
+    uint32_t loopingFireCount = 0;
+    uint32_t oneShotFireCount = 0;
+    uint32_t cancelFireCount  = 0;
+
+protected:
+    void IInit() final
+    {
+        system::TimerSystem& timerSystem = core::App::GetInstance().GetTimerSystem();
+
+        const system::TimerId LOOPING  = timerSystem.Schedule(0.01, [this](system::TimerId) { this->loopingFireCount++; }, true);
+        const system::TimerId ONE_SHOT = timerSystem.Schedule(0.01, [this](system::TimerId) { this->oneShotFireCount++; });
+
+        (void)timerSystem.Schedule(0.01, [this, LOOPING, ONE_SHOT](system::TimerId) {
+            system::TimerSystem& timers = core::App::GetInstance().GetTimerSystem();
+            timers.Cancel(LOOPING);
+            timers.Cancel(ONE_SHOT);
+            this->cancelFireCount++;
+        });
+    }
+
+    void IUpdate() final
+    {
+        const system::TimerSystem& TIMERS = core::App::GetInstance().GetTimerSystem();
+
+        this->expiredCounts.push_back(TIMERS.GetExpired().size());
+        this->scheduledCounts.push_back(TIMERS.GetScheduledCount());
+
+        if (this->expiredCounts.size() == FRAME_COUNT) core::App::GetInstance().Quit();
+        else this->clock.Advance(FRAME_TIME);
+    }
+};
+
+DULL_TEST_CASE(timer_system, cancel_due_same_tick)
+{
+    _SameTickCancel processor;
+
+    core::WindowContext windowContext;
+    windowContext.title    = "dull_tests";
+    windowContext.backend  = platform::BackendType::Headless;
+    windowContext.clockPtr = &processor.clock;
+
+    {
+        core::App app {windowContext, &processor};
+        app.Run();
+    }
+
+    DULL_CHECK(processor.cancelFireCount  == 1);
+    DULL_CHECK(processor.loopingFireCount == 0);
+    DULL_CHECK(processor.oneShotFireCount == 0);
+
+    DULL_REQUIRE(processor.expiredCounts.size() == FRAME_COUNT);
+
+    size_t expiredCount = 0;
+    for (const size_t COUNT : processor.expiredCounts) expiredCount += COUNT;
+
+    // Only the canceller ever expires, and nothing stays on the wheel
+    DULL_CHECK(expiredCount == 1);
+    DULL_CHECK(processor.scheduledCounts.back() == 0);
+}
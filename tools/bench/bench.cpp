@@ -0,0 +1,52 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/config.hpp>
+
+#include <format>
+
+namespace dull::bench {
+
+Bench::Bench(std::string filter, double minSampleTime, uint32_t sampleCount)
+: zutil::Logger {
+    {
+        config::DULL_TAG,
+        {"[BENCH]", zutil::ANSI::EX_Black}
+    }
+}
+, _filter {std::move(filter)}
+, _minSampleTime {minSampleTime}
+, _sampleCount {std::max<uint32_t>(sampleCount, 1)}
+{}
+
+[[nodiscard]] bool Bench::IsEnabled(std::string_view name) const noexcept
+{
+    return this->_filter.empty() || name.find(this->_filter) != std::string_view::npos;
+}
+
+void Bench::_Record(std::string_view name, std::vector<double>& sampleTimes, uint64_t opsPerSample, uint64_t allocationCount)
+{
+    std::ranges::sort(sampleTimes);
+
+    const double   MEDIAN_TIME = sampleTimes[sampleTimes.size() / 2];
+    const uint64_t OPS         = std::max<uint64_t>(opsPerSample, 1);
+    const uint64_t TOTAL_OPS   = OPS * sampleTimes.size();
+
+    BenchResult result {
+        std::string {name},
+        MEDIAN_TIME * 1e9 / static_cast<double>(OPS),
+        MEDIAN_TIME > 0.0 ? static_cast<double>(OPS) / MEDIAN_TIME : 0.0,
+        memory::IS_HEAP_TRACKING_ENABLED ? static_cast<double>(allocationCount) / static_cast<double>(TOTAL_OPS) : -1.0,
+        TOTAL_OPS,
+    };
+
+    this->Log(zutil::INFO, {"{:<44} {:>14.3f} ns/op {:>16.0f} op/s", result.name, result.nsPerOp, result.opsPerSecond});
+    this->_results.push_back(std::move(result));
+}
+
+[[nodiscard]] std::vector<_Suite>& _GetSuites()
+{
+    static std::vector<_Suite> suites;
+    return suites;
+}
+
+} // namespace dull::bench
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <engine/memory/heap_tracker.hpp>
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dull::bench {
+
+// ---
+// One measured benchmark case
+// Note: allocations are global heap allocations per operation, negative when heap tracking is compiled out
+// ---
+struct BenchResult final {
+    std::string name;
+    double   nsPerOp          = 0.0;
+    double   opsPerSecond     = 0.0;
+    double   allocationsPerOp = -1.0;
+    uint64_t operationCount   = 0;
+};
+
+// Keeps the compiler from dropping a computation whose result is otherwise unused
+template <typename T>
+inline void DoNotOptimize(const T& value) noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    const volatile char* volatile sinkPtr = reinterpret_cast<const volatile char*>(&value);
+    (void)sinkPtr;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+// ---
+// Times benchmark cases and collects their results
+// Note: a case is calibrated to run at least the minimum sample time, the reported time is the median sample
+// ---
+struct Bench final : public zutil::Logger {
+private:
+    using _Clock = std::chrono::steady_clock;
+
+    std::vector<BenchResult> _results;
+    std::string _filter;
+    double   _minSampleTime = 0.05;
+    uint32_t _sampleCount   = 5;
+
+    void _Record(std::string_view name, std::vector<double>& sampleTimes, uint64_t opsPerSample, uint64_t allocationCount);
+
+public:
+    Bench(Bench&&)                 = delete;
+    Bench(const Bench&)            = delete;
+    Bench& operator=(Bench&&)      = delete;
+    Bench& operator=(const Bench&) = delete;
+
+    // Note: cases whose name does not contain filter are skipped
+    explicit Bench(std::string filter = {}, double minSampleTime = 0.05, uint32_t sampleCount = 5);
+
+    [[nodiscard]] bool IsEnabled(std::string_view name) const noexcept;
+
+    // Times fn, every call counts as opsPerCall operations
+    template <typename FnT>
+    void Run(std::string_view name, uint64_t opsPerCall, FnT&& fn)
+    {
+        if (!this->IsEnabled(name)) return;
+
+        const auto TIME_CALLS = [&fn](uint64_t callCount) {
+            const _Clock::time_point START = _Clock::now();
+            for (uint64_t call = 0; call < callCount; call++) fn();
+            return std::chrono::duration<double>(_Clock::now() - START).count();
+        };
+
+        // Warm up, then grow the call count until one sample is long enough to time
+        uint64_t callCount = 1;
+
+        for (double time = TIME_CALLS(callCount); time < this->_minSampleTime; time = TIME_CALLS(callCount))
+        {
+            const double SCALE = time <= 0.0 ? 10.0 : std::clamp(this->_minSampleTime / time * 1.2, 1.5, 10.0);
+            callCount = static_cast<uint64_t>(static_cast<double>(callCount) * SCALE) + 1;
+        }
+
+        std::vector<double> sampleTimes;
+        const memory::HeapCounters HEAP_START = memory::GetHeapCounters();
+
+        for (uint32_t sample = 0; sample < this->_sampleCount; sample++) sampleTimes.push_back(TIME_CALLS(callCount));
+
+        const uint64_t ALLOCATION_COUNT = memory::GetHeapCounters().allocationCount - HEAP_START.allocationCount;
+        this->_Record(name, sampleTimes, callCount * opsPerCall, ALLOCATION_COUNT);
+    }
+
+    // Times a single call of fn, for cases too heavy or too stateful to repeat (cold starts, whole App runs)
+    template <typename FnT>
+    void RunOnce(std::string_view name, uint64_t operationCount, FnT&& fn)
+    {
+        if (!this->IsEnabled(name)) return;
+
+        const memory::HeapCounters HEAP_START = memory::GetHeapCounters();
+        const _Clock::time_point START = _Clock::now();
+
+        fn();
+
+        std::vector<double> sampleTimes {std::chrono::duration<double>(_Clock::now() - START).count()};
+        this->_Record(name, sampleTimes, operationCount, memory::GetHeapCounters().allocationCount - HEAP_START.allocationCount);
+    }
+
+    [[nodiscard]] const std::vector<BenchResult>& GetResults() const noexcept { return this->_results; }
+};
+
+// --- Suites ---
+
+using SuiteFn = void (*)(Bench& bench);
+
+struct _Suite {
+    std::string_view name;
+    SuiteFn fn;
+};
+
+[[nodiscard]] std::vector<_Suite>& _GetSuites();
+
+struct _SuiteRegistrar {
+    _SuiteRegistrar(std::string_view name, SuiteFn fn) { _GetSuites().push_back({name, fn}); }
+};
+
+} // namespace dull::bench
+
+/// MACROS:
+
+// Defines a suite function taking Bench& bench, suites run in name order
+#define DULL_BENCH_SUITE(name)                                                                               \
+    static void sBenchSuite_##name(::dull::bench::Bench& bench);                                             \
+    static const ::dull::bench::_SuiteRegistrar sBenchRegistrar_##name {#name, &sBenchSuite_##name};         \
+    static void sBenchSuite_##name(::dull::bench::Bench& bench)
@@ -0,0 +1,94 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/asset/asset_manager.hpp>
+#include <engine/asset/asset_traits.hpp>
+#include <engine/asset/pack_archive.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+// Thousands of small files is the startup case the pack exists for, the small set shows the fixed costs
+static constexpr uint32_t FILE_COUNTS[] = {256, 4'096};
+static constexpr size_t   FILE_SIZE     = 16 * 1024;
+static constexpr size_t   BUDGET_SIZE   = 128 * 1024 * 1024;
+
+[[nodiscard]] static std::string sLooseName(uint32_t fileCount) { return std::format("asset/load_{}_loose_files", fileCount); }
+[[nodiscard]] static std::string sPackName(uint32_t fileCount) { return std::format("asset/load_{}_pack_entries", fileCount); }
+
+// Loads every name through a fresh manager so nothing is served from its cache
+// Note: the OS page cache stays warm between samples, this is the engine side of a load, not a cold disk read
+static void sLoadAll(const std::vector<std::string>& paths, const asset::PackArchive* packPtr)
+{
+    asset::AssetManager assetManager {BUDGET_SIZE};
+
+    if (packPtr != nullptr) assetManager.Mount(*packPtr);
+
+    std::vector<asset::AssetHandle<asset::BinaryAsset>> handles;
+    handles.reserve(paths.size());
+
+    for (const std::string& path : paths) handles.push_back(assetManager.Load<asset::BinaryAsset>(path));
+
+    assetManager.WaitAll();
+
+    zutil::Assert(handles.back().IsReady(), "Benchmark asset failed to load");
+    DoNotOptimize(handles.data());
+}
+
+// Writes fileCount files, loads them loose and then through a pack built from them
+static void sRunFileCount(bench::Bench& bench, uint32_t fileCount)
+{
+    const std::string LOOSE_NAME = sLooseName(fileCount);
+    const std::string PACK_NAME  = sPackName(fileCount);
+
+    // Writing the files is slow enough to skip when the filter leaves nothing to run
+    if (!bench.IsEnabled(LOOSE_NAME) && !bench.IsEnabled(PACK_NAME)) return;
+
+    const std::filesystem::path ROOT = std::filesystem::temp_directory_path() / "dull_bench_assets";
+    const std::filesystem::path INPUT_DIRECTORY = ROOT / "input";
+
+    std::error_code error;
+    std::filesystem::remove_all(ROOT, error);
+    std::filesystem::create_directories(INPUT_DIRECTORY);
+
+    std::vector<std::string> names;
+    std::vector<std::string> loosePaths;
+    const std::string CONTENT(FILE_SIZE, 'x');
+
+    for (uint32_t index = 0; index < fileCount; index++)
+    {
+        names.push_back(std::format("asset_{:04}.bin", index));
+        loosePaths.push_back((INPUT_DIRECTORY / names.back()).string());
+
+        std::ofstream {loosePaths.back(), std::ios::binary} << CONTENT;
+    }
+
+    bench.Run(LOOSE_NAME, fileCount, [&loosePaths] { sLoadAll(loosePaths, nullptr); });
+
+#if defined(DULL_PACK_TOOL_PATH)
+    const std::filesystem::path PACK_PATH = ROOT / "bench.pack";
+    const std::string COMMAND = std::format("\"{}\" \"{}\" \"{}\"", DULL_PACK_TOOL_PATH, INPUT_DIRECTORY.string(), PACK_PATH.string());
+
+    asset::PackArchive pack;
+
+    if (std::system(COMMAND.c_str()) == 0 && pack.Open(PACK_PATH.string()))
+        bench.Run(PACK_NAME, fileCount, [&] { sLoadAll(names, &pack); });
+
+    pack.Close();
+#endif
+
+    std::filesystem::remove_all(ROOT, error);
+}
+
+DULL_BENCH_SUITE(asset)
+{
+    for (const uint32_t FILE_COUNT : FILE_COUNTS) sRunFileCount(bench, FILE_COUNT);
+}
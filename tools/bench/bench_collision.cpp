@@ -0,0 +1,116 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/collision/aabb_tree.hpp>
+#include <engine/collision/spatial_hash_grid.hpp>
+#include <engine/job/thread_pool.hpp>
+#include <engine/util/rect.hpp>
+
+#include <cstdint>
+#include <format>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+// Sweep over entity count and density, the same count is dense in the small world and sparse in the large one
+static constexpr uint32_t COLLIDER_COUNTS[] = {1'000, 10'000, 50'000};
+static constexpr float    WORLD_SIZES[]     = {4096.0F, 16384.0F};
+
+// Brute force is quadratic, above this it only measures the loop
+static constexpr uint32_t MAX_BRUTE_FORCE_COUNT = 10'000;
+
+// Same seed every run so both broad phases and the brute force see the same scene
+[[nodiscard]] static std::vector<util::Rect> sMakeScene(uint32_t colliderCount, float worldSize)
+{
+    std::mt19937 random {42};
+    std::uniform_real_distribution<float> position {0.0F, worldSize};
+    std::uniform_real_distribution<float> size {8.0F, 48.0F};
+
+    std::vector<util::Rect> rects;
+    rects.reserve(colliderCount);
+
+    for (uint32_t index = 0; index < colliderCount; index++) rects.emplace_back(position(random), position(random), size(random), size(random));
+
+    return rects;
+}
+
+[[nodiscard]] static std::string sCaseName(std::string_view kind, uint32_t colliderCount, float worldSize)
+{
+    return std::format("collision/{}_{}k_world_{}", kind, colliderCount / 1'000, static_cast<uint32_t>(worldSize));
+}
+
+// Moves every collider a little and back again on the next call, so the scene stays stable across samples
+template <typename BroadPhaseT>
+static void sJiggle(BroadPhaseT& broadPhase, const std::vector<collision::ProxyId>& proxyIds, std::vector<util::Rect>& rects, float& offset)
+{
+    offset = -offset;
+
+    for (size_t index = 0; index < proxyIds.size(); index++)
+    {
+        rects[index].x += offset;
+        broadPhase.Move(proxyIds[index], rects[index]);
+    }
+}
+
+template <typename BroadPhaseT>
+static void sBenchBroadPhase(bench::Bench& bench, std::string_view kind, uint32_t colliderCount, float worldSize, BroadPhaseT& broadPhase)
+{
+    std::vector<util::Rect> rects = sMakeScene(colliderCount, worldSize);
+    std::vector<collision::ProxyId> proxyIds;
+    std::vector<collision::ProxyPair> pairs;
+    float offset = 2.0F;
+
+    for (const util::Rect& rect : rects) proxyIds.push_back(broadPhase.Insert(rect));
+
+    bench.Run(sCaseName(std::format("{}_pairs", kind), colliderCount, worldSize), colliderCount, [&] {
+        pairs.clear();
+        broadPhase.QueryPairs(pairs);
+        DoNotOptimize(pairs.data());
+    });
+
+    bench.Run(sCaseName(std::format("{}_move", kind), colliderCount, worldSize), colliderCount, [&] {
+        sJiggle(broadPhase, proxyIds, rects, offset);
+        DoNotOptimize(offset);
+    });
+}
+
+DULL_BENCH_SUITE(collision)
+{
+    job::ThreadPool threadPool;
+    std::vector<collision::ProxyPair> pairs;
+
+    for (const float WORLD_SIZE : WORLD_SIZES)
+    {
+        for (const uint32_t COLLIDER_COUNT : COLLIDER_COUNTS)
+        {
+            collision::SpatialHashGrid grid {64.0F};
+            sBenchBroadPhase(bench, "grid", COLLIDER_COUNT, WORLD_SIZE, grid);
+
+            bench.Run(sCaseName("grid_pairs_parallel", COLLIDER_COUNT, WORLD_SIZE), COLLIDER_COUNT, [&] {
+                pairs.clear();
+                grid.QueryPairs(pairs, &threadPool);
+                DoNotOptimize(pairs.data());
+            });
+
+            collision::AabbTree tree;
+            sBenchBroadPhase(bench, "tree", COLLIDER_COUNT, WORLD_SIZE, tree);
+
+            if (COLLIDER_COUNT > MAX_BRUTE_FORCE_COUNT) continue;
+
+            // Baseline the broad phases are measured against
+            const std::vector<util::Rect> RECTS = sMakeScene(COLLIDER_COUNT, WORLD_SIZE);
+
+            bench.Run(sCaseName("brute_force_pairs", COLLIDER_COUNT, WORLD_SIZE), COLLIDER_COUNT, [&RECTS] {
+                uint32_t pairCount = 0;
+
+                for (size_t first = 0; first < RECTS.size(); first++)
+                    for (size_t second = first + 1; second < RECTS.size(); second++) pairCount += RECTS[first].CollidesWith(RECTS[second]);
+
+                DoNotOptimize(pairCount);
+            });
+        }
+    }
+}
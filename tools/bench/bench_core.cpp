@@ -0,0 +1,320 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/component/timer.hpp>
+#include <engine/core/app.hpp>
+#include <engine/core/static_app.hpp>
+#include <engine/platform/i_clock.hpp>
+#include <engine/process/i_processor.hpp>
+#include <engine/process/static_processor.hpp>
+#include <engine/system/input_system.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+// Note: whole App runs are timed once each, they're long enough that one sample is stable
+
+static constexpr uint32_t FRAME_COUNT      = 20'000;
+static constexpr uint32_t PROCESSOR_COUNT  = 100;
+static constexpr uint32_t DISPATCH_TICKS   = 10'000;
+static constexpr uint32_t PIPELINE_FRAMES  = 300;
+static constexpr double   PIPELINE_COST    = 0.001; // seconds of simulation and of presentation per frame
+static constexpr uint32_t TIMER_COUNT      = 10'000;
+static constexpr uint32_t TIMER_FRAMES     = 600;
+static constexpr uint32_t ACTION_COUNT     = 32;
+
+[[nodiscard]] static core::WindowContext sHeadlessContext()
+{
+    core::WindowContext windowContext;
+    windowContext.title   = "dull_bench";
+    windowContext.backend = platform::BackendType::Headless;
+    return windowContext;
+}
+
+static void sSpin(double seconds) noexcept
+{
+    const auto END_TIME = std::chrono::steady_clock::now() + std::chrono::duration<double>(seconds);
+    while (std::chrono::steady_clock::now() < END_TIME) {}
+}
+
+// ---
+// Quits the App after a set number of frames, optionally burning simulation time and feeding extra fixed ticks
+// ---
+struct _FrameLimit : public process::IProcessor {
+    uint32_t frameLimit   = FRAME_COUNT;
+    uint32_t frameCount   = 0;
+    uint64_t tickSum      = 0;
+    double   updateCost   = 0.0;
+    platform::ManualClock* clockPtr = nullptr;
+    uint32_t ticksPerFrame = 1;
+
+protected:
+    void IFixedUpdate() override { this->tickSum += this->frameCount; }
+
+    void IUpdate() override
+    {
+        if (this->updateCost > 0.0) sSpin(this->updateCost);
+        if (this->clockPtr != nullptr) this->clockPtr->Advance(this->ticksPerFrame / static_cast<double>(config::TICKS_PER_SECOND));
+        if (++this->frameCount == this->frameLimit) core::App::GetInstance().Quit();
+    }
+};
+
+// --- Dispatch ---
+// Note: the virtual side calls through the IProcessor vtable, the static side is what StaticProcessor folds into
+
+struct _VirtualCounterBase : public process::IProcessor {
+    uint64_t value = 0;
+
+    void IFixedUpdate() override = 0;
+};
+
+template <size_t INDEX>
+struct _VirtualCounter final : public _VirtualCounterBase {
+    void IFixedUpdate() final { this->value += INDEX + 1; }
+};
+
+template <size_t INDEX>
+struct _StaticCounter {
+    uint64_t value = 0;
+
+    void FixedUpdate() noexcept { this->value += INDEX + 1; }
+};
+
+template <typename SequenceT>
+struct _CounterSet;
+
+template <size_t... INDICES>
+struct _CounterSet<std::index_sequence<INDICES...>> {
+    using StaticTuple = std::tuple<_StaticCounter<INDICES>...>;
+
+    template <typename... ExtraTs>
+    using StaticProcessor = process::StaticProcessor<_StaticCounter<INDICES>..., ExtraTs...>;
+
+    [[nodiscard]] static std::vector<std::unique_ptr<_VirtualCounterBase>> MakeVirtual()
+    {
+        std::vector<std::unique_ptr<_VirtualCounterBase>> processors;
+        (processors.push_back(std::make_unique<_VirtualCounter<INDICES>>()), ...);
+        return processors;
+    }
+};
+
+using _Counters = _CounterSet<std::make_index_sequence<PROCESSOR_COUNT>>;
+
+// ---
+// Runs the virtual counters the way the App runs its single processor
+// ---
+struct _VirtualChain final : public _FrameLimit {
+    std::vector<std::unique_ptr<_VirtualCounterBase>> processors = _Counters::MakeVirtual();
+
+protected:
+    void IFixedUpdate() final
+    {
+        for (const std::unique_ptr<_VirtualCounterBase>& processor : this->processors) processor->IFixedUpdate();
+    }
+};
+
+// Static side of the App level comparison, quits like _FrameLimit
+struct _StaticFrameLimit {
+    uint32_t frameCount = 0;
+
+    void Update() { if (++this->frameCount == FRAME_COUNT) core::App::GetInstance().Quit(); }
+};
+
+struct _StaticDispatchConfig : public core::DefaultAppConfig {
+    static constexpr platform::BackendType BACKEND = platform::BackendType::Headless;
+
+    using Processors = _Counters::StaticProcessor<_StaticFrameLimit>;
+};
+
+DULL_BENCH_SUITE(core_dispatch)
+{
+    std::vector<std::unique_ptr<_VirtualCounterBase>> virtualProcessors = _Counters::MakeVirtual();
+    _Counters::StaticTuple staticProcessors;
+
+    bench.Run("dispatch/virtual_100_processors", DISPATCH_TICKS, [&] {
+        for (uint32_t tick = 0; tick < DISPATCH_TICKS; tick++)
+            for (const std::unique_ptr<_VirtualCounterBase>& processor : virtualProcessors) processor->IFixedUpdate();
+
+        DoNotOptimize(virtualProcessors.front()->value);
+    });
+
+    bench.Run("dispatch/static_100_processors", DISPATCH_TICKS, [&] {
+        for (uint32_t tick = 0; tick < DISPATCH_TICKS; tick++)
+            std::apply([](auto&... processors) { (processors.FixedUpdate(), ...); }, staticProcessors);
+
+        DoNotOptimize(std::get<0>(staticProcessors).value);
+    });
+
+    bench.RunOnce("app/frame_virtual_100_processors", FRAME_COUNT, [] {
+        _VirtualChain chain;
+        core::App app {sHeadlessContext(), &chain};
+        app.Run();
+    });
+
+    bench.RunOnce("app/frame_static_100_processors", FRAME_COUNT, [] {
+        core::StaticApp<_StaticDispatchConfig> app {sHeadlessContext()};
+        app.Run();
+    });
+}
+
+DULL_BENCH_SUITE(core_app)
+{
+    bench.RunOnce("app/frame_empty", FRAME_COUNT, [] {
+        _FrameLimit frameLimit;
+        core::App app {sHeadlessContext(), &frameLimit};
+        app.Run();
+    });
+
+    // The processor moves the clock four ticks per frame, so the scheduler catches up four ticks every frame
+    bench.RunOnce("app/fixed_tick_4_per_frame", FRAME_COUNT * uint64_t {4}, [] {
+        platform::ManualClock clock;
+        _FrameLimit frameLimit;
+        frameLimit.clockPtr      = &clock;
+        frameLimit.ticksPerFrame = 4;
+
+        core::WindowContext windowContext = sHeadlessContext();
+        windowContext.clockPtr = &clock;
+
+        core::App app {windowContext, &frameLimit};
+        app.Run();
+    });
+
+    const std::filesystem::path RECORD_PATH = std::filesystem::temp_directory_path() / "dull_bench.replay";
+
+    bench.RunOnce("replay/frame_recording", FRAME_COUNT, [&RECORD_PATH] {
+        _FrameLimit frameLimit;
+
+        core::WindowContext windowContext = sHeadlessContext();
+        windowContext.recordPath = RECORD_PATH.string();
+
+        core::App app {windowContext, &frameLimit};
+        app.Run();
+    });
+
+    std::error_code error;
+    std::filesystem::remove(RECORD_PATH, error);
+}
+
+// Both sides burn the same simulation and presentation time, pipelining overlaps them
+DULL_BENCH_SUITE(core_pipeline)
+{
+    for (const bool IS_PIPELINED : {false, true})
+    {
+        bench.RunOnce(IS_PIPELINED ? "pipeline/pipelined_1ms_1ms" : "pipeline/serial_1ms_1ms", PIPELINE_FRAMES, [IS_PIPELINED] {
+            _FrameLimit frameLimit;
+            frameLimit.frameLimit = PIPELINE_FRAMES;
+            frameLimit.updateCost = PIPELINE_COST;
+
+            core::WindowContext windowContext = sHeadlessContext();
+            windowContext.isPipelined         = IS_PIPELINED;
+            windowContext.simulatedRenderCost = PIPELINE_COST;
+
+            core::App app {windowContext, &frameLimit};
+            app.Run();
+        });
+    }
+}
+
+// ---
+// Polls a realistic timer population every frame, half of them looping
+// ---
+struct _TimerPoller final : public _FrameLimit {
+    std::vector<component::Timer> timers;
+    uint64_t expiredCount = 0;
+
+protected:
+    void IInit() final
+    {
+        this->timers.reserve(TIMER_COUNT);
+
+        for (uint32_t index = 0; index < TIMER_COUNT; index++)
+        {
+            this->timers.emplace_back(0.05 + (index % 97) * 0.01, index % 2 == 0);
+            this->timers.back().Start();
+        }
+    }
+
+    void IUpdate() final
+    {
+        for (component::Timer& timer : this->timers) this->expiredCount += timer.IsOver();
+
+        _FrameLimit::IUpdate();
+    }
+
+    void IShutdown() final { this->timers.clear(); }
+};
+
+DULL_BENCH_SUITE(core_timer)
+{
+    bench.RunOnce("timer/poll_10k_per_frame", uint64_t {TIMER_FRAMES} * TIMER_COUNT, [] {
+        _TimerPoller poller;
+        poller.frameLimit = TIMER_FRAMES;
+
+        core::App app {sHeadlessContext(), &poller};
+        app.Run();
+
+        DoNotOptimize(poller.expiredCount);
+    });
+}
+
+// ---
+// Resolves its actions once, then queries every one of them each fixed tick and frame
+// ---
+struct _ActionReader final : public _FrameLimit {
+    std::vector<system::ActionId> actions;
+    uint64_t activeCount = 0;
+
+    void CountActive()
+    {
+        const system::InputSystem& inputSystem = core::App::GetInstance().GetInputSystem();
+
+        for (const system::ActionId ACTION_ID : this->actions)
+            this->activeCount += inputSystem.IsActionDown(ACTION_ID) + inputSystem.IsActionPressed(ACTION_ID);
+    }
+
+protected:
+    void IInit() final
+    {
+        system::InputSystem& inputSystem = core::App::GetInstance().GetInputSystem();
+
+        for (uint32_t index = 0; index < ACTION_COUNT; index++)
+        {
+            const system::ActionId ACTION_ID = inputSystem.AddAction(std::format("action_{}", index));
+
+            inputSystem.BindKey(ACTION_ID, 32 + index);
+            inputSystem.BindKey(ACTION_ID, 256 + index);
+            this->actions.push_back(ACTION_ID);
+        }
+    }
+
+    void IFixedUpdate() final { this->CountActive(); }
+
+    void IUpdate() final
+    {
+        this->CountActive();
+        _FrameLimit::IUpdate();
+    }
+};
+
+// A synthetic source walks a held key across the bound range, so actions keep changing state
+DULL_BENCH_SUITE(core_input)
+{
+    bench.RunOnce("input/frame_32_actions", FRAME_COUNT, [] {
+        _ActionReader actionReader;
+        core::App app {sHeadlessContext(), &actionReader};
+
+        uint32_t frame = 0;
+        app.GetInputSystem().SetSource([&frame](platform::InputSnapshot& input) { input.SetKey(32 + frame++ % 64, true); });
+
+        app.Run();
+        DoNotOptimize(actionReader.activeCount);
+    });
+}
@@ -0,0 +1,34 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/ecs/registry.hpp>
+#include <engine/util/vec2.hpp>
+
+#include <cstdint>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+static constexpr uint32_t ENTITY_COUNT = 100'000;
+
+struct _Position { util::Vec2f value; };
+struct _Velocity { util::Vec2f value; };
+
+DULL_BENCH_SUITE(ecs)
+{
+    ecs::Registry registry;
+
+    for (uint32_t index = 0; index < ENTITY_COUNT; index++)
+    {
+        const float VALUE = static_cast<float>(index);
+        (void)registry.Create(_Position {{VALUE, VALUE}}, _Velocity {{1.0F, 0.5F}});
+    }
+
+    bench.Run("ecs/for_each_integrate_100k", ENTITY_COUNT, [&registry] {
+        registry.ForEach<_Position, _Velocity>([](_Position& position, const _Velocity& velocity) {
+            position.value.x += velocity.value.x * 0.016F;
+            position.value.y += velocity.value.y * 0.016F;
+        });
+
+        DoNotOptimize(registry);
+    });
+}
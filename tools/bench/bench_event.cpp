@@ -0,0 +1,72 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/event/event_bus.hpp>
+#include <engine/job/parallel_for.hpp>
+#include <engine/job/thread_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <span>
+#include <string>
+#include <thread>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+static constexpr uint32_t EVENT_COUNT = 10'000;
+static constexpr size_t   PUBLISH_CHUNK_SIZE = 512;
+
+struct _DamageEvent {
+    uint32_t target;
+    float    amount;
+};
+
+DULL_BENCH_SUITE(event)
+{
+    event::EventBus eventBus;
+    double damageSum = 0.0;
+
+    const event::SubscriptionId SUBSCRIPTION_ID = eventBus.Subscribe<_DamageEvent>([&damageSum](std::span<const _DamageEvent> events) {
+        for (const _DamageEvent& event : events) damageSum += event.amount;
+    });
+
+    // Lanes keep their capacity after a dispatch, this measures the steady state of a frame
+    bench.Run("event/publish_dispatch_10k", EVENT_COUNT, [&] {
+        for (uint32_t index = 0; index < EVENT_COUNT; index++) eventBus.Publish(_DamageEvent {index, 1.0F});
+
+        eventBus.Dispatch();
+        DoNotOptimize(damageSum);
+    });
+
+    eventBus.Unsubscribe(SUBSCRIPTION_ID);
+
+    // Same frame published from pool workers, every thread appends to its own lane and Dispatch merges them
+    const uint32_t HARDWARE_THREADS = std::max(std::thread::hardware_concurrency(), 1U);
+
+    for (const uint32_t THREAD_COUNT : {1U, 3U, 7U})
+    {
+        // One worker always runs, the caller publishes beside it, so two lanes are filled on any machine
+        if (THREAD_COUNT > 1 && THREAD_COUNT >= HARDWARE_THREADS) break;
+
+        job::ThreadPool threadPool {THREAD_COUNT};
+        event::EventBus pooledBus {&threadPool};
+        double pooledDamageSum = 0.0;
+
+        const event::SubscriptionId POOLED_ID = pooledBus.Subscribe<_DamageEvent>([&pooledDamageSum](std::span<const _DamageEvent> events) {
+            for (const _DamageEvent& event : events) pooledDamageSum += event.amount;
+        });
+
+        bench.Run(std::format("event/publish_dispatch_10k_{}_workers", THREAD_COUNT), EVENT_COUNT, [&] {
+            job::ParallelFor(threadPool, EVENT_COUNT, [&pooledBus](size_t begin, size_t end) {
+                for (size_t index = begin; index < end; index++) pooledBus.Publish(_DamageEvent {static_cast<uint32_t>(index), 1.0F});
+            }, PUBLISH_CHUNK_SIZE);
+
+            pooledBus.Dispatch();
+            DoNotOptimize(pooledDamageSum);
+        });
+
+        pooledBus.Unsubscribe(POOLED_ID);
+    }
+}
@@ -0,0 +1,79 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/job/async_task.hpp>
+#include <engine/job/coroutine_scheduler.hpp>
+#include <engine/job/parallel_for.hpp>
+#include <engine/job/thread_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+static constexpr uint32_t ITEM_COUNT  = 1'000'000;
+static constexpr uint32_t TASK_COUNT  = 1'000;
+static constexpr uint32_t AWAIT_DEPTH = 1'000;
+
+[[nodiscard]] static job::AsyncTask<uint32_t> sLeaf(uint32_t value) { co_return value + 1; }
+
+// Every await completes synchronously, so this is the cost of a coroutine frame plus the symmetric transfer
+[[nodiscard]] static job::AsyncTask<void> sAwaitChain(uint64_t& sum)
+{
+    for (uint32_t index = 0; index < AWAIT_DEPTH; index++) sum += co_await sLeaf(index);
+}
+
+DULL_BENCH_SUITE(job)
+{
+    std::vector<float> values(ITEM_COUNT, 1.5F);
+
+    const auto BODY = [&values](size_t begin, size_t end) {
+        for (size_t index = begin; index < end; index++) values[index] = std::sqrt(values[index] * values[index] + 1.0F);
+    };
+
+    // Scaling is read against the serial case, the pools only differ in worker count
+    bench.Run("job/serial_for_1m", ITEM_COUNT, [&] {
+        BODY(0, ITEM_COUNT);
+        DoNotOptimize(values.data());
+    });
+
+    const uint32_t HARDWARE_THREADS = std::max(std::thread::hardware_concurrency(), 1U);
+
+    for (const uint32_t THREAD_COUNT : {1U, 3U, 7U})
+    {
+        if (THREAD_COUNT >= HARDWARE_THREADS) break;
+
+        job::ThreadPool threadPool {THREAD_COUNT};
+        const std::string NAME = std::format("job/parallel_for_1m_{}_workers", THREAD_COUNT);
+
+        bench.Run(NAME, ITEM_COUNT, [&] {
+            job::ParallelFor(threadPool, ITEM_COUNT, BODY, 4096);
+            DoNotOptimize(values.data());
+        });
+    }
+
+    job::ThreadPool threadPool;
+
+    bench.Run("job/fork_join_1k_tasks", TASK_COUNT, [&threadPool] {
+        std::atomic<uint32_t> pendingCount {TASK_COUNT};
+
+        for (uint32_t index = 0; index < TASK_COUNT; index++)
+            threadPool.Submit([&pendingCount] { pendingCount.fetch_sub(1, std::memory_order_acq_rel); });
+
+        threadPool.Wait(pendingCount);
+    });
+
+    job::CoroutineScheduler scheduler {&threadPool};
+    uint64_t sum = 0;
+
+    bench.Run("job/coroutine_await", AWAIT_DEPTH, [&] {
+        scheduler.Spawn(sAwaitChain(sum));
+        DoNotOptimize(sum);
+    });
+}
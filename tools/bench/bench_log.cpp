@@ -0,0 +1,39 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/log/async_log.hpp>
+
+#include <cstdint>
+#include <filesystem>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+static constexpr uint32_t RECORD_COUNT = 256;
+
+// Note: records go to a binary file so the log thread doesn't flood stdout, the flush keeps the ring from dropping
+DULL_BENCH_SUITE(log)
+{
+#if DULL_LOG_MIN_LEVEL <= 2
+    const std::filesystem::path LOG_PATH = std::filesystem::temp_directory_path() / "dull_bench.dlog";
+
+    if (!log::AsyncLog::OpenBinaryOutput(LOG_PATH)) return;
+
+    const uint64_t DROPPED_COUNT = log::AsyncLog::GetDroppedCount();
+
+    bench.Run("log/async_info_3_args", RECORD_COUNT, [] {
+        for (uint32_t index = 0; index < RECORD_COUNT; index++)
+            DULL_LOG_INFO("bench", "entity {} moved to {:.2f} after {} ticks", index, index * 0.5F, uint64_t {index} * 3);
+
+        log::AsyncLog::Flush();
+    });
+
+    log::AsyncLog::CloseBinaryOutput();
+
+    zutil::Assert(log::AsyncLog::GetDroppedCount() == DROPPED_COUNT, "Log ring dropped records while benchmarking");
+
+    std::error_code error;
+    std::filesystem::remove(LOG_PATH, error);
+#else
+    (void)bench;
+#endif
+}
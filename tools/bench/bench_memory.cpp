@@ -0,0 +1,46 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/memory/linear_arena.hpp>
+#include <engine/memory/object_pool.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+static constexpr uint32_t OBJECT_COUNT = 10'000;
+
+struct _Particle {
+    std::array<float, 8> values {};
+};
+
+DULL_BENCH_SUITE(memory)
+{
+    std::vector<_Particle*> objects(OBJECT_COUNT);
+
+    bench.Run("memory/heap_new_delete", OBJECT_COUNT, [&objects] {
+        for (_Particle*& objectPtr : objects) objectPtr = new _Particle {};
+        DoNotOptimize(objects.data());
+        for (_Particle* objectPtr : objects) delete objectPtr;
+    });
+
+    memory::LinearArena arena {OBJECT_COUNT * sizeof(_Particle) * 2};
+
+    bench.Run("memory/linear_arena_new_reset", OBJECT_COUNT, [&] {
+        for (_Particle*& objectPtr : objects) objectPtr = arena.New<_Particle>();
+        DoNotOptimize(objects.data());
+        arena.Reset();
+    });
+
+    memory::ObjectPool<_Particle> pool;
+    pool.Reserve(OBJECT_COUNT);
+
+    bench.Run("memory/object_pool_create_destroy", OBJECT_COUNT, [&] {
+        for (_Particle*& objectPtr : objects) objectPtr = pool.Create();
+        DoNotOptimize(objects.data());
+        for (_Particle* objectPtr : objects) pool.Destroy(objectPtr);
+    });
+}
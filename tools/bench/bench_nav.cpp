@@ -0,0 +1,160 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/job/thread_pool.hpp>
+#include <engine/nav/path_service.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+static constexpr int32_t  GRID_SIZE    = 1024;
+static constexpr uint32_t AGENT_COUNT  = 10'000;
+static constexpr uint32_t SQUAD_SIZE   = 100; // agents sharing a start and goal area
+static constexpr int32_t  SQUAD_SPREAD = 24;  // cells
+
+static constexpr std::string_view BUILD_NAME     = "nav/build_1024";
+static constexpr std::string_view SCATTERED_NAME = "nav/queries_10k_scattered";
+static constexpr std::string_view SQUADS_NAME    = "nav/queries_10k_squads";
+static constexpr std::string_view EDIT_NAME      = "nav/edit_rebuild";
+
+[[nodiscard]] static uint32_t sHash(uint32_t x, uint32_t y) noexcept
+{
+    uint32_t hash = x * 0x9E3779B1U ^ y * 0x85EBCA77U;
+    hash ^= hash >> 15;
+    hash *= 0x2C1B3C6DU;
+    hash ^= hash >> 12;
+    return hash;
+}
+
+// One cell in six blocked, plus walls every 128 cells with a door every 64
+[[nodiscard]] static bool sIsBlocked(int32_t x, int32_t y) noexcept
+{
+    const bool IS_WALL = (x % 128 == 64 && y % 64 > 3) || (y % 128 == 64 && x % 64 > 3);
+    return IS_WALL || sHash(static_cast<uint32_t>(x), static_cast<uint32_t>(y)) % 6 == 0;
+}
+
+static void sBlockCells(nav::PathService& service)
+{
+    for (int32_t y = 0; y < GRID_SIZE; y++)
+        for (int32_t x = 0; x < GRID_SIZE; x++)
+            if (sIsBlocked(x, y)) (void)service.SetWalkable(x, y, false);
+}
+
+[[nodiscard]] static util::Vec2i sOpenCell(const nav::NavGrid& grid, int32_t x, int32_t y) noexcept
+{
+    while (!grid.IsWalkable(x, y)) x = (x + 1) % GRID_SIZE;
+    return {x, y};
+}
+
+// Note: 10k agents on a 1024x1024 grid, op/s reads as queries per second, a batch is solved on the pool and waited for
+// Note: scattered agents go anywhere, squads of 100 share a start and goal area so their cluster pairs hit the route cache
+DULL_BENCH_SUITE(nav)
+{
+    if (!bench.IsEnabled(BUILD_NAME) && !bench.IsEnabled(SCATTERED_NAME) && !bench.IsEnabled(SQUADS_NAME) && !bench.IsEnabled(EDIT_NAME))
+        return;
+
+    job::ThreadPool threadPool;
+
+    nav::PathServiceConfig config;
+    config.grid = {GRID_SIZE, GRID_SIZE, 32};
+
+    bench.Run(BUILD_NAME, 1, [&] {
+        nav::PathService service {config, &threadPool};
+        sBlockCells(service);
+        service.Update();
+        DoNotOptimize(service.GetStats().nodeCount);
+    });
+
+    nav::PathService service {config, &threadPool};
+    sBlockCells(service);
+    service.Update();
+
+    const nav::NavGrid& GRID = service.GetGrid();
+    std::vector<nav::PathQuery> scattered;
+    std::vector<nav::PathQuery> squads;
+
+    for (uint32_t agent = 0; agent < AGENT_COUNT; agent++)
+    {
+        const uint32_t HASH  = sHash(agent, 1);
+        const uint32_t SQUAD = agent / SQUAD_SIZE;
+
+        scattered.push_back({
+            sOpenCell(GRID, static_cast<int32_t>(HASH % GRID_SIZE), static_cast<int32_t>(HASH / GRID_SIZE % GRID_SIZE)),
+            sOpenCell(GRID, static_cast<int32_t>(sHash(agent, 2) % GRID_SIZE), static_cast<int32_t>(sHash(agent, 3) % GRID_SIZE)),
+        });
+
+        const int32_t START_X = static_cast<int32_t>(sHash(SQUAD, 4) % (GRID_SIZE - SQUAD_SPREAD));
+        const int32_t START_Y = static_cast<int32_t>(sHash(SQUAD, 5) % (GRID_SIZE - SQUAD_SPREAD));
+        const int32_t GOAL_X  = static_cast<int32_t>(sHash(SQUAD, 6) % (GRID_SIZE - SQUAD_SPREAD));
+        const int32_t GOAL_Y  = static_cast<int32_t>(sHash(SQUAD, 7) % (GRID_SIZE - SQUAD_SPREAD));
+
+        squads.push_back({
+            sOpenCell(GRID, START_X + static_cast<int32_t>(HASH % SQUAD_SPREAD), START_Y + static_cast<int32_t>(HASH / 32 % SQUAD_SPREAD)),
+            sOpenCell(GRID, GOAL_X + static_cast<int32_t>(HASH / 1024 % SQUAD_SPREAD), GOAL_Y + static_cast<int32_t>(HASH / 32768 % SQUAD_SPREAD)),
+        });
+    }
+
+    uint64_t foundCount = 0;
+    uint64_t cellCount  = 0;
+
+    const auto COUNT_RESULTS = [&foundCount, &cellCount](std::span<const nav::PathResult> results) {
+        for (const nav::PathResult& RESULT : results)
+        {
+            foundCount += RESULT.isFound ? 1 : 0;
+            cellCount  += RESULT.cells.size();
+        }
+    };
+
+    // Without a cache every query runs the abstract search
+    nav::PathServiceConfig uncachedConfig = config;
+    uncachedConfig.cacheCapacity = 0;
+
+    nav::PathService uncachedService {uncachedConfig, &threadPool};
+    sBlockCells(uncachedService);
+    uncachedService.Update();
+
+    bench.Run(SCATTERED_NAME, AGENT_COUNT, [&] {
+        uncachedService.Submit(scattered, COUNT_RESULTS);
+        uncachedService.WaitAll();
+    });
+
+    const nav::PathStats BEFORE = service.GetStats();
+    foundCount = 0;
+    cellCount  = 0;
+
+    bench.Run(SQUADS_NAME, AGENT_COUNT, [&] {
+        service.Submit(squads, COUNT_RESULTS);
+        service.WaitAll();
+    });
+
+    const nav::PathStats AFTER = service.GetStats();
+    const uint64_t LOOKUP_COUNT = AFTER.cacheHitCount + AFTER.cacheMissCount - BEFORE.cacheHitCount - BEFORE.cacheMissCount;
+
+    if (bench.IsEnabled(SQUADS_NAME))
+    {
+        bench.Log(zutil::INFO, {
+            "nav: {} entrances, {:.1f}% of squad lookups hit the cache, {:.1f} cells per path, {:.2f}% found",
+            AFTER.nodeCount,
+            LOOKUP_COUNT == 0 ? 0.0 : 100.0 * static_cast<double>(AFTER.cacheHitCount - BEFORE.cacheHitCount) / LOOKUP_COUNT,
+            foundCount == 0 ? 0.0 : static_cast<double>(cellCount) / foundCount,
+            100.0 * static_cast<double>(AFTER.foundCount - BEFORE.foundCount) / std::max<uint64_t>(AFTER.queryCount - BEFORE.queryCount, 1)
+        });
+    }
+
+    // A door opening and closing again, only the clusters around it are rebuilt
+    uint32_t editIndex = 0;
+
+    bench.Run(EDIT_NAME, 1, [&] {
+        const int32_t X = 64 + 128 * static_cast<int32_t>(editIndex / 2 % 8);
+        (void)service.SetWalkable(X, 2, editIndex++ % 2 != 0);
+        service.Update();
+    });
+
+    if (bench.IsEnabled(EDIT_NAME))
+        bench.Log(zutil::INFO, {"nav: an edit rebuilds {} clusters in {:.3f} ms", service.GetStats().rebuiltClusterCount, service.GetStats().rebuildMs});
+}
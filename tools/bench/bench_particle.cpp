@@ -0,0 +1,65 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/config.hpp>
+#include <engine/job/thread_pool.hpp>
+#include <engine/particle/particle_system.hpp>
+#include <engine/render/render_queue.hpp>
+
+#include <cstdint>
+#include <format>
+#include <string>
+#include <utility>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+static constexpr float TICK_INTERVAL  = 1.0F / config::TICKS_PER_SECOND;
+static constexpr float MEAN_LIFETIME  = 1.5F;
+static constexpr uint32_t WARMUP_TICKS = 2 * config::TICKS_PER_SECOND;
+
+// Note: op/s divided by 1000 reads as particles per millisecond
+// Note: the spawn rate matches the death rate at the particle count, so every tick also compacts and spawns
+DULL_BENCH_SUITE(particle)
+{
+    job::ThreadPool threadPool;
+
+    for (const auto& [PARTICLE_COUNT, LABEL] : {std::pair {100'000U, "100k"}, std::pair {500'000U, "500k"}, std::pair {1'000'000U, "1m"}})
+    {
+        const std::string SIMULATE_NAME = std::format("particle/simulate_{}", LABEL);
+        const std::string SUBMIT_NAME   = std::format("particle/submit_{}", LABEL);
+
+        if (!bench.IsEnabled(SIMULATE_NAME) && !bench.IsEnabled(SUBMIT_NAME)) continue;
+
+        particle::EmitterConfig config;
+        config.capacity     = PARTICLE_COUNT;
+        config.position     = {960.0F, 540.0F};
+        config.spawnExtent  = {32.0F, 32.0F};
+        config.velocityMin  = {-200.0F, -300.0F};
+        config.velocityMax  = {200.0F, -100.0F};
+        config.acceleration = {0.0F, 250.0F};
+        config.lifetimeMin  = MEAN_LIFETIME - 0.5F;
+        config.lifetimeMax  = MEAN_LIFETIME + 0.5F;
+        config.spawnRate    = PARTICLE_COUNT / MEAN_LIFETIME;
+        config.bounds       = util::Rect {-1000.0F, -1000.0F, 4000.0F, 4000.0F};
+        config.startColor   = {255, 180, 40, 255};
+        config.endColor     = {200, 30, 10, 0};
+
+        particle::ParticleSystem particleSystem {&threadPool};
+        particle::ParticleEmitter& emitter = particleSystem.AddEmitter(config);
+
+        (void)emitter.Emit(PARTICLE_COUNT);
+        for (uint32_t tick = 0; tick < WARMUP_TICKS; tick++) particleSystem.Simulate(TICK_INTERVAL);
+
+        bench.Run(SIMULATE_NAME, PARTICLE_COUNT, [&particleSystem] {
+            particleSystem.Simulate(TICK_INTERVAL);
+            DoNotOptimize(particleSystem);
+        });
+
+        render::RenderQueue renderQueue {&threadPool};
+
+        bench.Run(SUBMIT_NAME, PARTICLE_COUNT, [&] {
+            particleSystem.Submit(renderQueue);
+            renderQueue.Clear();
+        });
+    }
+}
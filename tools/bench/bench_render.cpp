@@ -0,0 +1,57 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/job/thread_pool.hpp>
+#include <engine/render/render_batch.hpp>
+#include <engine/render/render_queue.hpp>
+#include <engine/util/color_rgba.hpp>
+#include <engine/util/rect.hpp>
+
+#include <array>
+#include <cstdint>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+static constexpr uint32_t SPRITE_COUNT  = 10'000;
+static constexpr uint32_t TEXTURE_COUNT = 8;
+static constexpr uint32_t LAYER_COUNT   = 4;
+
+// A typical frame: sprites of a few atlases spread across a few layers, submitted out of order
+static void sSubmitFrame(render::RenderQueue& renderQueue, const std::array<render::Texture, TEXTURE_COUNT>& textures)
+{
+    for (uint32_t index = 0; index < SPRITE_COUNT; index++)
+    {
+        const float X = static_cast<float>(index % 128) * 8.0F;
+        const float Y = static_cast<float>(index / 128) * 8.0F;
+
+        renderQueue.SubmitSprite(
+            textures[(index * 7) % TEXTURE_COUNT],
+            {0.0F, 0.0F, 16.0F, 16.0F},
+            {X, Y, 16.0F, 16.0F},
+            util::Color::White(),
+            static_cast<int16_t>(index % LAYER_COUNT)
+        );
+    }
+}
+
+DULL_BENCH_SUITE(render)
+{
+    std::array<render::Texture, TEXTURE_COUNT> textures;
+
+    for (uint32_t index = 0; index < TEXTURE_COUNT; index++) textures[index] = {index + 1, 256, 256};
+
+    render::RenderQueue renderQueue;
+    render::RenderBatchList batchList;
+
+    bench.Run("render/submit_10k_sprites", SPRITE_COUNT, [&] {
+        sSubmitFrame(renderQueue, textures);
+        renderQueue.Clear();
+    });
+
+    bench.Run("render/submit_flush_10k_sprites", SPRITE_COUNT, [&] {
+        sSubmitFrame(renderQueue, textures);
+        batchList.Clear();
+        renderQueue.Flush(batchList);
+        DoNotOptimize(batchList);
+    });
+}
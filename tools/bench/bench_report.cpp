@@ -0,0 +1,290 @@
+#include "tools/bench/bench_report.hpp"
+
+#include <engine/util/color_batch.hpp>
+#include <engine/util/vec2_batch.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+
+namespace dull::bench {
+
+static constexpr uint32_t SCHEMA_VERSION = 1;
+
+// Allocation counts are integers per run, this only absorbs float noise of the per op division
+static constexpr double ALLOCATION_TOLERANCE = 1e-9;
+
+[[nodiscard]] static std::string sEscape(std::string_view text)
+{
+    std::string escaped;
+
+    for (const char CHARACTER : text)
+    {
+        if (CHARACTER == '"' || CHARACTER == '\\') escaped.push_back('\\');
+        escaped.push_back(CHARACTER);
+    }
+
+    return escaped;
+}
+
+// Shortest round-tripping form, JSON has no inf or nan so those become null
+[[nodiscard]] static std::string sNumber(double value)
+{
+    if (!std::isfinite(value)) return "null";
+
+    char buffer[32];
+    const auto [END, ERROR] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+    return ERROR == std::errc {} ? std::string {buffer, END} : "null";
+}
+
+[[nodiscard]] bool WriteJson(const std::string& path, const std::vector<BenchResult>& results)
+{
+    std::ofstream stream {path, std::ios::trunc};
+
+    if (!stream) return false;
+
+#if defined(NDEBUG)
+    constexpr std::string_view BUILD_TYPE = "release";
+#else
+    constexpr std::string_view BUILD_TYPE = "debug";
+#endif
+
+    stream << "{\n";
+    stream << "  \"schema\": " << SCHEMA_VERSION << ",\n";
+    stream << "  \"build\": {"
+        << "\"type\": \"" << BUILD_TYPE << "\", "
+        << "\"heap_tracking\": " << (memory::IS_HEAP_TRACKING_ENABLED ? "true" : "false") << ", "
+        << "\"vec2_isa\": \"" << util::batch::GetVec2InstructionSet() << "\", "
+        << "\"color_isa\": \"" << util::batch::GetColorInstructionSet() << "\""
+        << "},\n";
+    stream << "  \"benchmarks\": [\n";
+
+    for (size_t index = 0; index < results.size(); index++)
+    {
+        const BenchResult& result = results[index];
+
+        stream << "    {"
+            << "\"name\": \"" << sEscape(result.name) << "\", "
+            << "\"ns_per_op\": " << sNumber(result.nsPerOp) << ", "
+            << "\"ops_per_sec\": " << sNumber(result.opsPerSecond) << ", "
+            << "\"allocs_per_op\": " << (result.allocationsPerOp < 0.0 ? "null" : sNumber(result.allocationsPerOp)) << ", "
+            << "\"ops\": " << result.operationCount
+            << (index + 1 < results.size() ? "},\n" : "}\n");
+    }
+
+    stream << "  ]\n}\n";
+    return static_cast<bool>(stream.flush());
+}
+
+// --- Reading ---
+// Note: just enough JSON for the files WriteJson produces, or hand edited versions of them
+
+struct _JsonCursor {
+    std::string_view text;
+    size_t position = 0;
+
+    void SkipSpace() noexcept
+    {
+        while (this->position < this->text.size() && std::isspace(static_cast<unsigned char>(this->text[this->position]))) this->position++;
+    }
+
+    [[nodiscard]] bool Consume(char character) noexcept
+    {
+        this->SkipSpace();
+
+        if (this->position >= this->text.size() || this->text[this->position] != character) return false;
+
+        this->position++;
+        return true;
+    }
+
+    [[nodiscard]] bool ReadString(std::string& out)
+    {
+        if (!this->Consume('"')) return false;
+
+        out.clear();
+
+        while (this->position < this->text.size() && this->text[this->position] != '"')
+        {
+            if (this->text[this->position] == '\\') this->position++;
+            if (this->position < this->text.size()) out.push_back(this->text[this->position++]);
+        }
+
+        return this->Consume('"');
+    }
+
+    // null reads as -1, the "not measured" value of BenchResult
+    [[nodiscard]] bool ReadNumber(double& out) noexcept
+    {
+        this->SkipSpace();
+
+        if (this->text.substr(this->position, 4) == "null")
+        {
+            this->position += 4;
+            out = -1.0;
+            return true;
+        }
+
+        const char* begin = this->text.data() + this->position;
+        const auto [END, ERROR] = std::from_chars(begin, this->text.data() + this->text.size(), out);
+
+        if (ERROR != std::errc {}) return false;
+
+        this->position += static_cast<size_t>(END - begin);
+        return true;
+    }
+
+    // Skips one value of any kind, nested containers included
+    [[nodiscard]] bool SkipValue()
+    {
+        this->SkipSpace();
+
+        if (this->position >= this->text.size()) return false;
+
+        const char FIRST = this->text[this->position];
+
+        if (FIRST == '"')
+        {
+            std::string ignored;
+            return this->ReadString(ignored);
+        }
+
+        if (FIRST != '{' && FIRST != '[')
+        {
+            while (this->position < this->text.size() && std::string_view {",}]"}.find(this->text[this->position]) == std::string_view::npos)
+                this->position++;
+
+            return true;
+        }
+
+        uint32_t depth = 0;
+        bool isInString = false;
+
+        for (; this->position < this->text.size(); this->position++)
+        {
+            const char CHARACTER = this->text[this->position];
+
+            if (isInString)
+            {
+                if (CHARACTER == '\\') this->position++;
+                else if (CHARACTER == '"') isInString = false;
+                continue;
+            }
+
+            if (CHARACTER == '"') isInString = true;
+            else if (CHARACTER == '{' || CHARACTER == '[') depth++;
+            else if ((CHARACTER == '}' || CHARACTER == ']') && --depth == 0)
+            {
+                this->position++;
+                return true;
+            }
+        }
+
+        return false;
+    }
+};
+
+[[nodiscard]] static bool sReadResult(_JsonCursor& cursor, BenchResult& result)
+{
+    if (!cursor.Consume('{')) return false;
+    if (cursor.Consume('}')) return true;
+
+    std::string key;
+
+    do {
+        if (!cursor.ReadString(key) || !cursor.Consume(':')) return false;
+
+        double number = 0.0;
+        bool isRead = true;
+
+        if      (key == "name"         ) isRead = cursor.ReadString(result.name);
+        else if (key == "ns_per_op"    ) isRead = cursor.ReadNumber(result.nsPerOp);
+        else if (key == "ops_per_sec"  ) isRead = cursor.ReadNumber(result.opsPerSecond);
+        else if (key == "allocs_per_op") isRead = cursor.ReadNumber(result.allocationsPerOp);
+        else if (key == "ops"          )
+        {
+            isRead = cursor.ReadNumber(number);
+            result.operationCount = static_cast<uint64_t>(std::max(number, 0.0));
+        }
+        else isRead = cursor.SkipValue();
+
+        if (!isRead) return false;
+    } while (cursor.Consume(','));
+
+    return cursor.Consume('}');
+}
+
+[[nodiscard]] bool ReadJson(const std::string& path, std::vector<BenchResult>& results)
+{
+    std::ifstream stream {path};
+
+    if (!stream) return false;
+
+    std::stringstream buffer;
+    buffer << stream.rdbuf();
+
+    const std::string TEXT = buffer.str();
+    _JsonCursor cursor {TEXT};
+    std::string key;
+
+    if (!cursor.Consume('{')) return false;
+
+    do {
+        if (!cursor.ReadString(key) || !cursor.Consume(':')) return false;
+
+        if (key != "benchmarks")
+        {
+            if (!cursor.SkipValue()) return false;
+            continue;
+        }
+
+        if (!cursor.Consume('[')) return false;
+        if (cursor.Consume(']')) continue;
+
+        do {
+            BenchResult result;
+
+            if (!sReadResult(cursor, result)) return false;
+
+            results.push_back(std::move(result));
+        } while (cursor.Consume(','));
+
+        if (!cursor.Consume(']')) return false;
+    } while (cursor.Consume(','));
+
+    return cursor.Consume('}');
+}
+
+// --- Comparison ---
+
+[[nodiscard]] std::vector<BenchRegression> FindRegressions(
+    const std::vector<BenchResult>& baseline,
+    const std::vector<BenchResult>& current,
+    double maxRegressionPercent
+)
+{
+    std::vector<BenchRegression> regressions;
+
+    for (const BenchResult& result : current)
+    {
+        const auto FOUND = std::ranges::find(baseline, result.name, &BenchResult::name);
+
+        if (FOUND == baseline.end()) continue;
+
+        if (FOUND->nsPerOp > 0.0 && result.nsPerOp > FOUND->nsPerOp * (1.0 + maxRegressionPercent / 100.0))
+            regressions.push_back({result.name, "ns_per_op", FOUND->nsPerOp, result.nsPerOp});
+
+        if (FOUND->allocationsPerOp >= 0.0 && result.allocationsPerOp > FOUND->allocationsPerOp + ALLOCATION_TOLERANCE)
+            regressions.push_back({result.name, "allocs_per_op", FOUND->allocationsPerOp, result.allocationsPerOp});
+    }
+
+    return regressions;
+}
+
+} // namespace dull::bench
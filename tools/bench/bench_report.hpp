@@ -0,0 +1,37 @@
+#pragma once
+
+#include "tools/bench/bench.hpp"
+
+#include <string>
+#include <vector>
+
+namespace dull::bench {
+
+// ---
+// Metric of a case that got worse than the allowed threshold against a baseline
+// ---
+struct BenchRegression final {
+    std::string name;
+    std::string metric;
+    double baseline = 0.0;
+    double current  = 0.0;
+};
+
+// Note: one case per line, {"schema", "build", "benchmarks": [{"name", "ns_per_op", "ops_per_sec", "allocs_per_op", "ops"}]}
+[[nodiscard]] bool WriteJson(const std::string& path, const std::vector<BenchResult>& results);
+
+// Reads the benchmarks array back, other keys are ignored
+[[nodiscard]] bool ReadJson(const std::string& path, std::vector<BenchResult>& results);
+
+// ---
+// Compares current results against a baseline
+// Note: ns/op regresses past maxRegressionPercent, allocations regress on any increase when both sides tracked them
+// Note: cases missing from either side are not compared
+// ---
+[[nodiscard]] std::vector<BenchRegression> FindRegressions(
+    const std::vector<BenchResult>& baseline,
+    const std::vector<BenchResult>& current,
+    double maxRegressionPercent
+);
+
+} // namespace dull::bench
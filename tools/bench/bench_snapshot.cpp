@@ -0,0 +1,125 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/ecs/registry.hpp>
+#include <engine/serial/snapshot_reader.hpp>
+#include <engine/serial/snapshot_writer.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+struct _SerialPosition {
+    util::Vec2f value;
+};
+
+struct _SerialVelocity {
+    util::Vec2f value;
+};
+
+template <>
+struct serial::SerialTraits<_SerialPosition> {
+    static constexpr std::string_view NAME = "bench.position";
+    static constexpr auto FIELDS = std::tuple {&_SerialPosition::value};
+};
+
+template <>
+struct serial::SerialTraits<_SerialVelocity> {
+    static constexpr std::string_view NAME = "bench.velocity";
+    static constexpr auto FIELDS = std::tuple {&_SerialVelocity::value};
+};
+
+static constexpr uint32_t ENTITY_COUNT    = 500'000;
+static constexpr uint32_t COMPONENT_COUNT = 2 * ENTITY_COUNT;
+static constexpr uint32_t CHANGED_STRIDE  = 100; // incremental saves see one entity in a hundred moved
+
+static constexpr std::string_view SAVE_FULL_NAME        = "snapshot/save_full_1m";
+static constexpr std::string_view SAVE_INCREMENTAL_NAME = "snapshot/save_incremental_1m";
+static constexpr std::string_view LOAD_NAME             = "snapshot/load_full_1m";
+static constexpr std::string_view RESTORE_NAME          = "snapshot/restore_1m";
+
+// Note: 500k entities with a position and a velocity, saves include the background encode and file write
+// Note: the main thread stall of a save (the capture) and the file sizes are logged, op/s counts components
+DULL_BENCH_SUITE(snapshot)
+{
+    if (!bench.IsEnabled(SAVE_FULL_NAME) && !bench.IsEnabled(SAVE_INCREMENTAL_NAME) && !bench.IsEnabled(LOAD_NAME) && !bench.IsEnabled(RESTORE_NAME))
+        return;
+
+    const std::filesystem::path ROOT = std::filesystem::temp_directory_path() / "dull_bench_snapshots";
+    const std::string FULL_PATH        = (ROOT / "full.snap").string();
+    const std::string INCREMENTAL_PATH = (ROOT / "incremental.snap").string();
+
+    std::error_code error;
+    std::filesystem::create_directories(ROOT, error);
+
+    serial::SnapshotSchema schema;
+    schema.Register<_SerialPosition>();
+    schema.Register<_SerialVelocity>();
+
+    ecs::Registry registry;
+    std::vector<ecs::Entity> entities;
+    entities.reserve(ENTITY_COUNT);
+
+    for (uint32_t index = 0; index < ENTITY_COUNT; index++)
+    {
+        const float COLUMN = static_cast<float>(index % 1000);
+        const float ROW    = static_cast<float>(index / 1000);
+
+        entities.push_back(registry.Create(_SerialPosition {{COLUMN * 8.0F, ROW * 8.0F}}, _SerialVelocity {{0.0F, 1.0F}}));
+    }
+
+    serial::SnapshotWriter writer {schema};
+
+    bench.Run(SAVE_FULL_NAME, COMPONENT_COUNT, [&] {
+        (void)writer.Save(registry, FULL_PATH, serial::SnapshotKind::Full);
+        writer.Wait();
+    });
+
+    const serial::SnapshotStats FULL_STATS = writer.GetStats();
+    zutil::Assert(!FULL_STATS.hasFailed, "Benchmark snapshot failed to save");
+
+    uint32_t frame = 0;
+
+    bench.Run(SAVE_INCREMENTAL_NAME, COMPONENT_COUNT, [&] {
+        frame++;
+
+        for (uint32_t index = frame % CHANGED_STRIDE; index < ENTITY_COUNT; index += CHANGED_STRIDE)
+            registry.Get<_SerialPosition>(entities[index]).value.y += 1.0F;
+
+        (void)writer.Save(registry, INCREMENTAL_PATH, serial::SnapshotKind::Incremental);
+        writer.Wait();
+    });
+
+    const serial::SnapshotStats INCREMENTAL_STATS = writer.GetStats();
+
+    bench.Log(zutil::INFO, {
+        "snapshot: full save {} bytes ({:.2f} bytes/component), incremental {} bytes, main thread capture {:.2f} ms",
+        FULL_STATS.byteSize,
+        static_cast<double>(FULL_STATS.byteSize) / COMPONENT_COUNT,
+        INCREMENTAL_STATS.byteSize,
+        INCREMENTAL_STATS.captureMs
+    });
+
+    (void)writer.Save(registry, FULL_PATH, serial::SnapshotKind::Full);
+    writer.Wait();
+
+    serial::SnapshotReader reader {schema};
+
+    bench.Run(LOAD_NAME, COMPONENT_COUNT, [&] {
+        zutil::Assert(reader.Load(FULL_PATH), "Benchmark snapshot failed to load");
+    });
+
+    bench.Run(RESTORE_NAME, COMPONENT_COUNT, [&] {
+        ecs::Registry restored;
+        reader.Restore(restored);
+        DoNotOptimize(restored.GetEntityCount());
+    });
+
+    std::filesystem::remove_all(ROOT, error);
+}
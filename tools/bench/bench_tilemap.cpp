@@ -0,0 +1,105 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/render/render_queue.hpp>
+#include <engine/tilemap/tile_map.hpp>
+
+#include <cstdint>
+#include <format>
+#include <span>
+#include <string>
+#include <utility>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+static constexpr float TILE_SIZE     = 16.0F;
+static constexpr float VIEW_WIDTH    = 1920.0F;
+static constexpr float VIEW_HEIGHT   = 1080.0F;
+static constexpr float PAN_PER_FRAME = 6.0F;
+
+// Procedural terrain, roughly a third of the tiles empty
+struct _NoiseTileSource final : public tilemap::ITileSource {
+    void ILoadChunk(tilemap::ChunkCoord coord, std::span<tilemap::TileId> tiles) override
+    {
+        for (uint32_t index = 0; index < tiles.size(); index++)
+        {
+            uint32_t hash = static_cast<uint32_t>(coord.x) * 0x9E3779B1U ^ static_cast<uint32_t>(coord.y) * 0x85EBCA77U ^ index * 0xC2B2AE3DU;
+            hash ^= hash >> 15;
+            hash *= 0x2C1B3C6DU;
+            hash ^= hash >> 12;
+
+            tiles[index] = static_cast<tilemap::TileId>(hash % 24 < 8 ? tilemap::EMPTY_TILE : 1 + hash % 64);
+        }
+    }
+};
+
+// Note: frame pans the camera diagonally across the map, so chunks keep streaming in and out
+// Note: frame cost should stay flat from the 1k to the 10k map
+DULL_BENCH_SUITE(tilemap)
+{
+    render::RenderQueue renderQueue;
+
+    for (const auto& [MAP_SIZE, LABEL] : {std::pair {1'000, "1k"}, std::pair {10'000, "10k"}})
+    {
+        const std::string FRAME_NAME  = std::format("tilemap/frame_{}", LABEL);
+        const std::string LOOKUP_NAME = std::format("tilemap/get_tile_{}", LABEL);
+        const std::string EDIT_NAME   = std::format("tilemap/edit_in_view_{}", LABEL);
+
+        if (!bench.IsEnabled(FRAME_NAME) && !bench.IsEnabled(LOOKUP_NAME) && !bench.IsEnabled(EDIT_NAME)) continue;
+
+        _NoiseTileSource source;
+
+        tilemap::TileMapConfig config;
+        config.width           = MAP_SIZE;
+        config.height          = MAP_SIZE;
+        config.tileSize        = TILE_SIZE;
+        config.tileset.columns = 8;
+
+        tilemap::TileMap tileMap {config, source};
+
+        const float TRAVEL = MAP_SIZE * TILE_SIZE - VIEW_WIDTH;
+        float panOffset = 0.0F;
+
+        bench.Run(FRAME_NAME, 1, [&] {
+            panOffset = panOffset + PAN_PER_FRAME < TRAVEL ? panOffset + PAN_PER_FRAME : 0.0F;
+
+            const util::Rect CAMERA = {panOffset, panOffset * 0.5F, VIEW_WIDTH, VIEW_HEIGHT};
+
+            tileMap.Stream(CAMERA);
+            tileMap.Submit(renderQueue, CAMERA);
+            renderQueue.Clear();
+        });
+
+        const util::Rect CAMERA = {0.0F, 0.0F, VIEW_WIDTH, VIEW_HEIGHT};
+        tileMap.Stream(CAMERA);
+
+        // Lookups stay inside the resident chunks
+        const int32_t VIEW_TILES_X = static_cast<int32_t>(VIEW_WIDTH / TILE_SIZE);
+        const int32_t VIEW_TILES_Y = static_cast<int32_t>(VIEW_HEIGHT / TILE_SIZE);
+        uint32_t lookupState = 1;
+
+        bench.Run(LOOKUP_NAME, 1024, [&] {
+            uint32_t checksum = 0;
+
+            for (uint32_t lookup = 0; lookup < 1024; lookup++)
+            {
+                lookupState = lookupState * 1664525U + 1013904223U;
+                const int32_t X = static_cast<int32_t>((lookupState >> 8) % VIEW_TILES_X);
+                const int32_t Y = static_cast<int32_t>((lookupState >> 20) % VIEW_TILES_Y);
+                checksum += tileMap.GetTile(X, Y);
+            }
+
+            DoNotOptimize(checksum);
+        });
+
+        // One edit per frame, only the touched chunk is rebuilt
+        uint32_t editIndex = 0;
+
+        bench.Run(EDIT_NAME, 1, [&] {
+            editIndex++;
+            (void)tileMap.SetTile(static_cast<int32_t>(editIndex % VIEW_TILES_X), 8, static_cast<tilemap::TileId>(1 + editIndex % 64));
+            tileMap.Submit(renderQueue, CAMERA);
+            renderQueue.Clear();
+        });
+    }
+}
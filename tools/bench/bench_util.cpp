@@ -0,0 +1,172 @@
+#include "tools/bench/bench.hpp"
+
+#include <engine/util/color_batch.hpp>
+#include <engine/util/color_rgba.hpp>
+#include <engine/util/rect.hpp>
+#include <engine/util/vec2.hpp>
+#include <engine/util/vec2_batch.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace dull;
+using bench::DoNotOptimize;
+
+static constexpr size_t VECTOR_COUNT = 1'000'000;
+static constexpr size_t PIXEL_COUNT  = 3840 * 2160; // one 4K frame
+static constexpr size_t RECT_COUNT   = 10'000;
+
+[[nodiscard]] static std::vector<util::Vec2f> sRandomVectors(size_t count, uint32_t seed)
+{
+    std::mt19937 random {seed};
+    std::uniform_real_distribution<float> distribution {-1000.0F, 1000.0F};
+    std::vector<util::Vec2f> vectors(count);
+
+    for (util::Vec2f& vector : vectors) vector = {distribution(random), distribution(random)};
+
+    return vectors;
+}
+
+[[nodiscard]] static std::vector<util::Color> sRandomColors(size_t count, uint32_t seed)
+{
+    std::mt19937 random {seed};
+    std::vector<util::Color> colors(count);
+
+    for (util::Color& color : colors)
+    {
+        const uint32_t BITS = random();
+        color = {static_cast<uint8_t>(BITS), static_cast<uint8_t>(BITS >> 8), static_cast<uint8_t>(BITS >> 16), static_cast<uint8_t>(BITS >> 24)};
+    }
+
+    return colors;
+}
+
+// Operator loops are what the batch kernels replace, both sides run over the same buffers
+DULL_BENCH_SUITE(util_vec2)
+{
+    const std::vector<util::Vec2f> LHS = sRandomVectors(VECTOR_COUNT, 1);
+    const std::vector<util::Vec2f> RHS = sRandomVectors(VECTOR_COUNT, 2);
+    std::vector<util::Vec2f> out(VECTOR_COUNT);
+    std::vector<float> lengths(VECTOR_COUNT);
+
+    bench.Run("vec2/add_operator_1m", VECTOR_COUNT, [&] {
+        for (size_t index = 0; index < VECTOR_COUNT; index++) out[index] = LHS[index] + RHS[index];
+        DoNotOptimize(out.data());
+    });
+
+    bench.Run("vec2/add_batch_1m", VECTOR_COUNT, [&] {
+        util::batch::Add(LHS, RHS, out);
+        DoNotOptimize(out.data());
+    });
+
+    bench.Run("vec2/normalize_operator_1m", VECTOR_COUNT, [&] {
+        for (size_t index = 0; index < VECTOR_COUNT; index++) out[index] = LHS[index].Normalized();
+        DoNotOptimize(out.data());
+    });
+
+    bench.Run("vec2/normalize_batch_1m", VECTOR_COUNT, [&] {
+        util::batch::Normalize(LHS, out);
+        DoNotOptimize(out.data());
+    });
+
+    bench.Run("vec2/length_operator_1m", VECTOR_COUNT, [&] {
+        for (size_t index = 0; index < VECTOR_COUNT; index++) lengths[index] = LHS[index].Length();
+        DoNotOptimize(lengths.data());
+    });
+
+    bench.Run("vec2/length_batch_1m", VECTOR_COUNT, [&] {
+        util::batch::Length(LHS, lengths);
+        DoNotOptimize(lengths.data());
+    });
+}
+
+DULL_BENCH_SUITE(util_color)
+{
+    const std::vector<util::Color> SOURCE      = sRandomColors(PIXEL_COUNT, 3);
+    const std::vector<util::Color> DESTINATION = sRandomColors(PIXEL_COUNT, 4);
+    std::vector<util::Color> out(PIXEL_COUNT);
+    std::vector<util::batch::LinearColor> linear(PIXEL_COUNT);
+
+    bench.Run("color/add_operator_4k", PIXEL_COUNT, [&] {
+        for (size_t index = 0; index < PIXEL_COUNT; index++) out[index] = SOURCE[index] + DESTINATION[index];
+        DoNotOptimize(out.data());
+    });
+
+    bench.Run("color/add_batch_4k", PIXEL_COUNT, [&] {
+        util::batch::Add(SOURCE, DESTINATION, out);
+        DoNotOptimize(out.data());
+    });
+
+    bench.Run("color/multiply_operator_4k", PIXEL_COUNT, [&] {
+        for (size_t index = 0; index < PIXEL_COUNT; index++) out[index] = SOURCE[index] * DESTINATION[index];
+        DoNotOptimize(out.data());
+    });
+
+    bench.Run("color/multiply_batch_4k", PIXEL_COUNT, [&] {
+        util::batch::Multiply(SOURCE, DESTINATION, out);
+        DoNotOptimize(out.data());
+    });
+
+    bench.Run("color/grayscale_operator_4k", PIXEL_COUNT, [&] {
+        for (size_t index = 0; index < PIXEL_COUNT; index++) out[index] = SOURCE[index].Grayscaled();
+        DoNotOptimize(out.data());
+    });
+
+    bench.Run("color/grayscale_batch_4k", PIXEL_COUNT, [&] {
+        util::batch::Grayscale(SOURCE, out);
+        DoNotOptimize(out.data());
+    });
+
+    bench.Run("color/blend_over_batch_4k", PIXEL_COUNT, [&] {
+        util::batch::BlendOver(SOURCE, DESTINATION, out);
+        DoNotOptimize(out.data());
+    });
+
+    bench.Run("color/premultiply_batch_4k", PIXEL_COUNT, [&] {
+        util::batch::Premultiply(SOURCE, out);
+        DoNotOptimize(out.data());
+    });
+
+    bench.Run("color/unpremultiply_batch_4k", PIXEL_COUNT, [&] {
+        util::batch::Unpremultiply(SOURCE, out);
+        DoNotOptimize(out.data());
+    });
+
+    bench.Run("color/srgb_to_linear_4k", PIXEL_COUNT, [&] {
+        util::batch::SrgbToLinear(SOURCE, linear);
+        DoNotOptimize(linear.data());
+    });
+
+    bench.Run("color/linear_to_srgb_4k", PIXEL_COUNT, [&] {
+        util::batch::LinearToSrgb(linear, out);
+        DoNotOptimize(out.data());
+    });
+}
+
+DULL_BENCH_SUITE(util_rect)
+{
+    const std::vector<util::Vec2f> POSITIONS  = sRandomVectors(RECT_COUNT, 5);
+    const std::vector<util::Vec2f> DIMENSIONS = sRandomVectors(RECT_COUNT, 6);
+    std::vector<util::Rect> rects(RECT_COUNT);
+
+    for (size_t index = 0; index < RECT_COUNT; index++)
+        rects[index] = {POSITIONS[index], {std::abs(DIMENSIONS[index].x) / 50.0F + 1.0F, std::abs(DIMENSIONS[index].y) / 50.0F + 1.0F}};
+
+    const util::Rect  PROBE_RECT  = {-100.0F, -100.0F, 200.0F, 200.0F};
+    const util::Vec2f PROBE_POINT = {12.5F, -40.0F};
+
+    // One probe against every collider, what a naive trigger or mouse pick does each frame
+    bench.Run("rect/collides_rect_10k", RECT_COUNT, [&] {
+        uint32_t hitCount = 0;
+        for (const util::Rect& rect : rects) hitCount += rect.CollidesWith(PROBE_RECT);
+        DoNotOptimize(hitCount);
+    });
+
+    bench.Run("rect/collides_point_10k", RECT_COUNT, [&] {
+        uint32_t hitCount = 0;
+        for (const util::Rect& rect : rects) hitCount += rect.CollidesWith(PROBE_POINT);
+        DoNotOptimize(hitCount);
+    });
+}
@@ -0,0 +1,120 @@
+#include "tools/bench/bench.hpp"
+#include "tools/bench/bench_report.hpp"
+
+#include <engine/config.hpp>
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace dull;
+
+// ---
+// dull_bench [--filter <text>] [--json <out.json>] [--baseline <in.json>] [--max-regression <percent>] [--min-time <ms>] [--list]
+// Runs every suite (or the cases whose name contains the filter) and prints ns/op and op/s per case
+// Note: with a baseline the exit code is 1 when a case regressed, see bench::FindRegressions
+// Note: allocation counts need an engine built with DULL_TRACK_HEAP_ALLOCATIONS
+// ---
+
+struct _Options {
+    std::string filter;
+    std::string jsonPath;
+    std::string baselinePath;
+    double maxRegressionPercent = 10.0;
+    double minSampleTime        = 0.05;
+    bool   isListing            = false;
+};
+
+[[nodiscard]] static bool sParseNumber(std::string_view text, double& out) noexcept
+{
+    const auto [END, ERROR] = std::from_chars(text.data(), text.data() + text.size(), out);
+    return ERROR == std::errc {} && END == text.data() + text.size();
+}
+
+[[nodiscard]] static bool sParseOptions(const std::vector<std::string_view>& arguments, _Options& options)
+{
+    for (size_t index = 0; index < arguments.size(); index++)
+    {
+        const std::string_view ARGUMENT = arguments[index];
+
+        if (ARGUMENT == "--list")
+        {
+            options.isListing = true;
+            continue;
+        }
+
+        if (index + 1 >= arguments.size()) return false;
+
+        const std::string_view VALUE = arguments[++index];
+        double number = 0.0;
+
+        if      (ARGUMENT == "--filter"  ) options.filter       = VALUE;
+        else if (ARGUMENT == "--json"    ) options.jsonPath     = VALUE;
+        else if (ARGUMENT == "--baseline") options.baselinePath = VALUE;
+        else if (ARGUMENT == "--max-regression" && sParseNumber(VALUE, number) && number >= 0.0) options.maxRegressionPercent = number;
+        else if (ARGUMENT == "--min-time"       && sParseNumber(VALUE, number) && number >  0.0) options.minSampleTime = number / 1000.0;
+        else return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    zutil::Logger logger {{config::DULL_TAG, {"[BENCH]", zutil::ANSI::EX_Black}}};
+    _Options options;
+
+    if (!sParseOptions({argv + 1, argv + argc}, options))
+    {
+        logger.Log(zutil::INFO, "Usage: dull_bench [--filter <text>] [--json <out.json>] [--baseline <in.json>] [--max-regression <percent>] [--min-time <ms>] [--list]");
+        return 2;
+    }
+
+    std::vector<bench::_Suite> suites = bench::_GetSuites();
+    std::ranges::sort(suites, {}, &bench::_Suite::name);
+
+    if (options.isListing)
+    {
+        for (const bench::_Suite& suite : suites) logger.Log(zutil::INFO, {"{}", suite.name});
+        return 0;
+    }
+
+    bench::Bench bench {options.filter, options.minSampleTime};
+
+    for (const bench::_Suite& suite : suites) suite.fn(bench);
+
+    if (!options.jsonPath.empty() && !bench::WriteJson(options.jsonPath, bench.GetResults()))
+    {
+        logger.Log(zutil::INFO, {"Can't write '{}'", options.jsonPath});
+        return 2;
+    }
+
+    if (options.baselinePath.empty()) return 0;
+
+    std::vector<bench::BenchResult> baseline;
+
+    if (!bench::ReadJson(options.baselinePath, baseline))
+    {
+        logger.Log(zutil::INFO, {"Can't read baseline '{}'", options.baselinePath});
+        return 2;
+    }
+
+    const std::vector<bench::BenchRegression> REGRESSIONS = bench::FindRegressions(baseline, bench.GetResults(), options.maxRegressionPercent);
+
+    for (const bench::BenchRegression& regression : REGRESSIONS)
+    {
+        logger.Log(zutil::INFO, {
+            "REGRESSION {} {}: {} -> {} ({:+.1f}%)",
+            regression.name, regression.metric, regression.baseline, regression.current,
+            regression.baseline > 0.0 ? (regression.current / regression.baseline - 1.0) * 100.0 : 100.0
+        });
+    }
+
+    logger.Log(zutil::INFO, {"{} regressions against '{}' (threshold {}%)", REGRESSIONS.size(), options.baselinePath, options.maxRegressionPercent});
+    return REGRESSIONS.empty() ? 0 : 1;
+}
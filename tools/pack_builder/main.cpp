@@ -0,0 +1,240 @@
+#include <engine/asset/pack_compression.hpp>
+#include <engine/asset/pack_format.hpp>
+#include <engine/config.hpp>
+#include <engine/platform/mapped_file.hpp>
+
+#include <vendor/zutil/zutil.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+using namespace dull;
+
+// ---
+// dull_pack <input directory> <output.pack> [--lz4 | --zstd]
+// Packs every regular file below the input directory, names are their '/' separated relative paths
+// Note: an entry is only stored compressed when that saves at least an eighth of its size
+// Note: entries compressing past PACK_MAX_EXPANSION are stored uncompressed, readers reject them
+// ---
+
+struct _PackFile {
+    std::string name;
+    std::filesystem::path path;
+    uint64_t hash;
+};
+
+struct PackBuilder final : public zutil::Logger {
+private:
+    std::vector<_PackFile> _files;
+
+    uint64_t _rawBytes    = 0;
+    uint64_t _storedBytes = 0;
+    uint32_t _compressedCount = 0;
+
+    [[nodiscard]] static uint64_t _AlignUp(uint64_t offset, uint64_t alignment) noexcept
+    {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    static void _Pad(std::ofstream& stream, uint64_t offset)
+    {
+        static constexpr char ZEROS[asset::PACK_BLOB_ALIGNMENT] {};
+
+        for (uint64_t position = static_cast<uint64_t>(stream.tellp()); position < offset;)
+        {
+            const uint64_t COUNT = std::min<uint64_t>(offset - position, sizeof(ZEROS));
+            stream.write(ZEROS, static_cast<std::streamsize>(COUNT));
+            position += COUNT;
+        }
+    }
+
+    [[nodiscard]] bool _Collect(const std::filesystem::path& root)
+    {
+        std::error_code error;
+
+        for (auto it = std::filesystem::recursive_directory_iterator(root, error);
+             !error && it != std::filesystem::recursive_directory_iterator();
+             it.increment(error))
+        {
+            if (!it->is_regular_file(error)) continue;
+
+            std::string name = std::filesystem::relative(it->path(), root, error).generic_string();
+            const uint64_t HASH = asset::HashPackName(name);
+
+            this->_files.push_back({std::move(name), it->path(), HASH});
+        }
+
+        if (error)
+        {
+            this->Log(zutil::INFO, {"Can't walk '{}': {}", root.string(), error.message()});
+            return false;
+        }
+
+        // Hash order makes every bucket one contiguous range of the entry table
+        std::sort(this->_files.begin(), this->_files.end(), [](const _PackFile& lhs, const _PackFile& rhs) {
+            return lhs.hash != rhs.hash ? lhs.hash < rhs.hash : lhs.name < rhs.name;
+        });
+
+        return true;
+    }
+
+public:
+    PackBuilder()
+    : zutil::Logger {
+        {
+            config::DULL_TAG,
+            {"[PACK]", zutil::ANSI::EX_Black}
+        }
+    }
+    {}
+
+    void PrintUsage() { this->Log(zutil::INFO, "Usage: dull_pack <input directory> <output.pack> [--lz4 | --zstd]"); }
+
+    [[nodiscard]] bool Build(const std::filesystem::path& root, const std::filesystem::path& output, asset::PackCompression compression)
+    {
+        if (!asset::IsPackCompressionAvailable(compression))
+        {
+            this->Log(zutil::INFO, "Compression not built in, reconfigure with DULL_PACK_LZ4 / DULL_PACK_ZSTD");
+            return false;
+        }
+
+        if (!this->_Collect(root)) return false;
+
+        // Tables are sized up front so blobs stream straight to their final offsets
+        asset::PackHeader header {};
+        header.magic       = asset::PACK_MAGIC;
+        header.version     = asset::PACK_VERSION;
+        header.entryCount  = static_cast<uint32_t>(this->_files.size());
+        header.bucketCount = std::bit_ceil(std::max<uint32_t>(header.entryCount, 1));
+
+        std::vector<uint32_t> directory(header.bucketCount + size_t {1}, 0);
+        std::vector<asset::PackEntry> entries(this->_files.size());
+        std::string names;
+
+        for (size_t index = 0; index < this->_files.size(); index++)
+        {
+            const _PackFile& file = this->_files[index];
+
+            entries[index].nameHash   = file.hash;
+            entries[index].nameOffset = static_cast<uint32_t>(names.size());
+            entries[index].nameLength = static_cast<uint32_t>(file.name.size());
+            names += file.name;
+
+            directory[asset::GetPackBucket(file.hash, header.bucketCount) + 1]++;
+        }
+
+        for (uint32_t bucket = 0; bucket < header.bucketCount; bucket++) directory[bucket + 1] += directory[bucket];
+
+        header.directoryOffset = sizeof(asset::PackHeader);
+        header.entriesOffset   = _AlignUp(header.directoryOffset + directory.size() * sizeof(uint32_t), alignof(asset::PackEntry));
+        header.namesOffset     = header.entriesOffset + entries.size() * sizeof(asset::PackEntry);
+        header.namesSize       = static_cast<uint32_t>(names.size());
+
+        std::ofstream stream {output, std::ios::binary | std::ios::trunc};
+
+        if (!stream)
+        {
+            this->Log(zutil::INFO, {"Can't write '{}'", output.string()});
+            return false;
+        }
+
+        uint64_t offset = header.namesOffset + names.size();
+        std::vector<std::byte> compressed;
+
+        for (size_t index = 0; index < this->_files.size(); index++)
+        {
+            platform::MappedFile file;
+
+            if (!file.Open(this->_files[index].path.string()))
+            {
+                this->Log(zutil::INFO, {"Can't read '{}'", this->_files[index].path.string()});
+                return false;
+            }
+
+            std::span<const std::byte> stored = file.GetBytes();
+            asset::PackEntry& entry = entries[index];
+
+            entry.size        = stored.size();
+            entry.compression = asset::PackCompression::None;
+
+            if (compression != asset::PackCompression::None
+                && asset::CompressPackBlob(compression, stored, compressed)
+                && compressed.size() <= stored.size() - stored.size() / 8
+                && asset::IsPackExpansionValid(compressed.size(), stored.size()))
+            {
+                stored            = compressed;
+                entry.compression = compression;
+                this->_compressedCount++;
+            }
+
+            offset = _AlignUp(
+                offset,
+                entry.compression == asset::PackCompression::None ? asset::PACK_BLOB_ALIGNMENT : asset::PACK_COMPRESSED_BLOB_ALIGNMENT
+            );
+
+            entry.offset     = offset;
+            entry.storedSize = stored.size();
+
+            _Pad(stream, offset);
+            stream.write(reinterpret_cast<const char*>(stored.data()), static_cast<std::streamsize>(stored.size()));
+            offset += stored.size();
+
+            this->_rawBytes    += entry.size;
+            this->_storedBytes += entry.storedSize;
+        }
+
+        header.fileSize = offset;
+
+        stream.seekp(0);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(reinterpret_cast<const char*>(directory.data()), static_cast<std::streamsize>(directory.size() * sizeof(uint32_t)));
+        _Pad(stream, header.entriesOffset);
+        stream.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(asset::PackEntry)));
+        stream.write(names.data(), static_cast<std::streamsize>(names.size()));
+
+        if (!stream.flush())
+        {
+            this->Log(zutil::INFO, {"Failed writing '{}'", output.string()});
+            return false;
+        }
+
+        this->Log(zutil::INFO, {
+            "Packed {} files ({} compressed) into '{}', {} -> {} bytes",
+            this->_files.size(), this->_compressedCount, output.string(), this->_rawBytes, this->_storedBytes
+        });
+
+        return true;
+    }
+};
+
+int main(int argc, char** argv)
+{
+    const std::vector<std::string_view> ARGUMENTS(argv + 1, argv + argc);
+
+    asset::PackCompression compression = asset::PackCompression::None;
+    std::vector<std::string_view> paths;
+
+    for (const std::string_view ARGUMENT : ARGUMENTS)
+    {
+        if      (ARGUMENT == "--lz4" ) compression = asset::PackCompression::Lz4;
+        else if (ARGUMENT == "--zstd") compression = asset::PackCompression::Zstd;
+        else paths.push_back(ARGUMENT);
+    }
+
+    PackBuilder builder;
+
+    if (paths.size() != 2)
+    {
+        builder.PrintUsage();
+        return 1;
+    }
+
+    return builder.Build(paths[0], paths[1], compression) ? 0 : 1;
+}